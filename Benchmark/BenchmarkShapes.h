@@ -0,0 +1,135 @@
+/*!
+ *  @file BenchmarkShapes.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Reflected struct shapes used by the benchmarks : flat, quantized, padding-free integer key, deeply nested, wide (128 fields), array payloads & hot/cold tagged
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+#include "Reflection/Layout.h"
+
+namespace Benchmark
+{
+	/** Flat struct, mirrors FooStruct */
+	struct FFlat
+	{
+		double X = 0.0;
+		double Y = 0.0;
+		double Z = 0.0;
+		std::uint32_t W = 0;
+	};
+
+	/** Padding-free integer key, compared & hashed as a single block of bytes */
+	struct FKey
+	{
+		std::uint32_t Id = 0;
+		std::uint32_t Generation = 0;
+		std::uint64_t Owner = 0;
+		std::int32_t Cell[4] = {};
+	};
+
+	/** 8 levels of nesting, 2 doubles per level */
+	struct FDeep0 { double A = 0.0; double B = 0.0; };
+	struct FDeep1 { FDeep0 Child; double A = 0.0; double B = 0.0; };
+	struct FDeep2 { FDeep1 Child; double A = 0.0; double B = 0.0; };
+	struct FDeep3 { FDeep2 Child; double A = 0.0; double B = 0.0; };
+	struct FDeep4 { FDeep3 Child; double A = 0.0; double B = 0.0; };
+	struct FDeep5 { FDeep4 Child; double A = 0.0; double B = 0.0; };
+	struct FDeep6 { FDeep5 Child; double A = 0.0; double B = 0.0; };
+	struct FDeep7 { FDeep6 Child; double A = 0.0; double B = 0.0; };
+	using FDeep = FDeep7;
+
+#define RF_BENCH_FIELDS_8(P) double P##0 = 0.0; double P##1 = 0.0; double P##2 = 0.0; double P##3 = 0.0; double P##4 = 0.0; double P##5 = 0.0; double P##6 = 0.0; double P##7 = 0.0;
+#define RF_BENCH_FIELDS_64(P) RF_BENCH_FIELDS_8(P##0) RF_BENCH_FIELDS_8(P##1) RF_BENCH_FIELDS_8(P##2) RF_BENCH_FIELDS_8(P##3) RF_BENCH_FIELDS_8(P##4) RF_BENCH_FIELDS_8(P##5) RF_BENCH_FIELDS_8(P##6) RF_BENCH_FIELDS_8(P##7)
+#define RF_BENCH_ENTRIES_8(P) RF_ENTRY(P##0), RF_ENTRY(P##1), RF_ENTRY(P##2), RF_ENTRY(P##3), RF_ENTRY(P##4), RF_ENTRY(P##5), RF_ENTRY(P##6), RF_ENTRY(P##7)
+#define RF_BENCH_ENTRIES_64(P) RF_BENCH_ENTRIES_8(P##0), RF_BENCH_ENTRIES_8(P##1), RF_BENCH_ENTRIES_8(P##2), RF_BENCH_ENTRIES_8(P##3), RF_BENCH_ENTRIES_8(P##4), RF_BENCH_ENTRIES_8(P##5), RF_BENCH_ENTRIES_8(P##6), RF_BENCH_ENTRIES_8(P##7)
+#define RF_BENCH_SUM_8(O, P) O.P##0 + O.P##1 + O.P##2 + O.P##3 + O.P##4 + O.P##5 + O.P##6 + O.P##7
+#define RF_BENCH_SUM_64(O, P) RF_BENCH_SUM_8(O, P##0) + RF_BENCH_SUM_8(O, P##1) + RF_BENCH_SUM_8(O, P##2) + RF_BENCH_SUM_8(O, P##3) + RF_BENCH_SUM_8(O, P##4) + RF_BENCH_SUM_8(O, P##5) + RF_BENCH_SUM_8(O, P##6) + RF_BENCH_SUM_8(O, P##7)
+
+	/** 128 doubles */
+	struct FWide
+	{
+		RF_BENCH_FIELDS_64(A)
+		RF_BENCH_FIELDS_64(B)
+	};
+
+	/** Wide struct of which a per-frame loop only touches 3 fields */
+	struct FHotCold
+	{
+		double Position = 0.0;
+		double Velocity = 0.0;
+		RF_BENCH_FIELDS_64(C)
+		double Acceleration = 0.0;
+	};
+
+	/** Flat struct, quantized for network packets */
+	struct FNetFlat
+	{
+		double X = 0.0;
+		double Y = 0.0;
+		double Z = 0.0;
+		std::uint32_t W = 0;
+	};
+
+	/** Payload held in array members */
+	struct FPayload
+	{
+		std::uint32_t Id = 0;
+		float Bounds[4] = {};
+		std::vector<std::int32_t> Samples;
+	};
+}
+
+RF_BEGIN_LAYOUT(Benchmark::FFlat)
+	RF_ENTRY(X),
+	RF_ENTRY(Y),
+	RF_ENTRY(Z),
+	RF_ENTRY(W)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Benchmark::FNetFlat)
+	RF_TAGGED_ENTRY(X, Replicated, Reflection::FQuantize::FromPrecision(-8192.f, 8192.f, 0.01f)),
+	RF_TAGGED_ENTRY(Y, Replicated, Reflection::FQuantize::FromPrecision(-8192.f, 8192.f, 0.01f)),
+	RF_TAGGED_ENTRY(Z, Replicated, Reflection::FQuantize::FromPrecision(-8192.f, 8192.f, 0.01f)),
+	RF_TAGGED_ENTRY(W, Replicated, Reflection::FQuantize{ 0.f, 8191.f, 13 })
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Benchmark::FKey)
+	RF_ENTRY(Id),
+	RF_ENTRY(Generation),
+	RF_ENTRY(Owner),
+	RF_ENTRY(Cell)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Benchmark::FDeep0) RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+RF_BEGIN_LAYOUT(Benchmark::FDeep1) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+RF_BEGIN_LAYOUT(Benchmark::FDeep2) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+RF_BEGIN_LAYOUT(Benchmark::FDeep3) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+RF_BEGIN_LAYOUT(Benchmark::FDeep4) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+RF_BEGIN_LAYOUT(Benchmark::FDeep5) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+RF_BEGIN_LAYOUT(Benchmark::FDeep6) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+RF_BEGIN_LAYOUT(Benchmark::FDeep7) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B) RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Benchmark::FWide)
+	RF_BENCH_ENTRIES_64(A),
+	RF_BENCH_ENTRIES_64(B)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Benchmark::FPayload)
+	RF_ENTRY(Id),
+	RF_ENTRY(Bounds),
+	RF_ENTRY(Samples)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Benchmark::FHotCold)
+	RF_TAGGED_ENTRY(Position, Hot),
+	RF_TAGGED_ENTRY(Velocity, Hot),
+	RF_BENCH_ENTRIES_64(C),
+	RF_TAGGED_ENTRY(Acceleration, Hot)
+RF_END_LAYOUT()
@@ -0,0 +1,163 @@
+# Compile-time stress suite
+# Generates wide (50/200/1000 fields) & deep (8 levels) reflected structs, one translation unit per shape & operation,
+# compiled by the ReflectionCompileStress target. CompileStressRunner re-compiles each unit in isolation and reports
+# its compile time & peak compiler memory.
+
+set(RF_STRESS_DIR "${CMAKE_BINARY_DIR}/CompileStress")
+set(RF_STRESS_WIDE_SIZES 50 200 1000)
+set(RF_STRESS_DEEP_LEVELS 8)
+set(RF_STRESS_OPERATIONS MakeNamedLayout VisitTupleElements IterateLayoutNamed)
+
+# Only touch generated files whose content changed, so that re-configuring does not rebuild the suite
+function(rf_stress_write Path Content)
+  if (EXISTS "${Path}")
+    file(READ "${Path}" Existing)
+    if (Existing STREQUAL Content)
+      return()
+    endif()
+  endif()
+  file(WRITE "${Path}" "${Content}")
+endfunction()
+
+# Wide shapes : int32/float/double fields, in turn
+foreach(Size ${RF_STRESS_WIDE_SIZES})
+  set(Members "")
+  set(Entries "")
+  math(EXPR Last "${Size} - 1")
+  foreach(i RANGE ${Last})
+    math(EXPR Kind "${i} % 3")
+    if (Kind EQUAL 0)
+      set(FieldType "std::int32_t")
+    elseif (Kind EQUAL 1)
+      set(FieldType "float")
+    else()
+      set(FieldType "double")
+    endif()
+    string(APPEND Members "\t\t${FieldType} F${i} = {};\n")
+    if (i EQUAL Last)
+      string(APPEND Entries "\tRF_ENTRY(F${i})\n")
+    else()
+      string(APPEND Entries "\tRF_ENTRY(F${i}),\n")
+    endif()
+  endforeach()
+
+  rf_stress_write("${RF_STRESS_DIR}/Wide${Size}.h"
+"// Generated by CompileStress.cmake
+#pragma once
+
+#include <cstdint>
+
+#include \"Reflection/Layout.h\"
+
+namespace CompileStress
+{
+\tstruct FWide${Size}
+\t{
+${Members}\t};
+}
+
+RF_BEGIN_LAYOUT(CompileStress::FWide${Size})
+${Entries}RF_END_LAYOUT()
+")
+  list(APPEND RF_STRESS_SHAPES "Wide${Size}")
+endforeach()
+
+# Deep shape : each level holds the previous one & 3 scalars
+set(Members "")
+set(Layouts "")
+math(EXPR LastLevel "${RF_STRESS_DEEP_LEVELS} - 1")
+foreach(Level RANGE ${LastLevel})
+  if (Level EQUAL 0)
+    string(APPEND Members "\tstruct FDeepLevel0 { std::int32_t A = 0; float B = 0.f; double C = 0.0; };\n")
+    string(APPEND Layouts "RF_BEGIN_LAYOUT(CompileStress::FDeepLevel0) RF_ENTRY(A), RF_ENTRY(B), RF_ENTRY(C) RF_END_LAYOUT()\n")
+  else()
+    math(EXPR Previous "${Level} - 1")
+    string(APPEND Members "\tstruct FDeepLevel${Level} { FDeepLevel${Previous} Child; std::int32_t A = 0; float B = 0.f; double C = 0.0; };\n")
+    string(APPEND Layouts "RF_BEGIN_LAYOUT(CompileStress::FDeepLevel${Level}) RF_ENTRY(Child), RF_ENTRY(A), RF_ENTRY(B), RF_ENTRY(C) RF_END_LAYOUT()\n")
+  endif()
+endforeach()
+
+rf_stress_write("${RF_STRESS_DIR}/Deep${RF_STRESS_DEEP_LEVELS}.h"
+"// Generated by CompileStress.cmake
+#pragma once
+
+#include <cstdint>
+
+#include \"Reflection/Layout.h\"
+
+namespace CompileStress
+{
+${Members}
+\tusing FDeep${RF_STRESS_DEEP_LEVELS} = FDeepLevel${LastLevel};
+}
+
+${Layouts}")
+list(APPEND RF_STRESS_SHAPES "Deep${RF_STRESS_DEEP_LEVELS}")
+
+# One translation unit per shape & operation
+set(RF_STRESS_SOURCES "")
+set(Manifest "")
+foreach(Shape ${RF_STRESS_SHAPES})
+  foreach(Operation ${RF_STRESS_OPERATIONS})
+    if (Operation STREQUAL "MakeNamedLayout")
+      set(Body "\tconstexpr auto Layout = Reflection::MakeNamedLayout<CompileStress::F${Shape}>();\n\treturn Layout.Get<0>().GetOffset() + TTupleArity<std::decay_t<decltype(Layout)>>::Value;")
+    elseif (Operation STREQUAL "VisitTupleElements")
+      set(Body "\tint Sum = 0;\n\tVisitTupleElements([&Sum](const auto& InField) { Sum += InField.GetOffset(); }, Reflection::MakeNamedLayout<CompileStress::F${Shape}>());\n\treturn Sum;")
+    else()
+      set(Body "\tint Count = 0;\n\tReflection::IterateLayoutNamed<CompileStress::F${Shape}>([&Count](const auto&, const auto&) { ++Count; return Reflection::EFieldIterator::Enter; });\n\treturn Count;")
+    endif()
+
+    set(Source "${RF_STRESS_DIR}/${Shape}_${Operation}.cpp")
+    rf_stress_write("${Source}"
+"// Generated by CompileStress.cmake
+#include <type_traits>
+
+#include \"${Shape}.h\"
+#include \"Reflection/LayoutIterator.h\"
+#include \"Core/TupleVisitor.h\"
+
+int CompileStress_${Shape}_${Operation}()
+{
+${Body}
+}
+")
+    list(APPEND RF_STRESS_SOURCES "${Source}")
+    string(APPEND Manifest "\t{ \"${Shape}\", \"${Operation}\", \"${Source}\" },\n")
+  endforeach()
+endforeach()
+
+# Every unit is part of the regular build, so that a regression which breaks wide layouts fails the build
+add_library(ReflectionCompileStress OBJECT ${RF_STRESS_SOURCES})
+target_include_directories(ReflectionCompileStress PRIVATE "include" "${RF_STRESS_DIR}")
+set_property(TARGET ReflectionCompileStress PROPERTY CXX_STANDARD 20)
+
+# Runner, measuring each unit in isolation
+if (MSVC)
+  set(RF_STRESS_MSVC_STYLE 1)
+else()
+  set(RF_STRESS_MSVC_STYLE 0)
+endif()
+rf_stress_write("${RF_STRESS_DIR}/CompileStressManifest.h"
+"// Generated by CompileStress.cmake
+#pragma once
+
+#define RF_STRESS_COMPILER \"${CMAKE_CXX_COMPILER}\"
+#define RF_STRESS_INCLUDE_DIR \"${CMAKE_CURRENT_SOURCE_DIR}/include\"
+#define RF_STRESS_GENERATED_DIR \"${RF_STRESS_DIR}\"
+#define RF_STRESS_MSVC_STYLE ${RF_STRESS_MSVC_STYLE}
+
+static const FStressUnit GStressUnits[] =
+{
+${Manifest}};
+")
+
+add_executable(CompileStressRunner "Benchmark/CompileStress/CompileStressRunner.cpp")
+target_include_directories(CompileStressRunner PRIVATE "${RF_STRESS_DIR}")
+set_property(TARGET CompileStressRunner PROPERTY CXX_STANDARD 20)
+
+add_custom_target(CompileStressReport
+  COMMAND CompileStressRunner
+  DEPENDS CompileStressRunner
+  WORKING_DIRECTORY "${RF_STRESS_DIR}"
+  COMMENT "Measuring compile time & memory of the stress units"
+  USES_TERMINAL)
@@ -0,0 +1,141 @@
+/*!
+ *  @file CompileStressRunner.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Compiles each generated stress unit in isolation, reporting its compile time & the peak memory of the compiler.
+ *  Extra arguments are forwarded to the compiler (e.g -O2).
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+extern char** environ;
+#endif
+
+/** A generated translation unit */
+struct FStressUnit
+{
+	const char* Shape;
+	const char* Operation;
+	const char* Source;
+};
+
+#include "CompileStressManifest.h"
+
+namespace CompileStress
+{
+	struct FCompileResult
+	{
+		bool bSuccess = false;
+		double Milliseconds = 0.0;
+		/** Peak resident memory of the compiler, 0 if unknown */
+		double PeakMegabytes = 0.0;
+	};
+
+	std::vector<std::string> MakeCommand(const FStressUnit& InUnit, const std::vector<std::string>& InExtraArgs)
+	{
+		std::vector<std::string> Command = { RF_STRESS_COMPILER };
+#if RF_STRESS_MSVC_STYLE
+		Command.insert(Command.end(), { "/nologo", "/std:c++20", "/EHsc", "/c", "/I" RF_STRESS_INCLUDE_DIR, "/I" RF_STRESS_GENERATED_DIR,
+			InUnit.Source, "/Fo" RF_STRESS_GENERATED_DIR "/StressUnit.obj" });
+#else
+		Command.insert(Command.end(), { "-std=c++20", "-I" RF_STRESS_INCLUDE_DIR, "-I" RF_STRESS_GENERATED_DIR,
+			"-c", InUnit.Source, "-o", RF_STRESS_GENERATED_DIR "/StressUnit.o" });
+#endif
+		Command.insert(Command.end(), InExtraArgs.begin(), InExtraArgs.end());
+		return Command;
+	}
+
+#if defined(_WIN32)
+	FCompileResult Compile(const std::vector<std::string>& InCommand)
+	{
+		std::string CommandLine;
+		for (const std::string& Arg : InCommand)
+			CommandLine += "\"" + Arg + "\" ";
+
+		FCompileResult Result;
+		STARTUPINFOA StartupInfo = {};
+		StartupInfo.cb = sizeof(StartupInfo);
+		PROCESS_INFORMATION ProcessInfo = {};
+
+		const auto Start = std::chrono::steady_clock::now();
+		if (!CreateProcessA(nullptr, CommandLine.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &StartupInfo, &ProcessInfo))
+			return Result;
+
+		WaitForSingleObject(ProcessInfo.hProcess, INFINITE);
+		Result.Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+
+		DWORD ExitCode = 1;
+		GetExitCodeProcess(ProcessInfo.hProcess, &ExitCode);
+		PROCESS_MEMORY_COUNTERS Counters = {};
+		if (K32GetProcessMemoryInfo(ProcessInfo.hProcess, &Counters, sizeof(Counters)))
+			Result.PeakMegabytes = double(Counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+
+		CloseHandle(ProcessInfo.hThread);
+		CloseHandle(ProcessInfo.hProcess);
+		Result.bSuccess = ExitCode == 0;
+		return Result;
+	}
+#else
+	FCompileResult Compile(const std::vector<std::string>& InCommand)
+	{
+		std::vector<char*> Args;
+		for (const std::string& Arg : InCommand)
+			Args.push_back(const_cast<char*>(Arg.c_str()));
+		Args.push_back(nullptr);
+
+		FCompileResult Result;
+		const auto Start = std::chrono::steady_clock::now();
+		pid_t Pid = 0;
+		if (posix_spawnp(&Pid, Args[0], nullptr, nullptr, Args.data(), environ) != 0)
+			return Result;
+
+		// wait4 reports the usage of this child only, unlike getrusage(RUSAGE_CHILDREN) which keeps the maximum of all children
+		int Status = 0;
+		rusage Usage = {};
+		if (wait4(Pid, &Status, 0, &Usage) < 0)
+			return Result;
+		Result.Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+
+#if defined(__APPLE__)
+		Result.PeakMegabytes = double(Usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+		Result.PeakMegabytes = double(Usage.ru_maxrss) / 1024.0;
+#endif
+		Result.bSuccess = WIFEXITED(Status) && WEXITSTATUS(Status) == 0;
+		return Result;
+	}
+#endif
+}
+
+int main(int InArgc, char** InArgv)
+{
+	const std::vector<std::string> ExtraArgs(InArgv + 1, InArgv + InArgc);
+
+	std::printf("%-10s %-20s %12s %12s\n", "Shape", "Operation", "Time (ms)", "Peak (MB)");
+	int NumFailures = 0;
+	for (const FStressUnit& Unit : GStressUnits)
+	{
+		const CompileStress::FCompileResult Result = CompileStress::Compile(CompileStress::MakeCommand(Unit, ExtraArgs));
+		if (!Result.bSuccess)
+		{
+			std::printf("%-10s %-20s %12s\n", Unit.Shape, Unit.Operation, "FAILED");
+			++NumFailures;
+			continue;
+		}
+		std::printf("%-10s %-20s %12.0f %12.1f\n", Unit.Shape, Unit.Operation, Result.Milliseconds, Result.PeakMegabytes);
+		std::fflush(stdout);
+	}
+	return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,762 @@
+/*!
+ *  @file ReflectionBenchmark.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Micro-benchmarks of the reflection hot paths against hand-written member access.
+ *  Build with optimizations (e.g -DCMAKE_BUILD_TYPE=Release) for meaningful numbers.
+ */
+
+#include "BenchmarkShapes.h"
+
+#include "Reflection/LayoutIterator.h"
+#include "Reflection/LayoutView.h"
+#include "Reflection/Layout.h"
+#include "Reflection/LayoutJson.h"
+#include "Reflection/LayoutJsonReader.h"
+#include "Reflection/LayoutParallel.h"
+#include "Reflection/LayoutSerializer.h"
+#include "Reflection/LayoutHash.h"
+#include "Reflection/LayoutHotCold.h"
+#include "Reflection/LayoutPool.h"
+#include "Reflection/LayoutCopyPlan.h"
+#include "Reflection/LayoutBlend.h"
+#include "Reflection/LayoutBitSerializer.h"
+#include "Reflection/LayoutAsyncDeserializer.h"
+#include "Reflection/LayoutCompare.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+	/**
+	 * Prevent the compiler from optimizing a value away
+	 */
+	template<class T>
+	inline void DoNotOptimize(const T& InValue)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(InValue) : "memory");
+#else
+		static const void* volatile Sink;
+		Sink = &InValue;
+#endif
+	}
+
+	/** Number of objects processed per benchmark iteration (fits in L2 for the small shapes) */
+	constexpr std::size_t NumObjects = 1024;
+
+	/**
+	 * Run a benchmark and print its result
+	 * Each iteration processes NumObjects objects; the best of several runs is reported
+	 * @param InName Benchmark name
+	 * @param InBytesPerObject Bytes touched per object, used to report a throughput (0 to only report ns/op)
+	 * @param InCallable Callable processing InNumObjects objects
+	 * @param InNumObjects Number of objects processed per iteration
+	 */
+	template<class callable_t>
+	void Run(const char* InName, std::size_t InBytesPerObject, callable_t&& InCallable, std::size_t InNumObjects = NumObjects)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		// Calibrate so that a run lasts about 20ms
+		std::size_t Iterations = 1;
+		for (;;)
+		{
+			const Clock::time_point Start = Clock::now();
+			for (std::size_t i = 0; i < Iterations; ++i)
+				InCallable();
+			if (Clock::now() - Start > std::chrono::milliseconds(20) || Iterations >= (std::size_t(1) << 30))
+				break;
+			Iterations *= 2;
+		}
+
+		double BestNs = 1e300;
+		for (int Run = 0; Run < 5; ++Run)
+		{
+			const Clock::time_point Start = Clock::now();
+			for (std::size_t i = 0; i < Iterations; ++i)
+				InCallable();
+			const double Ns = std::chrono::duration<double, std::nano>(Clock::now() - Start).count();
+			BestNs = std::min(BestNs, Ns);
+		}
+
+		const double NsPerOp = BestNs / (double(Iterations) * InNumObjects);
+		if (InBytesPerObject == 0)
+		{
+			std::printf("%-48s %10.3f ns/op\n", InName, NsPerOp);
+			return;
+		}
+		const double BytesPerSecond = double(InBytesPerObject) / NsPerOp * 1e9;
+		std::printf("%-48s %10.3f ns/op %10.2f MB/s\n", InName, NsPerOp, BytesPerSecond / (1024.0 * 1024.0));
+	}
+
+	template<class T>
+	std::vector<T> MakeObjects()
+	{
+		std::vector<T> Result(NumObjects);
+		double Value = 1.0;
+		for (T& Object : Result)
+		{
+			Reflection::IterateLayoutNamed<T>([&](const auto&, const auto& InField)
+			{
+				using FieldType = typename std::decay_t<decltype(InField)>::Type;
+				if constexpr (std::is_arithmetic_v<FieldType>)
+					Rf::FLayoutFieldView(Rf::Ref(Object)).Get(InField) = static_cast<FieldType>(Value++);
+				return Reflection::EFieldIterator::Enter;
+			});
+		}
+		return Result;
+	}
+
+	/**
+	 * Sum every double reachable from an object through the layout iterator
+	 */
+	template<class T>
+	double SumDoubles(T& InObject)
+	{
+		double Sum = 0.0;
+		const Rf::FLayoutFieldView View(Rf::Ref(InObject));
+		Reflection::IterateLayoutNamed<T>([&](const auto&, const auto& InField)
+		{
+			using FieldType = typename std::decay_t<decltype(InField)>::Type;
+			if constexpr (std::is_same_v<FieldType, double>)
+				Sum += View.Get(InField);
+			return Reflection::EFieldIterator::Enter;
+		});
+		return Sum;
+	}
+
+	/**
+	 * Dump an object as key/value text through std::wostream, as ad-hoc debug dumps do
+	 */
+	template<class T>
+	void StreamDump(std::wostream& InStream, const T& InObject)
+	{
+		const Rf::FLayoutFieldConstView View(Rf::CRef(InObject));
+		Reflection::IterateLayoutNamed<T>([&](const auto&, const auto& InField)
+		{
+			using FieldType = typename std::decay_t<decltype(InField)>::Type;
+			if constexpr (std::is_arithmetic_v<FieldType>)
+				InStream << InField.GetName().CStr() << L" : " << View.Get(InField) << '\n';
+			return Reflection::EFieldIterator::Enter;
+		});
+	}
+
+	void RunFlat()
+	{
+		std::printf("\n-- Flat (%zu bytes)\n", sizeof(FFlat));
+		std::vector<FFlat> Objects = MakeObjects<FFlat>();
+		std::vector<FFlat> Copies(NumObjects);
+		constexpr auto Layout = Reflection::MakeNamedLayout<FFlat>();
+		constexpr auto FieldY = Layout.Get<1>();
+		std::string Buffer;
+
+		Run("direct member read (Y)", sizeof(double), [&]()
+		{
+			double Sum = 0.0;
+			for (const FFlat& Object : Objects)
+				Sum += Object.Y;
+			DoNotOptimize(Sum);
+		});
+		Run("FLayoutFieldView::Get (Y)", sizeof(double), [&]()
+		{
+			double Sum = 0.0;
+			for (FFlat& Object : Objects)
+				Sum += Rf::FLayoutFieldView(Rf::Ref(Object)).Get(FieldY);
+			DoNotOptimize(Sum);
+		});
+		Run("direct cast", sizeof(FFlat), [&]()
+		{
+			double Sum = 0.0;
+			for (FFlat& Object : Objects)
+				Sum += static_cast<const FFlat&>(Object).X;
+			DoNotOptimize(Sum);
+		});
+		Run("FLayoutFieldView::Cast", sizeof(FFlat), [&]()
+		{
+			double Sum = 0.0;
+			for (FFlat& Object : Objects)
+				Sum += Rf::FLayoutFieldView(Rf::Ref(Object)).Cast<FFlat>().X;
+			DoNotOptimize(Sum);
+		});
+		Run("direct copy (operator=)", sizeof(FFlat), [&]()
+		{
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				Copies[i] = Objects[i];
+			DoNotOptimize(Copies.data());
+		});
+		Run("FLayoutFieldView::CopyTo", sizeof(FFlat), [&]()
+		{
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				Rf::FLayoutFieldConstView(Rf::CRef(Objects[i])).CopyTo(Rf::FLayoutFieldView(Rf::Ref(Copies[i])));
+			DoNotOptimize(Copies.data());
+		});
+		Run("IterateLayoutNamed, trivial callable", 0, [&]()
+		{
+			int32 Count = 0;
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				Reflection::IterateLayoutNamed<FFlat>([&Count](const auto&, const auto&) { ++Count; return Reflection::EFieldIterator::Enter; });
+			DoNotOptimize(Count);
+		});
+		Run("std::wostringstream dump", 0, [&]()
+		{
+			std::wostringstream Stream;
+			for (const FFlat& Object : Objects)
+				StreamDump(Stream, Object);
+			DoNotOptimize(Stream);
+		});
+		Run("WriteJson, reused buffer", 0, [&]()
+		{
+			Buffer.clear();
+			Reflection::FJsonWriter Writer(Buffer);
+			for (const FFlat& Object : Objects)
+				Reflection::WriteJson(Object, Writer);
+			DoNotOptimize(Buffer.data());
+		});
+		const std::string Text = Reflection::ToJson(Objects[0]);
+		Run("ReadJson", 0, [&]()
+		{
+			bool bSuccess = true;
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				bSuccess &= Reflection::FromJson(Text, Copies[i]);
+			DoNotOptimize(bSuccess);
+		});
+		Run("direct sum of doubles", 3 * sizeof(double), [&]()
+		{
+			double Sum = 0.0;
+			for (const FFlat& Object : Objects)
+				Sum += Object.X + Object.Y + Object.Z;
+			DoNotOptimize(Sum);
+		});
+		Run("IterateLayoutNamed, sum of doubles", 3 * sizeof(double), [&]()
+		{
+			double Sum = 0.0;
+			for (FFlat& Object : Objects)
+				Sum += SumDoubles(Object);
+			DoNotOptimize(Sum);
+		});
+	}
+
+	void RunDeep()
+	{
+		std::printf("\n-- Deep, 8 levels (%zu bytes)\n", sizeof(FDeep));
+		std::vector<FDeep> Objects = MakeObjects<FDeep>();
+
+		Run("direct sum of doubles", sizeof(FDeep), [&]()
+		{
+			double Sum = 0.0;
+			for (const FDeep& O : Objects)
+			{
+				const FDeep0& L0 = O.Child.Child.Child.Child.Child.Child.Child;
+				Sum += O.A + O.B + O.Child.A + O.Child.B + O.Child.Child.A + O.Child.Child.B
+					+ O.Child.Child.Child.A + O.Child.Child.Child.B + O.Child.Child.Child.Child.A + O.Child.Child.Child.Child.B
+					+ O.Child.Child.Child.Child.Child.A + O.Child.Child.Child.Child.Child.B
+					+ O.Child.Child.Child.Child.Child.Child.A + O.Child.Child.Child.Child.Child.Child.B
+					+ L0.A + L0.B;
+			}
+			DoNotOptimize(Sum);
+		});
+		Run("IterateLayoutNamed, sum of doubles", sizeof(FDeep), [&]()
+		{
+			double Sum = 0.0;
+			for (FDeep& Object : Objects)
+				Sum += SumDoubles(Object);
+			DoNotOptimize(Sum);
+		});
+		Run("IterateLayoutNamed, trivial callable", 0, [&]()
+		{
+			int32 Count = 0;
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				Reflection::IterateLayoutNamed<FDeep>([&Count](const auto&, const auto&) { ++Count; return Reflection::EFieldIterator::Enter; });
+			DoNotOptimize(Count);
+		});
+	}
+
+	void RunWide()
+	{
+		std::printf("\n-- Wide, 128 fields (%zu bytes)\n", sizeof(FWide));
+		std::vector<FWide> Objects = MakeObjects<FWide>();
+		std::vector<FWide> Copies(NumObjects);
+		std::string Buffer;
+
+		Run("direct sum of doubles", sizeof(FWide), [&]()
+		{
+			double Sum = 0.0;
+			for (const FWide& Object : Objects)
+				Sum += RF_BENCH_SUM_64(Object, A) + RF_BENCH_SUM_64(Object, B);
+			DoNotOptimize(Sum);
+		});
+		Run("IterateLayoutNamed, sum of doubles", sizeof(FWide), [&]()
+		{
+			double Sum = 0.0;
+			for (FWide& Object : Objects)
+				Sum += SumDoubles(Object);
+			DoNotOptimize(Sum);
+		});
+		Run("direct copy (operator=)", sizeof(FWide), [&]()
+		{
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				Copies[i] = Objects[i];
+			DoNotOptimize(Copies.data());
+		});
+		Run("FLayoutFieldView::CopyTo", sizeof(FWide), [&]()
+		{
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				Rf::FLayoutFieldConstView(Rf::CRef(Objects[i])).CopyTo(Rf::FLayoutFieldView(Rf::Ref(Copies[i])));
+			DoNotOptimize(Copies.data());
+		});
+		Run("WriteJson, reused buffer", 0, [&]()
+		{
+			Buffer.clear();
+			Reflection::FJsonWriter Writer(Buffer);
+			for (const FWide& Object : Objects)
+				Reflection::WriteJson(Object, Writer);
+			DoNotOptimize(Buffer.data());
+		});
+		const std::string Text = Reflection::ToJson(Objects[0]);
+		Run("ReadJson", 0, [&]()
+		{
+			bool bSuccess = true;
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				bSuccess &= Reflection::FromJson(Text, Copies[i]);
+			DoNotOptimize(bSuccess);
+		});
+	}
+
+	void RunPayload()
+	{
+		constexpr std::size_t NumSamples = 256;
+		std::printf("\n-- Payload, %zu samples per object\n", NumSamples);
+		std::vector<FPayload> Objects(NumObjects);
+		for (std::size_t i = 0; i < NumObjects; ++i)
+		{
+			Objects[i].Id = static_cast<std::uint32_t>(i);
+			Objects[i].Samples.resize(NumSamples);
+			for (std::size_t j = 0; j < NumSamples; ++j)
+				Objects[i].Samples[j] = static_cast<std::int32_t>(i * j);
+		}
+		constexpr std::size_t PayloadBytes = NumSamples * sizeof(std::int32_t);
+
+		std::vector<std::uint8_t> Buffer;
+		Run("Serialize, element by element", PayloadBytes, [&]()
+		{
+			Buffer.clear();
+			Reflection::FBinaryWriter Writer(Buffer);
+			for (const FPayload& Object : Objects)
+			{
+				Writer.WriteValue(Object.Id);
+				Writer.WriteValue(Object.Bounds);
+				Writer.WriteValue(static_cast<std::uint32_t>(Object.Samples.size()));
+				for (std::int32_t Sample : Object.Samples)
+					Writer.WriteValue(Sample);
+			}
+			DoNotOptimize(Buffer.data());
+		});
+		Run("Serialize, single block per array", PayloadBytes, [&]()
+		{
+			Buffer.clear();
+			Reflection::FBinaryWriter Writer(Buffer);
+			for (const FPayload& Object : Objects)
+				Reflection::Serialize(Object, Writer);
+			DoNotOptimize(Buffer.data());
+		});
+		Run("Hash, element by element", PayloadBytes, [&]()
+		{
+			std::uint64_t Hash = 0;
+			for (const FPayload& Object : Objects)
+			{
+				for (std::int32_t Sample : Object.Samples)
+					Hash = Reflection::HashCombine(Hash, static_cast<std::uint64_t>(Sample));
+			}
+			DoNotOptimize(Hash);
+		});
+		Run("HashLayout, single block per array", PayloadBytes, [&]()
+		{
+			std::uint64_t Hash = 0;
+			for (const FPayload& Object : Objects)
+				Hash ^= Reflection::HashLayout(Object);
+			DoNotOptimize(Hash);
+		});
+	}
+
+	void RunIncremental()
+	{
+		constexpr std::size_t NumSamples = 256;
+		constexpr std::size_t ChunkSize = 1500;
+		std::vector<FPayload> Objects(NumObjects);
+		for (std::size_t i = 0; i < NumObjects; ++i)
+		{
+			Objects[i].Id = static_cast<std::uint32_t>(i);
+			Objects[i].Samples.resize(NumSamples, static_cast<std::int32_t>(i));
+		}
+
+		std::vector<std::uint8_t> Buffer;
+		Reflection::FBinaryWriter Writer(Buffer);
+		for (const FPayload& Object : Objects)
+			Reflection::Serialize(Object, Writer);
+		const std::size_t RecordBytes = Buffer.size() / Objects.size();
+		std::printf("\n-- Record stream (%zu bytes per record, %zu bytes chunks)\n", RecordBytes, ChunkSize);
+
+		Run("Deserialize, whole stream buffered", RecordBytes, [&]()
+		{
+			Reflection::FBinaryReader Reader(Buffer);
+			for (FPayload& Object : Objects)
+			{
+				FPayload Record;
+				Reflection::Deserialize(Record, Reader);
+				Object = std::move(Record);
+			}
+			DoNotOptimize(Objects.data());
+		});
+		Run("DeserializeRecords, chunked", RecordBytes, [&]()
+		{
+			Reflection::FChunkedSource Source;
+			Reflection::TRecordGenerator<FPayload> Records = Reflection::DeserializeRecords<FPayload>(Source);
+			std::size_t Index = 0;
+			for (std::size_t Offset = 0; Offset < Buffer.size(); Offset += ChunkSize)
+			{
+				Source.Push(std::span<const std::uint8_t>(Buffer).subspan(Offset, std::min(ChunkSize, Buffer.size() - Offset)));
+				for (FPayload& Record : Records)
+					Objects[Index++] = std::move(Record);
+			}
+			DoNotOptimize(Objects.data());
+		});
+	}
+
+	void RunBitPacking()
+	{
+		std::vector<FNetFlat> Objects = MakeObjects<FNetFlat>();
+		std::vector<std::uint8_t> Buffer;
+
+		Reflection::FBinaryWriter Writer(Buffer);
+		Reflection::Serialize(Objects[0], Writer);
+		const std::size_t ByteSize = Buffer.size();
+		std::printf("\n-- Network packets (%zu bytes serialized, %d bits packed)\n", ByteSize, Reflection::TBitPackPlan<FNetFlat>::NumBits);
+
+		Run("Serialize", ByteSize, [&]()
+		{
+			Buffer.clear();
+			Reflection::FBinaryWriter Writer(Buffer);
+			for (const FNetFlat& Object : Objects)
+				Reflection::Serialize(Object, Writer);
+			DoNotOptimize(Buffer.data());
+		});
+		Run("SerializeBits", ByteSize, [&]()
+		{
+			Buffer.clear();
+			Reflection::FBitWriter Writer(Buffer);
+			Reflection::SerializeBitsArray<Reflection::EFieldFlags::None, FNetFlat>(Objects, Writer);
+			Writer.Flush();
+			DoNotOptimize(Buffer.data());
+		});
+		std::printf("%-50s %10zu bytes per %zu objects\n", "Packed size", Buffer.size(), Objects.size());
+		Run("DeserializeBits", ByteSize, [&]()
+		{
+			Reflection::FBitReader Reader(Buffer);
+			Reflection::DeserializeBitsArray<Reflection::EFieldFlags::None, FNetFlat>(Objects, Reader);
+			DoNotOptimize(Objects.data());
+		});
+	}
+
+	void RunHotCold()
+	{
+		std::printf("\n-- Hot/cold (%zu bytes, 3 hot doubles)\n", sizeof(FHotCold));
+		std::vector<FHotCold> Objects = MakeObjects<FHotCold>();
+		Rf::TLayoutHotCold<FHotCold> Split;
+		for (const FHotCold& Object : Objects)
+			Split.push_back(Object);
+
+		constexpr auto Layout = Reflection::MakeNamedLayout<FHotCold>();
+		constexpr auto Position = Layout.Get<0>();
+		constexpr auto Velocity = Layout.Get<1>();
+		constexpr auto Acceleration = Layout.Get<66>();
+		constexpr double DeltaTime = 1.0 / 60.0;
+
+		Run("direct integration (AoS)", 3 * sizeof(double), [&]()
+		{
+			for (FHotCold& Object : Objects)
+			{
+				Object.Velocity += Object.Acceleration * DeltaTime;
+				Object.Position += Object.Velocity * DeltaTime;
+			}
+			DoNotOptimize(Objects.data());
+		});
+		Run("TLayoutHotCold integration", 3 * sizeof(double), [&]()
+		{
+			for (std::size_t i = 0; i < Split.size(); ++i)
+			{
+				const auto Element = Split[i];
+				Element.Get(Velocity) += Element.Get(Acceleration) * DeltaTime;
+				Element.Get(Position) += Element.Get(Velocity) * DeltaTime;
+			}
+			DoNotOptimize(Split.GetHotData().data());
+		});
+	}
+
+	void RunCopyPlan()
+	{
+		std::printf("\n-- Snapshot copy (%zu bytes, 3 hot doubles)\n", sizeof(FHotCold));
+		std::vector<FHotCold> Objects = MakeObjects<FHotCold>();
+		std::vector<FHotCold> Snapshots(Objects.size());
+		const Reflection::FLayoutCopyPlan HotPlan = Reflection::MakeCopyPlan<FHotCold>(Reflection::EFieldFlags::Hot);
+
+		Run("CopyTo, whole objects", sizeof(FHotCold), [&]()
+		{
+			for (std::size_t i = 0; i < Objects.size(); ++i)
+				Rf::FLayoutFieldView(Rf::Ref(Objects[i])).CopyTo(Rf::FLayoutFieldView(Rf::Ref(Snapshots[i])));
+			DoNotOptimize(Snapshots.data());
+		});
+		Run("IterateLayoutNamed, hot fields", 3 * sizeof(double), [&]()
+		{
+			for (std::size_t i = 0; i < Objects.size(); ++i)
+			{
+				const Rf::FLayoutFieldView In(Rf::Ref(Objects[i]));
+				const Rf::FLayoutFieldView Out(Rf::Ref(Snapshots[i]));
+				Reflection::IterateLayoutNamed<FHotCold>([&](const auto&, const auto& InField)
+				{
+					if constexpr (Reflection::HasAnyFlags(std::decay_t<decltype(InField)>::Flags, Reflection::EFieldFlags::Hot))
+						Out.Get(InField) = In.Get(InField);
+					return Reflection::EFieldIterator::Enter;
+				});
+			}
+			DoNotOptimize(Snapshots.data());
+		});
+		Run("CopyTo, hot copy plan", 3 * sizeof(double), [&]()
+		{
+			for (std::size_t i = 0; i < Objects.size(); ++i)
+				Rf::FLayoutFieldView(Rf::Ref(Objects[i])).CopyTo(Rf::FLayoutFieldView(Rf::Ref(Snapshots[i])), HotPlan);
+			DoNotOptimize(Snapshots.data());
+		});
+	}
+
+	void RunBlend()
+	{
+		std::printf("\n-- Interpolation (%zu bytes)\n", sizeof(FFlat));
+		const std::vector<FFlat> From = MakeObjects<FFlat>();
+		const std::vector<FFlat> To = MakeObjects<FFlat>();
+		std::vector<FFlat> Results(From.size());
+
+		Run("Hand-written lerp", sizeof(FFlat), [&]()
+		{
+			for (std::size_t i = 0; i < From.size(); ++i)
+			{
+				Results[i].X = From[i].X * 0.75 + To[i].X * 0.25;
+				Results[i].Y = From[i].Y * 0.75 + To[i].Y * 0.25;
+				Results[i].Z = From[i].Z * 0.75 + To[i].Z * 0.25;
+				Results[i].W = static_cast<std::uint32_t>(std::round(From[i].W * 0.75 + To[i].W * 0.25));
+			}
+			DoNotOptimize(Results.data());
+		});
+		Run("Lerp", sizeof(FFlat), [&]()
+		{
+			for (std::size_t i = 0; i < From.size(); ++i)
+				Reflection::Lerp(From[i], To[i], 0.25, Results[i]);
+			DoNotOptimize(Results.data());
+		});
+		Run("LerpBatch", sizeof(FFlat), [&]()
+		{
+			Reflection::LerpBatch<Reflection::EBlendIntegerPolicy::Round, FFlat>(From, To, 0.25, Results);
+			DoNotOptimize(Results.data());
+		});
+
+		std::printf("\n-- Interpolation (%zu bytes, flat doubles)\n", sizeof(FWide));
+		const std::vector<FWide> WideFrom = MakeObjects<FWide>();
+		const std::vector<FWide> WideTo = MakeObjects<FWide>();
+		std::vector<FWide> WideResults(WideFrom.size());
+
+		Run("Lerp", sizeof(FWide), [&]()
+		{
+			for (std::size_t i = 0; i < WideFrom.size(); ++i)
+				Reflection::Lerp(WideFrom[i], WideTo[i], 0.25, WideResults[i]);
+			DoNotOptimize(WideResults.data());
+		});
+		Run("LerpBatch", sizeof(FWide), [&]()
+		{
+			Reflection::LerpBatch<Reflection::EBlendIntegerPolicy::Round, FWide>(WideFrom, WideTo, 0.25, WideResults);
+			DoNotOptimize(WideResults.data());
+		});
+	}
+
+	void RunCompare()
+	{
+		std::printf("\n-- Equality & hashing (%zu bytes, padding free)\n", sizeof(FKey));
+		std::vector<FKey> Keys = MakeObjects<FKey>();
+		for (FKey& Key : Keys)
+			Key.Cell[3] = static_cast<std::int32_t>(Key.Id);
+		const std::vector<FKey> KeyCopies = Keys;
+
+		Run("Hand-written ==", sizeof(FKey), [&]()
+		{
+			std::size_t NumEqual = 0;
+			for (std::size_t i = 0; i < Keys.size(); ++i)
+			{
+				const FKey& A = Keys[i];
+				const FKey& B = KeyCopies[i];
+				NumEqual += A.Id == B.Id && A.Generation == B.Generation && A.Owner == B.Owner && std::equal(A.Cell, A.Cell + 4, B.Cell);
+			}
+			DoNotOptimize(NumEqual);
+		});
+		Run("EqualsLayout (memcmp)", sizeof(FKey), [&]()
+		{
+			std::size_t NumEqual = 0;
+			for (std::size_t i = 0; i < Keys.size(); ++i)
+				NumEqual += Reflection::EqualsLayout(Keys[i], KeyCopies[i]);
+			DoNotOptimize(NumEqual);
+		});
+		Run("CompareLayout", sizeof(FKey), [&]()
+		{
+			std::size_t NumLess = 0;
+			for (std::size_t i = 0; i < Keys.size(); ++i)
+				NumLess += Reflection::CompareLayout(Keys[i], KeyCopies[i]) < 0;
+			DoNotOptimize(NumLess);
+		});
+		Run("HashLayout (single block)", sizeof(FKey), [&]()
+		{
+			std::uint64_t Hash = 0;
+			for (const FKey& Key : Keys)
+				Hash ^= Reflection::HashLayout(Key);
+			DoNotOptimize(Hash);
+		});
+
+		std::printf("\n-- Equality (%zu bytes)\n", sizeof(FFlat));
+		const std::vector<FFlat> Flats = MakeObjects<FFlat>();
+		const std::vector<FFlat> FlatCopies = Flats;
+
+		Run("Hand-written ==", sizeof(FFlat), [&]()
+		{
+			std::size_t NumEqual = 0;
+			for (std::size_t i = 0; i < Flats.size(); ++i)
+			{
+				const FFlat& A = Flats[i];
+				const FFlat& B = FlatCopies[i];
+				NumEqual += A.X == B.X && A.Y == B.Y && A.Z == B.Z && A.W == B.W;
+			}
+			DoNotOptimize(NumEqual);
+		});
+		Run("EqualsLayout", sizeof(FFlat), [&]()
+		{
+			std::size_t NumEqual = 0;
+			for (std::size_t i = 0; i < Flats.size(); ++i)
+				NumEqual += Reflection::EqualsLayout(Flats[i], FlatCopies[i]);
+			DoNotOptimize(NumEqual);
+		});
+
+		std::printf("\n-- Equality (%zu bytes, flat doubles)\n", sizeof(FWide));
+		const std::vector<FWide> Wides = MakeObjects<FWide>();
+		const std::vector<FWide> WideCopies = Wides;
+
+		Run("Scalar == per double", sizeof(FWide), [&]()
+		{
+			std::size_t NumEqual = 0;
+			for (std::size_t i = 0; i < Wides.size(); ++i)
+			{
+				const double* A = &Wides[i].A00;
+				const double* B = &WideCopies[i].A00;
+				NumEqual += std::equal(A, A + sizeof(FWide) / sizeof(double), B);
+			}
+			DoNotOptimize(NumEqual);
+		});
+		Run("EqualsLayout (SIMD run)", sizeof(FWide), [&]()
+		{
+			std::size_t NumEqual = 0;
+			for (std::size_t i = 0; i < Wides.size(); ++i)
+				NumEqual += Reflection::EqualsLayout(Wides[i], WideCopies[i]);
+			DoNotOptimize(NumEqual);
+		});
+	}
+
+	void RunPool()
+	{
+		std::printf("\n-- Allocation churn (%zu bytes)\n", sizeof(FPayload));
+		std::vector<FPayload*> Pointers(NumObjects);
+		std::vector<Rf::FLayoutPoolHandle> Handles;
+		Rf::TLayoutPool<FPayload> Pool;
+		Rf::FLayoutArena Arena;
+
+		Run("new/delete", sizeof(FPayload), [&]()
+		{
+			for (FPayload*& Pointer : Pointers)
+				Pointer = new FPayload();
+			DoNotOptimize(Pointers.data());
+			for (FPayload* Pointer : Pointers)
+				delete Pointer;
+		});
+		Run("TLayoutPool Emplace/Free", sizeof(FPayload), [&]()
+		{
+			Handles.clear();
+			for (std::size_t i = 0; i < NumObjects; ++i)
+				Handles.push_back(Pool.Emplace());
+			DoNotOptimize(Handles.data());
+			Pool.FreeBulk(Handles);
+		});
+		Run("FLayoutArena New/Reset", sizeof(FPayload), [&]()
+		{
+			for (FPayload*& Pointer : Pointers)
+				Pointer = &Arena.New<FPayload>();
+			DoNotOptimize(Pointers.data());
+			Arena.Reset();
+		});
+	}
+
+	void RunParallel()
+	{
+		constexpr std::size_t NumLargeObjects = 1 << 20;
+		std::printf("\n-- Parallel, %zu flat objects, %d workers\n", NumLargeObjects, FWorkStealingPool::Get().GetNumWorkers());
+		std::vector<FFlat> Objects(NumLargeObjects);
+		for (std::size_t i = 0; i < NumLargeObjects; ++i)
+			Objects[i].X = Objects[i].Y = Objects[i].Z = static_cast<double>(i);
+
+		Run("IterateLayoutNamed, sum of doubles", 3 * sizeof(double), [&]()
+		{
+			double Sum = 0.0;
+			for (FFlat& Object : Objects)
+				Sum += SumDoubles(Object);
+			DoNotOptimize(Sum);
+		}, NumLargeObjects);
+		Run("ParallelIterateLayout, sum of doubles", 3 * sizeof(double), [&]()
+		{
+			const double Sum = Reflection::ParallelIterateLayout<const FFlat>(std::span<const FFlat>(Objects), 0.0,
+				[](const auto&, const auto& InField, const Rf::FLayoutFieldConstView& InView, double& OutSum)
+				{
+					using FieldType = typename std::decay_t<decltype(InField)>::Type;
+					if constexpr (std::is_same_v<FieldType, double>)
+						OutSum += InView.Get(InField);
+					return Reflection::EFieldIterator::Enter;
+				},
+				[](double InLHS, double InRHS) { return InLHS + InRHS; });
+			DoNotOptimize(Sum);
+		}, NumLargeObjects);
+	}
+}
+
+int main()
+{
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__OPTIMIZE__)
+	std::printf("Warning: benchmarks built without optimizations\n");
+#elif defined(_MSC_VER) && defined(_DEBUG)
+	std::printf("Warning: benchmarks built in debug\n");
+#endif
+
+	Benchmark::RunFlat();
+	Benchmark::RunDeep();
+	Benchmark::RunWide();
+	Benchmark::RunPayload();
+	Benchmark::RunIncremental();
+	Benchmark::RunBitPacking();
+	Benchmark::RunHotCold();
+	Benchmark::RunCopyPlan();
+	Benchmark::RunBlend();
+	Benchmark::RunCompare();
+	Benchmark::RunPool();
+	Benchmark::RunParallel();
+	return 0;
+}
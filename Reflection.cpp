@@ -9,6 +9,7 @@
 #include "Reflection/LayoutIterator.h"
 #include "Reflection/LayoutView.h"
 #include "Reflection/Layout.h"
+#include "Reflection/LayoutJson.h"
 
 #include <iostream>
 
@@ -96,6 +97,8 @@ namespace Reflection
 		auto Callable = [&FooViewer](const auto& ParentField, const auto& Field) { return FooIterator(ParentField, Field, FooViewer); };
 		Reflection::IterateLayoutNamed<FooStruct>(Callable);
 
+		std::cout << ToJson(Foo) << std::endl;
+
 	}
 }
 
@@ -0,0 +1,159 @@
+/*!
+ *  @file TestAsyncDeserializer.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of incremental deserialization : byte by byte input, truncated & corrupted streams, record generators.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutAsyncDeserializer.h"
+#include "Reflection/LayoutSerializer.h"
+
+#include <cstring>
+#include <limits>
+
+using namespace Test;
+
+namespace
+{
+	std::vector<std::uint8_t> SerializeRecords(std::span<const FRecord> InRecords)
+	{
+		std::vector<std::uint8_t> Buffer;
+		Reflection::FBinaryWriter Writer(Buffer);
+		for (const FRecord& Record : InRecords)
+			Reflection::Serialize(Record, Writer);
+		return Buffer;
+	}
+}
+
+RF_TEST(ByteByByteRoundTrip)
+{
+	const FRecord Source = MakeRecord(11);
+	const std::vector<std::uint8_t> Buffer = SerializeRecords(std::span<const FRecord>(&Source, 1));
+
+	FRecord Result;
+	Reflection::FChunkedSource Input;
+	Reflection::FDeserializeTask Task = Reflection::DeserializeAsync(Result, Input);
+	RF_CHECK(!Task.Resume());
+	for (std::size_t i = 0; i < Buffer.size(); ++i)
+	{
+		RF_REQUIRE(!Task.IsDone());
+		Input.Push(std::span<const std::uint8_t>(Buffer.data() + i, 1));
+		Task.Resume();
+	}
+	RF_REQUIRE(Task.IsDone());
+	RF_CHECK(Task.GetResult());
+	RF_CHECK(HaveSameState(Result, Source));
+	RF_CHECK(Input.GetNumPendingBytes() == 0);
+}
+
+RF_TEST(TruncatedStreamFails)
+{
+	const FRecord Source = MakeRecord(4);
+	const std::vector<std::uint8_t> Buffer = SerializeRecords(std::span<const FRecord>(&Source, 1));
+
+	for (std::size_t Size = 0; Size < Buffer.size(); ++Size)
+	{
+		FRecord Result;
+		Reflection::FChunkedSource Input;
+		Reflection::FDeserializeTask Task = Reflection::DeserializeAsync(Result, Input);
+		Input.Push(std::span<const std::uint8_t>(Buffer.data(), Size));
+		Task.Resume();
+		RF_CHECK(!Task.IsDone());
+
+		Input.Close();
+		RF_CHECK(Task.Resume());
+		RF_CHECK(!Task.GetResult());
+	}
+}
+
+RF_TEST(CorruptedCountDoesNotAllocateAhead)
+{
+	const FRecord Source = MakeRecord(2);
+	std::vector<std::uint8_t> Buffer = SerializeRecords(std::span<const FRecord>(&Source, 1));
+	const std::uint32_t HugeCount = std::numeric_limits<std::uint32_t>::max();
+	const std::size_t CountOffset = sizeof(std::int32_t) + sizeof(FVector) + sizeof(double) + sizeof(std::uint32_t) + Source.Name.size();
+	std::memcpy(Buffer.data() + CountOffset, &HugeCount, sizeof(HugeCount));
+
+	FRecord Result;
+	Reflection::FChunkedSource Input;
+	Reflection::FDeserializeTask Task = Reflection::DeserializeAsync(Result, Input);
+	Input.Push(Buffer);
+	Task.Resume();
+	RF_CHECK(!Task.IsDone());
+	RF_CHECK(Result.Samples.capacity() * sizeof(std::int32_t) <= 2 * Reflection::Details::MaxAsyncReadBlock);
+
+	Input.Close();
+	Task.Resume();
+	RF_CHECK(Task.IsDone() && !Task.GetResult());
+}
+
+RF_TEST(DestroySuspendedTask)
+{
+	const FRecord Source = MakeRecord(9);
+	const std::vector<std::uint8_t> Buffer = SerializeRecords(std::span<const FRecord>(&Source, 1));
+
+	// Suspended inside the nested coroutine reading Samples; destroying the root task must release every frame
+	FRecord Result;
+	Reflection::FChunkedSource Input;
+	{
+		Reflection::FDeserializeTask Task = Reflection::DeserializeAsync(Result, Input);
+		Input.Push(std::span<const std::uint8_t>(Buffer.data(), Buffer.size() - 20));
+		Task.Resume();
+		RF_CHECK(!Task.IsDone());
+	}
+	RF_CHECK(!Input.IsWaiting());
+}
+
+RF_TEST(RecordGenerator)
+{
+	std::vector<FRecord> Sources;
+	for (std::int32_t i = 0; i < 6; ++i)
+		Sources.push_back(MakeRecord(i));
+	const std::vector<std::uint8_t> Buffer = SerializeRecords(Sources);
+
+	Reflection::FChunkedSource Input;
+	Reflection::TRecordGenerator<FRecord> Records = Reflection::DeserializeRecords<FRecord>(Input);
+	std::vector<FRecord> Results;
+
+	// Chunks of uneven sizes, cutting records anywhere
+	std::size_t Offset = 0;
+	for (std::size_t ChunkSize = 1; Offset < Buffer.size(); ChunkSize = ChunkSize * 3 % 37 + 1)
+	{
+		const std::size_t Size = std::min(ChunkSize, Buffer.size() - Offset);
+		Input.Push(std::span<const std::uint8_t>(Buffer.data() + Offset, Size));
+		Offset += Size;
+		for (FRecord& Record : Records)
+			Results.push_back(std::move(Record));
+	}
+	RF_CHECK(!Records.IsDone());
+
+	Input.Close();
+	for (FRecord& Record : Records)
+		Results.push_back(std::move(Record));
+	RF_CHECK(Records.IsDone() && !Records.HasError());
+
+	RF_REQUIRE(Results.size() == Sources.size());
+	for (std::size_t i = 0; i < Sources.size(); ++i)
+		RF_CHECK(HaveSameState(Results[i], Sources[i]));
+}
+
+RF_TEST(RecordGeneratorTruncatedRecord)
+{
+	std::vector<FRecord> Sources = { MakeRecord(1), MakeRecord(2) };
+	const std::vector<std::uint8_t> Buffer = SerializeRecords(Sources);
+
+	Reflection::FChunkedSource Input;
+	Reflection::TRecordGenerator<FRecord> Records = Reflection::DeserializeRecords<FRecord>(Input);
+	Input.Push(std::span<const std::uint8_t>(Buffer.data(), Buffer.size() - 1));
+	Input.Close();
+
+	std::size_t NumRecords = 0;
+	for (FRecord& Record : Records)
+		NumRecords += HaveSameState(Record, Sources[0]);
+	RF_CHECK(NumRecords == 1);
+	RF_CHECK(Records.IsDone() && Records.HasError());
+}
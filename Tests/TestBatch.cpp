@@ -0,0 +1,224 @@
+/*!
+ *  @file TestBatch.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of batch kernels against a scalar reference : every count around the vector widths, contiguous & strided
+ *  fields, NaN values. Also built for AVX & AVX2 when the host runs them, covering every vector & gather path.
+ */
+
+#include "TestHarness.h"
+
+#include "Reflection/LayoutBatch.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <typeinfo>
+#include <vector>
+
+namespace
+{
+	/** Leaves of every batch type, 24 bytes apart */
+	struct FSample
+	{
+		std::uint16_t Small = 0;
+		float F = 0.f;
+		double D = 0.0;
+		std::int32_t I = 0;
+	};
+
+	/** Widest vector is 8 floats : counts of 0 to 2 * 8 + 1 cover empty batches, whole vectors & every tail */
+	constexpr std::size_t MaxNum = 2 * 8 + 1;
+
+	template<class T>
+	constexpr auto GetSampleField()
+	{
+		if constexpr (std::is_same_v<T, std::uint16_t>)
+			return Reflection::MakeField<T, offsetof(FSample, Small)>();
+		else if constexpr (std::is_same_v<T, float>)
+			return Reflection::MakeField<T, offsetof(FSample, F)>();
+		else if constexpr (std::is_same_v<T, double>)
+			return Reflection::MakeField<T, offsetof(FSample, D)>();
+		else
+			return Reflection::MakeField<T, offsetof(FSample, I)>();
+	}
+
+	template<class T>
+	T& GetSampleValue(FSample& InSample)
+	{
+		return *reinterpret_cast<T*>(reinterpret_cast<std::uint8_t*>(&InSample) + decltype(GetSampleField<T>())::MemberOffset);
+	}
+
+	/** Values summing exactly in any order : halves for floating point types */
+	template<class T>
+	T MakeValue(std::size_t InIndex)
+	{
+		const int Value = static_cast<int>(InIndex * 7 % 11);
+		if constexpr (std::is_floating_point_v<T>)
+			return static_cast<T>(Value - 5) * T(0.5);
+		else if constexpr (std::is_signed_v<T>)
+			return static_cast<T>(Value - 5);
+		else
+			return static_cast<T>(Value);
+	}
+
+	/** Values of the leaves a kernel doesn't process */
+	FSample MakeBackground()
+	{
+		return FSample{ 1, 2.f, 3.0, 4 };
+	}
+
+	template<class T>
+	std::vector<FSample> MakeSamples(const std::vector<T>& InValues)
+	{
+		std::vector<FSample> Samples(InValues.size());
+		for (std::size_t i = 0; i < InValues.size(); ++i)
+		{
+			Samples[i] = MakeBackground();
+			GetSampleValue<T>(Samples[i]) = InValues[i];
+		}
+		return Samples;
+	}
+
+	template<class T>
+	Reflection::TMinMax<T> ReferenceMinMax(const std::vector<T>& InValues)
+	{
+		Reflection::TMinMax<T> Result;
+		for (const T Value : InValues)
+		{
+			if (Value == Value)
+			{
+				Result.Min = std::min(Result.Min, Value);
+				Result.Max = std::max(Result.Max, Value);
+			}
+		}
+		return Result;
+	}
+
+	/** Equal, or both NaN */
+	template<class T>
+	bool IsSame(T InA, T InB)
+	{
+		return InA == InB || (InA != InA && InB != InB);
+	}
+
+	/** Check a map kernel over contiguous & strided values against its scalar reference; other leaves stay untouched */
+	template<class T, class batch_t, class batch_field_t, class reference_t>
+	bool CheckMap(const std::vector<T>& InValues, batch_t&& InBatch, batch_field_t&& InBatchField, reference_t&& InReference)
+	{
+		std::vector<T> Values = InValues;
+		InBatch(std::span<T>(Values));
+		std::vector<FSample> Samples = MakeSamples(InValues);
+		InBatchField(std::span<FSample>(Samples));
+
+		bool bResult = true;
+		for (std::size_t i = 0; i < InValues.size(); ++i)
+		{
+			const T Expected = InReference(InValues[i]);
+			FSample Background = MakeBackground();
+			FSample Untouched = Samples[i];
+			GetSampleValue<T>(Untouched) = GetSampleValue<T>(Background);
+			bResult = bResult && IsSame(Values[i], Expected) && IsSame(GetSampleValue<T>(Samples[i]), Expected);
+			bResult = bResult && Untouched.Small == Background.Small && Untouched.F == Background.F && Untouched.D == Background.D && Untouched.I == Background.I;
+		}
+		return bResult;
+	}
+
+	template<class T>
+	void CheckKernels(const std::vector<T>& InValues)
+	{
+		constexpr auto Field = GetSampleField<T>();
+		const std::vector<FSample> Samples = MakeSamples(InValues);
+		const std::span<const T> Values(InValues);
+		const std::span<const FSample> Objects(Samples);
+
+		using SumType = Reflection::TBatchSumType<T>;
+		SumType ExpectedSum = 0;
+		for (const T Value : InValues)
+			ExpectedSum += Value;
+		const bool bSum = RF_CHECK(IsSame(Reflection::Sum(Values), ExpectedSum) && IsSame(Reflection::Sum(Objects, Field), ExpectedSum));
+
+		const Reflection::TMinMax<T> Expected = ReferenceMinMax(InValues);
+		const Reflection::TMinMax<T> Contiguous = Reflection::MinMax(Values);
+		const Reflection::TMinMax<T> Strided = Reflection::MinMax(Objects, Field);
+		const bool bMinMax = RF_CHECK(Contiguous.Min == Expected.Min && Contiguous.Max == Expected.Max && Strided.Min == Expected.Min && Strided.Max == Expected.Max);
+
+		const T Factor = std::is_floating_point_v<T> ? T(0.5) : T(3);
+		const T Offset = std::is_floating_point_v<T> ? T(1.25) : T(2);
+		const T Low = std::is_signed_v<T> ? T(-2) : T(1);
+		const T High = T(3);
+		const bool bMaps = RF_CHECK(CheckMap(InValues,
+				[Factor](std::span<T> InOut) { Reflection::Scale(InOut, Factor); },
+				[Factor, Field](std::span<FSample> InOut) { Reflection::Scale(InOut, Field, Factor); },
+				[Factor](T InValue) { return static_cast<T>(InValue * Factor); }))
+			&& RF_CHECK(CheckMap(InValues,
+				[Offset](std::span<T> InOut) { Reflection::AddConstant(InOut, Offset); },
+				[Offset, Field](std::span<FSample> InOut) { Reflection::AddConstant(InOut, Field, Offset); },
+				[Offset](T InValue) { return static_cast<T>(InValue + Offset); }))
+			&& RF_CHECK(CheckMap(InValues,
+				[Low, High](std::span<T> InOut) { Reflection::Clamp(InOut, Low, High); },
+				[Low, High, Field](std::span<FSample> InOut) { Reflection::Clamp(InOut, Field, Low, High); },
+				[Low, High](T InValue) { return InValue != InValue ? InValue : std::clamp(InValue, Low, High); }));
+
+		if (!bSum || !bMinMax || !bMaps)
+			std::printf("  %s, %zu values\n", typeid(T).name(), InValues.size());
+	}
+
+	template<class T>
+	void CheckAllCounts()
+	{
+		for (std::size_t Num = 0; Num <= MaxNum; ++Num)
+		{
+			std::vector<T> Values(Num);
+			for (std::size_t i = 0; i < Num; ++i)
+				Values[i] = MakeValue<T>(i);
+			CheckKernels(Values);
+		}
+	}
+
+	template<class T>
+	void CheckNaNAtEveryPosition()
+	{
+		constexpr T NaN = std::numeric_limits<T>::quiet_NaN();
+		for (std::size_t Num = 1; Num <= MaxNum; ++Num)
+		{
+			for (std::size_t Position = 0; Position < Num; ++Position)
+			{
+				std::vector<T> Values(Num);
+				for (std::size_t i = 0; i < Num; ++i)
+					Values[i] = i == Position ? NaN : MakeValue<T>(i);
+				CheckKernels(Values);
+			}
+
+			// Only NaN, as if empty
+			const std::vector<T> Values(Num, NaN);
+			const Reflection::TMinMax<T> Result = Reflection::MinMax(std::span<const T>(Values));
+			RF_CHECK(Result.Min == std::numeric_limits<T>::max() && Result.Max == std::numeric_limits<T>::lowest());
+		}
+	}
+}
+
+RF_TEST(FloatKernels)
+{
+	CheckAllCounts<float>();
+}
+
+RF_TEST(DoubleKernels)
+{
+	CheckAllCounts<double>();
+}
+
+RF_TEST(IntegerKernels)
+{
+	CheckAllCounts<std::int32_t>();
+	CheckAllCounts<std::uint16_t>();
+}
+
+RF_TEST(NaNValues)
+{
+	// Skipped by MinMax & kept by Clamp wherever they sit : vector lanes, reductions or scalar tail
+	CheckNaNAtEveryPosition<float>();
+	CheckNaNAtEveryPosition<double>();
+}
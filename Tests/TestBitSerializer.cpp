@@ -0,0 +1,194 @@
+/*!
+ *  @file TestBitSerializer.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of the bit-packed serializer : quantized round trips, wide integer ranges, flag filters, truncated input.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutBitSerializer.h"
+
+#include <cmath>
+
+using namespace Test;
+
+namespace
+{
+	enum class EState : std::uint16_t { Off, On, Broken = 1000 };
+
+	struct FPacket
+	{
+		float X = 0.f;
+		double Y = 0.0;
+		std::int32_t Health = 0;
+		std::int64_t Tick = 0;
+		std::uint8_t Raw = 0;
+		bool bAlive = false;
+		EState State = EState::Off;
+		std::int32_t Cache = 0;
+		std::uint32_t Local = 0;
+	};
+
+	/** Range minimum not representable as a float (2^24 + 1) */
+	constexpr std::int64_t TickMin = 16777217;
+
+	FPacket MakePacket(int InSeed)
+	{
+		FPacket Packet;
+		Packet.X = -100.f + 0.37f * InSeed;
+		Packet.Y = 0.001 * InSeed;
+		Packet.Health = -50 + InSeed;
+		Packet.Tick = TickMin + InSeed;
+		Packet.Raw = static_cast<std::uint8_t>(InSeed * 7);
+		Packet.bAlive = InSeed % 2 == 0;
+		Packet.State = InSeed % 3 == 0 ? EState::Broken : EState::On;
+		Packet.Cache = InSeed;
+		Packet.Local = static_cast<std::uint32_t>(InSeed) * 1000u;
+		return Packet;
+	}
+}
+
+RF_BEGIN_LAYOUT(FPacket)
+	RF_TAGGED_ENTRY(X, Reflection::Replicated, Reflection::FQuantize::FromPrecision(-128.0, 128.0, 0.01)),
+	RF_TAGGED_ENTRY(Y, Reflection::Replicated, Reflection::FQuantize{ 0.0, 1.0, 20 }),
+	RF_TAGGED_ENTRY(Health, Reflection::Replicated, Reflection::FQuantize{ -100.0, 155.0, 8 }),
+	RF_TAGGED_ENTRY(Tick, Reflection::Replicated, Reflection::FQuantize{ static_cast<double>(TickMin), static_cast<double>(TickMin + 1023), 10 }),
+	RF_TAGGED_ENTRY(Raw, Reflection::Replicated),
+	RF_TAGGED_ENTRY(bAlive, Reflection::Replicated),
+	RF_TAGGED_ENTRY(State, Reflection::Replicated),
+	RF_TAGGED_ENTRY(Cache, Reflection::Transient),
+	RF_ENTRY(Local)
+RF_END_LAYOUT()
+
+RF_TEST(QuantizedRoundTrip)
+{
+	using PlanType = Reflection::TBitPackPlan<FPacket>;
+	static_assert(PlanType::NumBits == 15 + 20 + 8 + 10 + 8 + 1 + 16 + 32);
+
+	std::vector<std::uint8_t> Buffer;
+	Reflection::FBitWriter Writer(Buffer);
+	for (int i = 0; i < 50; ++i)
+		Reflection::SerializeBits(MakePacket(i), Writer);
+	Writer.Flush();
+	RF_CHECK(Buffer.size() == (50 * PlanType::NumBits + 7) / 8);
+
+	Reflection::FBitReader Reader(Buffer);
+	for (int i = 0; i < 50; ++i)
+	{
+		const FPacket Source = MakePacket(i);
+		FPacket Result;
+		Result.Cache = -1;
+		RF_REQUIRE(Reflection::DeserializeBits(Result, Reader));
+		RF_CHECK(std::abs(Result.X - Source.X) <= 0.01f);
+		RF_CHECK(std::abs(Result.Y - Source.Y) <= 1.0 / ((1 << 20) - 1));
+		RF_CHECK(Result.Health == Source.Health && Result.Raw == Source.Raw && Result.bAlive == Source.bAlive);
+		RF_CHECK(Result.State == Source.State && Result.Local == Source.Local);
+		RF_CHECK(Result.Cache == -1);
+		// Exact, the range bounds aren't rounded to floats
+		RF_CHECK(Result.Tick == Source.Tick);
+	}
+	RF_CHECK(!Reader.HasError());
+}
+
+RF_TEST(OutOfRangeValuesAreClamped)
+{
+	FPacket Source = MakePacket(1);
+	Source.X = 1000.f;
+	Source.Y = std::nan("");
+	Source.Health = 1000;
+	Source.Tick = 0;
+
+	std::vector<std::uint8_t> Buffer;
+	Reflection::FBitWriter Writer(Buffer);
+	Reflection::SerializeBits(Source, Writer);
+	Writer.Flush();
+
+	FPacket Result;
+	Reflection::FBitReader Reader(Buffer);
+	RF_REQUIRE(Reflection::DeserializeBits(Result, Reader));
+	RF_CHECK(Result.X == 128.f && Result.Y == 0.0 && Result.Health == 155 && Result.Tick == TickMin);
+}
+
+RF_TEST(ReplicatedOnly)
+{
+	using PlanType = Reflection::TBitPackPlan<FPacket, Reflection::EFieldFlags::Replicated>;
+	static_assert(PlanType::NumBits == Reflection::TBitPackPlan<FPacket>::NumBits - 32);
+
+	const FPacket Source = MakePacket(4);
+	std::vector<std::uint8_t> Buffer;
+	Reflection::FBitWriter Writer(Buffer);
+	Reflection::SerializeBits<Reflection::EFieldFlags::Replicated>(Source, Writer);
+	Writer.Flush();
+
+	FPacket Result;
+	Result.Local = 77;
+	Reflection::FBitReader Reader(Buffer);
+	RF_REQUIRE(Reflection::DeserializeBits<Reflection::EFieldFlags::Replicated>(Result, Reader));
+	RF_CHECK(Result.Health == Source.Health && Result.Tick == Source.Tick && Result.Local == 77);
+}
+
+RF_TEST(TruncatedInputFails)
+{
+	std::vector<FPacket> Sources;
+	for (int i = 0; i < 3; ++i)
+		Sources.push_back(MakePacket(i));
+	std::vector<std::uint8_t> Buffer;
+	Reflection::FBitWriter Writer(Buffer);
+	Reflection::SerializeBitsArray(std::span<const FPacket>(Sources), Writer);
+	Writer.Flush();
+
+	for (std::size_t Size = 0; Size < Buffer.size(); ++Size)
+	{
+		std::vector<FPacket> Results(Sources.size());
+		for (FPacket& Result : Results)
+			Result.Health = 12345;
+		Reflection::FBitReader Reader(std::span<const std::uint8_t>(Buffer.data(), Size));
+		RF_CHECK(!Reflection::DeserializeBitsArray(std::span<FPacket>(Results), Reader));
+		RF_CHECK(Results[0].Health == 12345);
+	}
+
+	// Whole objects before the cut are read, the cut one fails
+	const std::size_t Size = (Reflection::TBitPackPlan<FPacket>::NumBits + 7) / 8;
+	Reflection::FBitReader Reader(std::span<const std::uint8_t>(Buffer.data(), Size));
+	FPacket Result;
+	RF_CHECK(Reflection::DeserializeBits(Result, Reader) && Result.Tick == Sources[0].Tick);
+	RF_CHECK(!Reflection::DeserializeBits(Result, Reader));
+}
+
+RF_TEST(ReaderPastEndSetsError)
+{
+	const std::uint8_t Bytes[3] = { 0xff, 0x01, 0x80 };
+	Reflection::FBitReader Reader(Bytes);
+	RF_CHECK(Reader.ReadBits(9) == 0x1ff && !Reader.HasError());
+	RF_CHECK(Reader.ReadBits(15) == 0x4000);
+	RF_CHECK(Reader.GetRemainingBits() == 0);
+	RF_CHECK(Reader.ReadBits(1) == 0 && Reader.HasError());
+}
+
+RF_TEST(ReadsAcrossRefills)
+{
+	// Every buffer size around the word loads, reads of every width, against a bit at a time reference
+	for (std::size_t Size = 0; Size <= 24; ++Size)
+	{
+		std::vector<std::uint8_t> Bytes(Size);
+		for (std::size_t i = 0; i < Size; ++i)
+			Bytes[i] = static_cast<std::uint8_t>(i * 37 + 11);
+
+		for (int First = 1; First <= 64; ++First)
+		{
+			Reflection::FBitReader Reader(Bytes);
+			std::size_t Position = 0;
+			for (int Bits = First; Position + Bits <= Size * 8; Bits = Bits % 64 + 1)
+			{
+				std::uint64_t Expected = 0;
+				for (int i = 0; i < Bits; ++i, ++Position)
+					Expected |= std::uint64_t((Bytes[Position / 8] >> (Position % 8)) & 1) << i;
+				RF_REQUIRE(Reader.ReadBits(Bits) == Expected);
+			}
+			RF_CHECK(!Reader.HasError() && Reader.GetRemainingBits() == Size * 8 - Position);
+		}
+	}
+}
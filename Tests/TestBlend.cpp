@@ -0,0 +1,185 @@
+/*!
+ *  @file TestBlend.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of interpolation : integer policies, dominant & NoBlend leaves, static & dynamic state counts, batches, mismatched sizes.
+ *  Also built with full optimizations, where aliasing bugs in state access show up.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutBlend.h"
+
+#include <cmath>
+
+using namespace Test;
+
+namespace
+{
+	enum class EMode : std::uint8_t { Idle, Walk, Run };
+
+	struct FPose
+	{
+		double Weight = 0.0;
+		FVector Position;
+		std::int32_t Count = 0;
+		std::uint8_t Level = 0;
+		bool bVisible = false;
+		EMode Mode = EMode::Idle;
+		std::int32_t Id = 0;
+	};
+
+	FPose MakePose(double InScale, EMode InMode)
+	{
+		FPose Pose;
+		Pose.Weight = 10.0 * InScale;
+		Pose.Position = FVector{ 1.f * static_cast<float>(InScale), -2.f * static_cast<float>(InScale), 4.f * static_cast<float>(InScale) };
+		Pose.Count = static_cast<std::int32_t>(100 * InScale);
+		Pose.Level = static_cast<std::uint8_t>(250 * InScale);
+		Pose.bVisible = InScale > 0.5;
+		Pose.Mode = InMode;
+		Pose.Id = static_cast<std::int32_t>(InScale * 1000);
+		return Pose;
+	}
+
+	bool IsNear(double InA, double InB)
+	{
+		return std::abs(InA - InB) <= 1e-5 * std::max(1.0, std::abs(InB));
+	}
+}
+
+RF_BEGIN_LAYOUT(FPose)
+	RF_ENTRY(Weight),
+	RF_ENTRY(Position),
+	RF_ENTRY(Count),
+	RF_ENTRY(Level),
+	RF_ENTRY(bVisible),
+	RF_ENTRY(Mode),
+	RF_TAGGED_ENTRY(Id, Reflection::NoBlend)
+RF_END_LAYOUT()
+
+RF_TEST(LerpLeaves)
+{
+	const FPose A = MakePose(0.0, EMode::Idle);
+	const FPose B = MakePose(1.0, EMode::Run);
+
+	const FPose Result = Reflection::Lerp(A, B, 0.75);
+	RF_CHECK(IsNear(Result.Weight, 7.5));
+	RF_CHECK(IsNear(Result.Position.X, 0.75) && IsNear(Result.Position.Y, -1.5) && IsNear(Result.Position.Z, 3.0));
+	RF_CHECK(Result.Count == 75 && Result.Level == 188);
+	RF_CHECK(Result.bVisible && Result.Mode == EMode::Run);
+	RF_CHECK(Result.Id == A.Id);
+
+	const FPose Stepped = Reflection::Lerp<Reflection::EBlendIntegerPolicy::Step>(A, B, 0.25);
+	RF_CHECK(Stepped.Count == A.Count && Stepped.Level == A.Level && Stepped.Mode == EMode::Idle && IsNear(Stepped.Weight, 2.5));
+
+	const FPose Kept = Reflection::Lerp<Reflection::EBlendIntegerPolicy::Keep>(A, B, 0.9);
+	RF_CHECK(Kept.Count == A.Count && Kept.Mode == EMode::Run);
+}
+
+RF_TEST(LerpInPlace)
+{
+	FPose A = MakePose(0.2, EMode::Walk);
+	const FPose B = MakePose(0.6, EMode::Run);
+	Reflection::Lerp(A, B, 0.5, A);
+	RF_CHECK(IsNear(A.Weight, 4.0) && A.Count == 40 && A.Id == 200);
+}
+
+RF_TEST(IntegerRoundingClamps)
+{
+	FPose A;
+	FPose B;
+	A.Level = 250;
+	B.Level = 255;
+	// Weights summing past 1 would overflow without clamping
+	const FPose* States[2] = { &A, &B };
+	const double Weights[2] = { 0.9, 0.9 };
+	FPose Result;
+	Reflection::Blend<Reflection::EBlendIntegerPolicy::Round, FPose, 2>(States, Weights, Result);
+	RF_CHECK(Result.Level == 255);
+}
+
+RF_TEST(BlendStaticAndDynamicStates)
+{
+	const FPose Poses[3] = { MakePose(0.0, EMode::Idle), MakePose(0.5, EMode::Walk), MakePose(1.0, EMode::Run) };
+	const FPose* States[3] = { &Poses[0], &Poses[1], &Poses[2] };
+	const double Weights[3] = { 0.2, 0.5, 0.3 };
+
+	FPose Static;
+	Reflection::Blend<Reflection::EBlendIntegerPolicy::Round, FPose, 3>(States, Weights, Static);
+	FPose Dynamic;
+	Reflection::Blend<Reflection::EBlendIntegerPolicy::Round, FPose>(std::span<const FPose* const>(States), std::span<const double>(Weights), Dynamic);
+
+	for (const FPose& Result : { Static, Dynamic })
+	{
+		RF_CHECK(IsNear(Result.Weight, 5.5));
+		RF_CHECK(IsNear(Result.Position.Z, 2.2));
+		RF_CHECK(Result.Count == 55 && Result.Mode == EMode::Walk && Result.Id == Poses[0].Id);
+	}
+}
+
+RF_TEST(BatchesMatchSingleObjects)
+{
+	std::vector<FPose> A;
+	std::vector<FPose> B;
+	std::vector<FFlat> FlatA;
+	std::vector<FFlat> FlatB;
+	for (int i = 0; i < 37; ++i)
+	{
+		A.push_back(MakePose(i / 37.0, EMode::Walk));
+		B.push_back(MakePose(1.0 - i / 37.0, EMode::Run));
+		FlatA.push_back(FFlat{ double(i), -double(i), 0.5 * i, std::uint32_t(i) });
+		FlatB.push_back(FFlat{ 2.0 * i, double(i), 1.5 * i, std::uint32_t(3 * i) });
+	}
+
+	std::vector<FPose> Results(A.size());
+	Reflection::LerpBatch(std::span<const FPose>(A), std::span<const FPose>(B), 0.3, std::span<FPose>(Results));
+	std::vector<FFlat> FlatResults(FlatA.size());
+	Reflection::LerpBatch(std::span<const FFlat>(FlatA), std::span<const FFlat>(FlatB), 0.3, std::span<FFlat>(FlatResults));
+
+	for (std::size_t i = 0; i < A.size(); ++i)
+	{
+		const FPose Expected = Reflection::Lerp(A[i], B[i], 0.3);
+		RF_CHECK(IsNear(Results[i].Weight, Expected.Weight) && IsNear(Results[i].Position.Y, Expected.Position.Y));
+		RF_CHECK(Results[i].Count == Expected.Count && Results[i].Mode == Expected.Mode && Results[i].Id == Expected.Id);
+
+		const FFlat ExpectedFlat = Reflection::Lerp(FlatA[i], FlatB[i], 0.3);
+		RF_CHECK(IsNear(FlatResults[i].X, ExpectedFlat.X) && IsNear(FlatResults[i].Z, ExpectedFlat.Z) && FlatResults[i].W == ExpectedFlat.W);
+	}
+}
+
+RF_TEST(RejectsMismatchedSizes)
+{
+	const FPose Poses[3] = { MakePose(0.0, EMode::Idle), MakePose(0.5, EMode::Walk), MakePose(1.0, EMode::Run) };
+	const FPose* States[3] = { &Poses[0], &Poses[1], &Poses[2] };
+	const double Weights[3] = { 0.2, 0.5, 0.3 };
+
+	// No states, or not one weight per state: the result is left untouched
+	FPose Result = MakePose(0.25, EMode::Walk);
+	RF_CHECK((!Reflection::Blend<Reflection::EBlendIntegerPolicy::Round, FPose>(std::span<const FPose* const>(), std::span<const double>(), Result)));
+	RF_CHECK((!Reflection::Blend<Reflection::EBlendIntegerPolicy::Round, FPose>(std::span<const FPose* const>(States), std::span<const double>(Weights, 2), Result)));
+	RF_CHECK(Result.Count == 25 && Result.Mode == EMode::Walk);
+	RF_CHECK((Reflection::Blend<Reflection::EBlendIntegerPolicy::Round, FPose, 3>(States, Weights, Result) && Result.Count == 55));
+
+	// Batches, field by field & flat
+	const std::vector<FPose> A(8, Poses[0]);
+	const std::vector<FPose> Short(7, Poses[2]);
+	const std::vector<FFlat> FlatA(8, FFlat{ 1.0, 2.0, 3.0, 4 });
+	const std::vector<FFlat> FlatLong(9, FFlat{ 5.0, 6.0, 7.0, 8 });
+	std::vector<FPose> Results(8, Poses[1]);
+	std::vector<FFlat> FlatResults(8);
+	RF_CHECK(!Reflection::LerpBatch(std::span<const FPose>(A), std::span<const FPose>(Short), 0.5, std::span<FPose>(Results)));
+	RF_CHECK(!Reflection::LerpBatch(std::span<const FFlat>(FlatA), std::span<const FFlat>(FlatLong), 0.5, std::span<FFlat>(FlatResults)));
+	RF_CHECK(!Reflection::LerpBatch(std::span<const FFlat>(FlatA), std::span<const FFlat>(FlatA), 0.5, std::span<FFlat>(FlatResults).first(4)));
+	RF_CHECK(Results.back().Count == Poses[1].Count && FlatResults.back().X == 0.0);
+
+	const std::span<const FPose> BatchStates[2] = { A, A };
+	RF_CHECK((!Reflection::BlendBatch<Reflection::EBlendIntegerPolicy::Round, FPose>(std::span<const std::span<const FPose>>(), std::span<const double>(), std::span<FPose>(Results))));
+	RF_CHECK((!Reflection::BlendBatch<Reflection::EBlendIntegerPolicy::Round, FPose>(std::span<const std::span<const FPose>>(BatchStates), std::span<const double>(Weights), std::span<FPose>(Results))));
+	RF_CHECK(Results.back().Count == Poses[1].Count);
+
+	RF_CHECK(Reflection::LerpBatch(std::span<const FPose>(A), std::span<const FPose>(A), 0.5, std::span<FPose>(Results)) && Results.back().Count == 0);
+	RF_CHECK(Reflection::LerpBatch(std::span<const FFlat>(), std::span<const FFlat>(), 0.5, std::span<FFlat>()));
+}
@@ -0,0 +1,153 @@
+/*!
+ *  @file TestCompare.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of equality, ordering & hashing : bytewise comparable shapes, views compared by content, leaves & elements with their own operator==.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutCompare.h"
+#include "Reflection/LayoutHash.h"
+
+#include <compare>
+#include <span>
+#include <vector>
+
+using namespace Test;
+
+namespace
+{
+	enum class EColor : std::uint8_t { Red, Green };
+
+	/** Padding free, integer, enum & pointer leaves */
+	struct FKey
+	{
+		std::int32_t Id = 0;
+		EColor Color = EColor::Red;
+		std::uint8_t Flags[3] = {};
+		const FKey* Parent = nullptr;
+	};
+
+	/** Equal whatever its cached value */
+	struct FCached
+	{
+		std::int32_t Value = 0;
+		std::int32_t Cache = 0;
+
+		bool operator==(const FCached& InOther) const { return Value == InOther.Value; }
+		std::partial_ordering operator<=>(const FCached& InOther) const { return Value <=> InOther.Value; }
+	};
+
+	struct FSlice
+	{
+		std::span<const std::int32_t> Values;
+		FCached Cached;
+	};
+
+	/** Elements compared with their own operator== */
+	struct FHolder
+	{
+		FCached Array[2];
+		std::vector<FCached> Vector;
+	};
+
+	struct FPoint
+	{
+		float X = 0.f;
+		std::int32_t Y = 0;
+	};
+}
+
+template<>
+struct std::hash<FCached>
+{
+	std::size_t operator()(const FCached& InCached) const { return std::hash<std::int32_t>{}(InCached.Value); }
+};
+
+RF_BEGIN_LAYOUT(FKey)
+	RF_ENTRY(Id),
+	RF_ENTRY(Color),
+	RF_ENTRY(Flags),
+	RF_ENTRY(Parent)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FSlice)
+	RF_ENTRY(Values),
+	RF_ENTRY(Cached)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FHolder)
+	RF_ENTRY(Array),
+	RF_ENTRY(Vector)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FPoint)
+	RF_ENTRY(X),
+	RF_ENTRY(Y)
+RF_END_LAYOUT()
+
+static_assert(Reflection::TIsBytewiseComparable<FKey>::Value);
+static_assert(!Reflection::TIsBytewiseComparable<FSlice>::Value);
+static_assert(!Reflection::TIsBytewiseComparable<FCached>::Value);
+static_assert(!Reflection::TIsBytewiseComparable<std::span<const std::int32_t>>::Value);
+static_assert(!Reflection::TIsBytewiseComparable<FPoint>::Value);
+static_assert(!Reflection::TIsBytewiseComparable<FFlat>::Value);
+
+RF_TEST(BytewiseComparable)
+{
+	const FKey Parent{ 1, EColor::Green, { 1, 2, 3 }, nullptr };
+	const FKey A{ 2, EColor::Red, { 4, 5, 6 }, &Parent };
+	FKey B = A;
+	RF_CHECK(Reflection::EqualsLayout(A, B) && Reflection::HashLayout(A) == Reflection::HashLayout(B));
+	B.Flags[2] = 7;
+	RF_CHECK(!Reflection::EqualsLayout(A, B) && Reflection::CompareLayout(A, B) == std::partial_ordering::less);
+}
+
+RF_TEST(ViewsCompareByContent)
+{
+	const std::int32_t First[3] = { 1, 2, 3 };
+	const std::int32_t Second[3] = { 1, 2, 3 };
+	const std::int32_t Third[3] = { 1, 2, 4 };
+
+	const FSlice A{ First, FCached{ 5, 1 } };
+	const FSlice B{ Second, FCached{ 5, 2 } };
+	RF_CHECK(Reflection::EqualsLayout(A, B));
+	RF_CHECK(Reflection::CompareLayout(A, B) == std::partial_ordering::equivalent);
+	RF_CHECK(Reflection::HashLayout(A) == Reflection::HashLayout(B));
+
+	const FSlice C{ Third, FCached{ 5, 1 } };
+	RF_CHECK(!Reflection::EqualsLayout(A, C) && Reflection::CompareLayout(A, C) == std::partial_ordering::less);
+
+	const FSlice D{ std::span<const std::int32_t>(First, 2), FCached{ 5, 1 } };
+	RF_CHECK(!Reflection::EqualsLayout(A, D) && Reflection::CompareLayout(D, A) == std::partial_ordering::less);
+
+	const FSlice E{ First, FCached{ 6, 1 } };
+	RF_CHECK(!Reflection::EqualsLayout(A, E));
+}
+
+RF_TEST(EqualElementsHashEqual)
+{
+	// Same values, other cached bytes
+	const FHolder A{ { FCached{ 1, 10 }, FCached{ 2, 20 } }, { FCached{ 3, 30 }, FCached{ 4, 40 } } };
+	const FHolder B{ { FCached{ 1, 11 }, FCached{ 2, 21 } }, { FCached{ 3, 31 }, FCached{ 4, 41 } } };
+	RF_CHECK(Reflection::EqualsLayout(A, B));
+	RF_CHECK(Reflection::HashLayout(A) == Reflection::HashLayout(B));
+
+	FHolder C = B;
+	C.Vector[1].Value = 5;
+	RF_CHECK(!Reflection::EqualsLayout(A, C) && Reflection::HashLayout(A) != Reflection::HashLayout(C));
+	C = B;
+	C.Array[0].Value = 5;
+	RF_CHECK(!Reflection::EqualsLayout(A, C) && Reflection::HashLayout(A) != Reflection::HashLayout(C));
+}
+
+RF_TEST(FloatZerosAreEqual)
+{
+	const FPoint A{ 0.f, 3 };
+	const FPoint B{ -0.f, 3 };
+	RF_CHECK(Reflection::EqualsLayout(A, B) && Reflection::HashLayout(A) == Reflection::HashLayout(B));
+	RF_CHECK(Reflection::CompareLayout(A, B) == std::partial_ordering::equivalent);
+}
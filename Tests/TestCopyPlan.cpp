@@ -0,0 +1,154 @@
+/*!
+ *  @file TestCopyPlan.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of copy plans : selection by flags, names & fields, ranges of every size, unselected fields left untouched.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutCopyPlan.h"
+#include "Reflection/LayoutIterator.h"
+#include "Reflection/LayoutLookup.h"
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+using namespace Test;
+
+namespace
+{
+	/** Ranges of 1 to 80 bytes, remainders of every size, a non-blittable leaf & a transient one */
+	struct FMixed
+	{
+		std::uint8_t A = 0;
+		std::uint8_t B = 0;
+		std::uint16_t C = 0;
+		std::int32_t D = 0;
+		double E[5] = {};
+		char F[7] = {};
+		std::string Name;
+		std::int64_t Big[10] = {};
+		std::int32_t Cache = 0;
+	};
+
+	FMixed MakeMixed(std::int32_t InSeed)
+	{
+		FMixed Mixed;
+		Mixed.A = static_cast<std::uint8_t>(InSeed);
+		Mixed.B = static_cast<std::uint8_t>(InSeed + 1);
+		Mixed.C = static_cast<std::uint16_t>(InSeed * 3);
+		Mixed.D = -InSeed;
+		for (int i = 0; i < 5; ++i)
+			Mixed.E[i] = InSeed + 0.25 * i;
+		for (int i = 0; i < 7; ++i)
+			Mixed.F[i] = static_cast<char>('a' + (InSeed + i) % 26);
+		Mixed.Name = "Mixed " + std::to_string(InSeed);
+		for (int i = 0; i < 10; ++i)
+			Mixed.Big[i] = static_cast<std::int64_t>(InSeed) << (i * 3);
+		Mixed.Cache = InSeed * 7;
+		return Mixed;
+	}
+
+	bool HaveSameState(const FMixed& InA, const FMixed& InB)
+	{
+		return InA.A == InB.A && InA.B == InB.B && InA.C == InB.C && InA.D == InB.D && std::memcmp(InA.E, InB.E, sizeof(InA.E)) == 0
+			&& std::memcmp(InA.F, InB.F, sizeof(InA.F)) == 0 && InA.Name == InB.Name && std::memcmp(InA.Big, InB.Big, sizeof(InA.Big)) == 0;
+	}
+
+	void Copy(FMixed& OutState, const FMixed& InState, const Reflection::FLayoutCopyPlan& InPlan)
+	{
+		Rf::FLayoutFieldConstView(Rf::CRef(InState)).CopyTo(Rf::FLayoutFieldView(Rf::Ref(OutState)), InPlan);
+	}
+}
+
+RF_BEGIN_LAYOUT(FMixed)
+	RF_ENTRY(A),
+	RF_ENTRY(B),
+	RF_ENTRY(C),
+	RF_ENTRY(D),
+	RF_ENTRY(E),
+	RF_ENTRY(F),
+	RF_ENTRY(Name),
+	RF_ENTRY(Big),
+	RF_TAGGED_ENTRY(Cache, Reflection::Transient)
+RF_END_LAYOUT()
+
+RF_TEST(CopyAllButTransient)
+{
+	const Reflection::FLayoutCopyPlan Plan = Reflection::MakeCopyPlan<FMixed>(Reflection::EFieldFlags::None, Reflection::EFieldFlags::Transient);
+	const FMixed Source = MakeMixed(5);
+	FMixed Result = MakeMixed(40);
+	Copy(Result, Source, Plan);
+	RF_CHECK(HaveSameState(Result, Source));
+	RF_CHECK(Result.Cache == 40 * 7);
+	RF_CHECK(Plan.GetNumBytes() == static_cast<int>(1 + 1 + 2 + 4 + sizeof(FMixed::E) + sizeof(FMixed::F) + sizeof(std::string) + sizeof(FMixed::Big)));
+}
+
+RF_TEST(UnselectedFieldsAreUntouched)
+{
+	const FMixed Source = MakeMixed(3);
+
+	// Every single leaf alone : all other bytes keep their value
+	constexpr std::wstring_view Names[] = { L"A", L"B", L"C", L"D", L"E", L"F", L"Name", L"Big", L"Cache" };
+	for (std::size_t i = 0; i < std::size(Names); ++i)
+	{
+		const Reflection::FLayoutCopyPlan Plan = Reflection::MakeCopyPlan<FMixed>({ Names[i] });
+		FMixed Result = MakeMixed(60);
+		FMixed Expected = MakeMixed(60);
+		switch (i)
+		{
+		case 0: Expected.A = Source.A; break;
+		case 1: Expected.B = Source.B; break;
+		case 2: Expected.C = Source.C; break;
+		case 3: Expected.D = Source.D; break;
+		case 4: std::memcpy(Expected.E, Source.E, sizeof(Source.E)); break;
+		case 5: std::memcpy(Expected.F, Source.F, sizeof(Source.F)); break;
+		case 6: Expected.Name = Source.Name; break;
+		case 7: std::memcpy(Expected.Big, Source.Big, sizeof(Source.Big)); break;
+		case 8: Expected.Cache = Source.Cache; break;
+		}
+		Copy(Result, Source, Plan);
+		RF_CHECK(HaveSameState(Result, Expected) && Result.Cache == Expected.Cache);
+	}
+
+	// Pairs of neighbours merged into one range of 2, 3, 6 & 47 bytes
+	const std::initializer_list<std::wstring_view> Pairs[] = { { L"A", L"B" }, { L"B", L"C" }, { L"C", L"D" }, { L"E", L"F" } };
+	for (const std::initializer_list<std::wstring_view>& Pair : Pairs)
+	{
+		const Reflection::FLayoutCopyPlan Plan = Reflection::MakeCopyPlan<FMixed>(Pair);
+		RF_CHECK(Plan.GetRanges().size() == 1);
+		FMixed Result = MakeMixed(60);
+		Copy(Result, Source, Plan);
+		const FMixed Original = MakeMixed(60);
+		for (std::wstring_view Name : Pair)
+		{
+			const Reflection::FLayoutFieldDesc* Field = Reflection::FindField<FMixed>(Name);
+			RF_REQUIRE(Field != nullptr);
+			RF_CHECK(std::memcmp(reinterpret_cast<const std::uint8_t*>(&Result) + Field->Offset, reinterpret_cast<const std::uint8_t*>(&Source) + Field->Offset, Field->Size) == 0);
+		}
+		RF_CHECK(Result.Name == Original.Name && std::memcmp(Result.Big, Original.Big, sizeof(Result.Big)) == 0 && Result.Cache == Original.Cache);
+	}
+}
+
+RF_TEST(CopyFieldPack)
+{
+	const FMixed Source = MakeMixed(9);
+	FMixed Result = MakeMixed(1);
+	Reflection::FLayoutCopyPlan Plan;
+	Reflection::IterateLayoutNamed<FMixed>([&Plan](const auto&, const auto& InField)
+	{
+		if constexpr (std::is_same_v<typename std::decay_t<decltype(InField)>::Type, std::int64_t[10]>)
+			Plan = Reflection::MakeCopyPlan<FMixed>(InField);
+		return Reflection::EFieldIterator::Enter;
+	});
+	RF_REQUIRE(!Plan.IsEmpty());
+	Copy(Result, Source, Plan);
+	RF_CHECK(std::memcmp(Result.Big, Source.Big, sizeof(Source.Big)) == 0 && Result.A == MakeMixed(1).A && Result.Name == MakeMixed(1).Name);
+
+	const Reflection::FLayoutCopyPlan Empty = Reflection::MakeCopyPlan<FMixed>({ L"Unknown" });
+	RF_CHECK(Empty.IsEmpty());
+}
@@ -0,0 +1,137 @@
+/*!
+ *  @file TestDelta.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of delta encoding : round trips, truncated deltas leaving the state untouched, masks Diff can't emit & undersized views.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutDelta.h"
+
+#include <span>
+
+using namespace Test;
+
+namespace
+{
+	/** Leaf ranks : Id 0, Position 1-3, Samples 4, Cache 5 (transient), Health 6 */
+	struct FDeltaShape
+	{
+		std::int32_t Id = 0;
+		FVector Position;
+		std::vector<std::int32_t> Samples;
+		std::int32_t Cache = 0;
+		double Health = 0.0;
+	};
+
+	bool HaveSameState(const FDeltaShape& InA, const FDeltaShape& InB)
+	{
+		return InA.Id == InB.Id && InA.Position.X == InB.Position.X && InA.Position.Y == InB.Position.Y && InA.Position.Z == InB.Position.Z
+			&& InA.Samples == InB.Samples && InA.Health == InB.Health;
+	}
+
+	std::vector<std::uint8_t> MakeDelta(const FDeltaShape& InOld, const FDeltaShape& InNew)
+	{
+		std::vector<std::uint8_t> Buffer;
+		Reflection::FBinaryWriter Writer(Buffer);
+		Reflection::Diff<FDeltaShape>(Rf::FLayoutFieldConstView(Rf::CRef(InOld)), Rf::FLayoutFieldConstView(Rf::CRef(InNew)), Writer);
+		return Buffer;
+	}
+
+	bool Apply(FDeltaShape& InOutState, std::span<const std::uint8_t> InDelta)
+	{
+		Reflection::FBinaryReader Reader(InDelta);
+		return Reflection::ApplyDelta<FDeltaShape>(Rf::FLayoutFieldView(Rf::Ref(InOutState)), Reader);
+	}
+}
+
+RF_BEGIN_LAYOUT(FDeltaShape)
+	RF_ENTRY(Id),
+	RF_ENTRY(Position),
+	RF_ENTRY(Samples),
+	RF_TAGGED_ENTRY(Cache, Reflection::Transient),
+	RF_ENTRY(Health)
+RF_END_LAYOUT()
+
+RF_TEST(RoundTrip)
+{
+	const FDeltaShape Old{ 1, FVector{ 1.f, 2.f, 3.f }, { 1, 2 }, 5, 10.0 };
+	const FDeltaShape New{ 1, FVector{ 1.f, 4.f, 3.f }, { 1, 2, 3 }, 6, 20.0 };
+	const std::vector<std::uint8_t> Delta = MakeDelta(Old, New);
+	RF_CHECK(Delta[0] == ((1u << 2) | (1u << 4) | (1u << 6)));
+
+	FDeltaShape Result = Old;
+	RF_REQUIRE(Apply(Result, Delta));
+	RF_CHECK(HaveSameState(Result, New));
+	RF_CHECK(Result.Cache == Old.Cache);
+
+	// No change : mask only, nothing to apply
+	const std::vector<std::uint8_t> Empty = MakeDelta(New, New);
+	RF_CHECK(Empty.size() == Reflection::TDeltaPlan<FDeltaShape>::MaskSize && Empty[0] == 0);
+}
+
+RF_TEST(TruncatedDeltaFails)
+{
+	const FDeltaShape Old{ 1, FVector{ 1.f, 2.f, 3.f }, { 1, 2 }, 5, 10.0 };
+	const FDeltaShape New{ 2, FVector{ 0.f, 2.f, 7.f }, { 9, 8, 7, 6 }, 5, 11.0 };
+	const std::vector<std::uint8_t> Delta = MakeDelta(Old, New);
+
+	// Rejected before anything is written, including the leaves read before the end of the delta
+	for (std::size_t Size = 0; Size < Delta.size(); ++Size)
+	{
+		FDeltaShape Result = Old;
+		Reflection::FBinaryReader Reader(std::span<const std::uint8_t>(Delta.data(), Size));
+		RF_CHECK(!Reflection::ApplyDelta<FDeltaShape>(Rf::FLayoutFieldView(Rf::Ref(Result)), Reader));
+		RF_CHECK(HaveSameState(Result, Old) && Result.Cache == Old.Cache);
+		RF_CHECK(Reader.Tell() == 0 && !Reader.HasError());
+	}
+}
+
+RF_TEST(UndiffableBitsAreRejected)
+{
+	static_assert(Reflection::TDeltaPlan<FDeltaShape>::DiffableMask[0] == 0x5f);
+
+	// Transient leaf : never emitted by Diff, must not be written raw
+	{
+		const std::uint8_t Delta[] = { 1u << 5, 0x78, 0x56, 0x34, 0x12 };
+		FDeltaShape Result{ 1, FVector{}, {}, 5, 0.0 };
+		RF_CHECK(!Apply(Result, Delta));
+		RF_CHECK(Result.Cache == 5);
+	}
+
+	// Bit past the last leaf
+	{
+		const std::uint8_t Delta[] = { 1u << 7, 0, 0, 0, 0 };
+		FDeltaShape Result;
+		RF_CHECK(!Apply(Result, Delta));
+	}
+
+	// A valid bit followed by an invalid one : rejected before anything is written
+	{
+		const std::uint8_t Delta[] = { (1u << 0) | (1u << 5), 7, 0, 0, 0, 0, 0, 0, 0 };
+		FDeltaShape Result;
+		RF_CHECK(!Apply(Result, Delta));
+		RF_CHECK(Result.Id == 0);
+	}
+}
+
+RF_TEST(UndersizedViewsAreRejected)
+{
+	FDeltaShape State{ 1, FVector{ 1.f, 2.f, 3.f }, { 1, 2 }, 5, 10.0 };
+	const FDeltaShape Other{ 2, FVector{}, {}, 0, 0.0 };
+	const std::span<std::uint8_t> Bytes(reinterpret_cast<std::uint8_t*>(&State), sizeof(FDeltaShape) - 1);
+
+	std::vector<std::uint8_t> Buffer;
+	Reflection::FBinaryWriter Writer(Buffer);
+	RF_CHECK(!Reflection::Diff<FDeltaShape>(Rf::FLayoutFieldConstView(FName(), Bytes), Rf::FLayoutFieldConstView(Rf::CRef(Other)), Writer));
+	RF_CHECK(!Reflection::Diff<FDeltaShape>(Rf::FLayoutFieldConstView(Rf::CRef(Other)), Rf::FLayoutFieldConstView(FName(), Bytes), Writer));
+	RF_CHECK(Buffer.empty());
+
+	const std::vector<std::uint8_t> Delta = MakeDelta(State, Other);
+	Reflection::FBinaryReader Reader(Delta);
+	RF_CHECK(!Reflection::ApplyDelta<FDeltaShape>(Rf::FLayoutFieldView(FName(), Bytes), Reader));
+	RF_CHECK(State.Id == 1);
+}
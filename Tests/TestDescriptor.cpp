@@ -0,0 +1,161 @@
+/*!
+ *  @file TestDescriptor.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of layout descriptors : fields & nested descriptors, walking order, type-erased operations & the registry.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutDescriptor.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace Test;
+
+namespace
+{
+	/** Only ever reached through the registry */
+	struct FRegisteredOnly
+	{
+		std::int32_t A = 0;
+	};
+
+	/** No operator==, and padding bytes: can't be compared */
+	struct FOpaque
+	{
+		std::uint8_t A = 0;
+		std::int32_t B = 0;
+	};
+
+	struct FWithOpaque
+	{
+		std::int32_t Id = 0;
+		FOpaque Opaque;
+	};
+}
+
+RF_BEGIN_LAYOUT(FRegisteredOnly)
+	RF_ENTRY(A)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FWithOpaque)
+	RF_ENTRY(Id),
+	RF_ENTRY(Opaque)
+RF_END_LAYOUT()
+
+RF_REGISTER_LAYOUT(FRegisteredOnly)
+
+RF_TEST(DescribesFields)
+{
+	const Reflection::FLayoutDescriptor& Descriptor = Reflection::GetLayoutDescriptor<FRecord>();
+	RF_CHECK(Descriptor.Name == FName(L"Test::FRecord"));
+	RF_CHECK(Descriptor.Fingerprint == Reflection::GetLayoutFingerprint<FRecord>());
+	RF_CHECK(Descriptor.Ops.Size == sizeof(FRecord) && Descriptor.Ops.Alignment == alignof(FRecord));
+	RF_CHECK(!Descriptor.Ops.bTriviallyCopyable && !Descriptor.Ops.bTriviallyDestructible);
+	RF_REQUIRE(Descriptor.Fields.size() == 8);
+
+	const wchar_t* Names[] = { L"Id", L"Position", L"Health", L"Name", L"Samples", L"Bounds", L"Flags", L"Cache" };
+	const std::size_t Offsets[] = { offsetof(FRecord, Id), offsetof(FRecord, Position), offsetof(FRecord, Health), offsetof(FRecord, Name),
+		offsetof(FRecord, Samples), offsetof(FRecord, Bounds), offsetof(FRecord, Flags), offsetof(FRecord, Cache) };
+	for (std::size_t i = 0; i < Descriptor.Fields.size(); ++i)
+	{
+		const Reflection::FLayoutDescriptorField& Field = Descriptor.Fields[i];
+		RF_CHECK(Field.Name == FName(Names[i]) && Field.Offset == static_cast<int>(Offsets[i]));
+		RF_CHECK(Descriptor.FindField(Field.Name) == &Field);
+		RF_CHECK(Field.IsLeaf() == (i != 1));
+	}
+	RF_CHECK(Descriptor.FindField(FName(L"X")) == nullptr);
+
+	const Reflection::FLayoutDescriptorField& Position = *Descriptor.FindField(FName(L"Position"));
+	RF_CHECK(Position.Descriptor == &Reflection::GetLayoutDescriptor<FVector>() && Position.Type->Size == sizeof(FVector));
+	RF_CHECK(Descriptor.FindField(FName(L"Bounds"))->Type->Size == sizeof(float[4]));
+}
+
+RF_TEST(WalksDepthFirst)
+{
+	FRecord Record = MakeRecord(3);
+	const Reflection::FLayoutDescriptor& Descriptor = Reflection::GetLayoutDescriptor<FRecord>();
+
+	std::vector<std::wstring> Visited;
+	Descriptor.Walk(static_cast<const void*>(&Record), [&Visited](const Reflection::FLayoutDescriptorField& InField, const void*, int InDepth)
+	{
+		Visited.push_back(std::to_wstring(InDepth) + std::wstring(InField.Name.ToStringView()));
+	});
+	const std::vector<std::wstring> Expected = { L"0Id", L"0Position", L"1X", L"1Y", L"1Z", L"0Health", L"0Name", L"0Samples", L"0Bounds", L"0Flags", L"0Cache" };
+	RF_CHECK(Visited == Expected);
+
+	// Stop skips the nested fields only, writes go to the object
+	std::vector<std::wstring> Skipped;
+	Descriptor.Walk(static_cast<void*>(&Record), [&Skipped](const Reflection::FLayoutDescriptorField& InField, void* InData, int)
+	{
+		Skipped.push_back(std::wstring(InField.Name.ToStringView()));
+		if (InField.Name == FName(L"Health"))
+			*static_cast<double*>(InData) = 42.0;
+		return InField.IsLeaf() ? Reflection::EFieldIterator::Enter : Reflection::EFieldIterator::Stop;
+	});
+	RF_CHECK(Skipped.size() == 8 && Skipped[2] == L"Health");
+	RF_CHECK(Record.Health == 42.0 && Record.Id == 3);
+}
+
+RF_TEST(TypeErasedOperations)
+{
+	const Reflection::FLayoutTypeOps& Ops = Reflection::GetLayoutDescriptor<FRecord>().Ops;
+	RF_REQUIRE(Ops.Construct != nullptr && Ops.Destroy != nullptr && Ops.Copy != nullptr && Ops.Equals != nullptr);
+
+	alignas(FRecord) unsigned char StorageA[sizeof(FRecord)];
+	alignas(FRecord) unsigned char StorageB[sizeof(FRecord)];
+	Ops.Construct(StorageA);
+	Ops.Construct(StorageB);
+	FRecord& A = *reinterpret_cast<FRecord*>(StorageA);
+	FRecord& B = *reinterpret_cast<FRecord*>(StorageB);
+	RF_CHECK(A.Name.empty() && A.Samples.empty() && A.Bounds[3] == 0.f);
+
+	const FRecord Source = MakeRecord(5);
+	Ops.Copy(StorageA, &Source);
+	RF_CHECK(HaveSameState(A, Source) && A.Cache == Source.Cache);
+	RF_CHECK(!Ops.Equals(StorageA, StorageB));
+	Ops.Copy(StorageB, StorageA);
+	RF_CHECK(Ops.Equals(StorageA, StorageB));
+
+	// Compared field by field, through nested layouts, arrays & containers
+	B.Position.Y += 1.f;
+	RF_CHECK(!Ops.Equals(StorageA, StorageB));
+	B.Position.Y = A.Position.Y;
+	B.Bounds[3] += 1.f;
+	RF_CHECK(!Ops.Equals(StorageA, StorageB));
+	B.Bounds[3] = A.Bounds[3];
+	B.Samples.push_back(0);
+	RF_CHECK(!Ops.Equals(StorageA, StorageB));
+
+	Ops.Destroy(StorageA);
+	Ops.Destroy(StorageB);
+
+	// A field without equality makes the whole type not equal
+	const Reflection::FLayoutDescriptor& WithOpaque = Reflection::GetLayoutDescriptor<FWithOpaque>();
+	RF_CHECK(WithOpaque.FindField(FName(L"Opaque"))->Type->Equals == nullptr);
+	const FWithOpaque Opaque;
+	RF_CHECK(!WithOpaque.EqualsFields(&Opaque, &Opaque));
+}
+
+RF_TEST(Registry)
+{
+	// Registered at startup, before any use of the type
+	const Reflection::FLayoutDescriptor* RegisteredOnly = Reflection::FindLayoutDescriptor(FName(L"FRegisteredOnly"));
+	RF_REQUIRE(RegisteredOnly != nullptr);
+	RF_CHECK(RegisteredOnly->Fields.size() == 1 && RegisteredOnly->Ops.Size == sizeof(FRegisteredOnly));
+
+	// Registered on first use, nested layouts along
+	const Reflection::FLayoutDescriptor& Record = Reflection::GetLayoutDescriptor<FRecord>();
+	RF_CHECK(Reflection::FindLayoutDescriptor(FName(L"Test::FRecord")) == &Record);
+	RF_CHECK(Reflection::FindLayoutDescriptor(FName(L"Test::FVector")) == &Reflection::GetLayoutDescriptor<FVector>());
+	RF_CHECK(Reflection::FindLayoutDescriptor(FName(L"Test::FNotReflected")) == nullptr);
+
+	const std::vector<const Reflection::FLayoutDescriptor*> All = Reflection::FLayoutDescriptorRegistry::Get().GetAll();
+	RF_CHECK(std::find(All.begin(), All.end(), &Record) != All.end() && std::find(All.begin(), All.end(), RegisteredOnly) != All.end());
+}
@@ -0,0 +1,70 @@
+/*!
+ *  @file TestHarness.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a minimal, dependency free test harness.
+ *  RF_TEST defines a self-registering test case; RF_CHECK records a failure and goes on, RF_REQUIRE records a failure
+ *  and leaves the test case. Each test executable links TestMain.cpp, which runs every registered case and returns
+ *  non-zero when a check failed, so that ctest reports it.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+namespace Test
+{
+	struct FTestCase
+	{
+		const char* Name = nullptr;
+		void (*Function)() = nullptr;
+	};
+
+	inline std::vector<FTestCase>& GetTestCases()
+	{
+		static std::vector<FTestCase> TestCases;
+		return TestCases;
+	}
+
+	inline int& GetNumFailures()
+	{
+		static int NumFailures = 0;
+		return NumFailures;
+	}
+
+	/**
+	 * Registers a test case at static initialization
+	 */
+	struct FTestRegistrar
+	{
+		FTestRegistrar(const char* InName, void (*InFunction)())
+		{
+			GetTestCases().push_back(FTestCase{ InName, InFunction });
+		}
+	};
+
+	/**
+	 * Record the result of a check
+	 * @return bInCondition
+	 */
+	inline bool Check(bool bInCondition, const char* InExpression, const char* InFile, int InLine)
+	{
+		if (!bInCondition)
+		{
+			std::printf("%s(%d): check failed: %s\n", InFile, InLine, InExpression);
+			++GetNumFailures();
+		}
+		return bInCondition;
+	}
+}
+
+#define RF_TEST(Name) \
+	static void Name(); \
+	static const Test::FTestRegistrar Name##Registrar(#Name, &Name); \
+	static void Name()
+
+#define RF_CHECK(Condition) Test::Check(static_cast<bool>(Condition), #Condition, __FILE__, __LINE__)
+
+#define RF_REQUIRE(Condition) do { if (!RF_CHECK(Condition)) return; } while (false)
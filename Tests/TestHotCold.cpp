@@ -0,0 +1,213 @@
+/*!
+ *  @file TestHotCold.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of field tags & hot/cold containers : flags in fields & tables, record packing, element access & round trips.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutHotCold.h"
+#include "Reflection/LayoutIterator.h"
+#include "Reflection/LayoutLookup.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Test;
+
+namespace
+{
+	/** Hot nested layouts & leaves of every alignment, cold & untagged leaves interleaved */
+	struct FUnit
+	{
+		std::uint8_t Team = 0;
+		FVector Position;
+		double Health = 0.0;
+		std::int32_t Id = 0;
+		FVector Velocity;
+		char Name[6] = {};
+		std::uint16_t Level = 0;
+	};
+
+	/** Hot leaves only: no cold storage */
+	struct FHotOnly
+	{
+		float A = 0.f;
+		std::int32_t B = 0;
+	};
+
+	FUnit MakeUnit(std::int32_t InId)
+	{
+		FUnit Unit;
+		Unit.Team = static_cast<std::uint8_t>(InId % 3);
+		Unit.Position = FVector{ 1.f * InId, 2.f * InId, 3.f * InId };
+		Unit.Health = 100.0 - InId;
+		Unit.Id = InId;
+		Unit.Velocity = FVector{ -1.f * InId, 0.5f, 0.25f };
+		std::memcpy(Unit.Name, "Unit", 4);
+		Unit.Name[4] = static_cast<char>('a' + InId % 26);
+		Unit.Level = static_cast<std::uint16_t>(InId * 7);
+		return Unit;
+	}
+
+	bool AreEqual(const FUnit& InA, const FUnit& InB)
+	{
+		return InA.Team == InB.Team && InA.Position.X == InB.Position.X && InA.Position.Y == InB.Position.Y && InA.Position.Z == InB.Position.Z
+			&& InA.Health == InB.Health && InA.Id == InB.Id && InA.Velocity.X == InB.Velocity.X && InA.Velocity.Y == InB.Velocity.Y
+			&& InA.Velocity.Z == InB.Velocity.Z && std::memcmp(InA.Name, InB.Name, sizeof(InA.Name)) == 0 && InA.Level == InB.Level;
+	}
+}
+
+RF_BEGIN_LAYOUT(FUnit)
+	RF_ENTRY(Team),
+	RF_TAGGED_ENTRY(Position, Reflection::Hot, Reflection::Replicated, Reflection::FQuantize{ -1024.0, 1024.0, 16 }),
+	RF_TAGGED_ENTRY(Health, Reflection::Cold),
+	RF_TAGGED_ENTRY(Id, Reflection::Hot),
+	RF_TAGGED_ENTRY(Velocity, Reflection::Hot),
+	RF_ENTRY(Name),
+	RF_TAGGED_ENTRY(Level, Reflection::Transient)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FHotOnly)
+	RF_TAGGED_ENTRY(A, Reflection::Hot),
+	RF_TAGGED_ENTRY(B, Reflection::Hot)
+RF_END_LAYOUT()
+
+RF_TEST(TagsAndFlags)
+{
+	constexpr auto Field = Reflection::MakeTaggedField<double, 0>(L"X", Reflection::TTags<Reflection::FColdTag, Reflection::FQuantize>{ Reflection::Cold, Reflection::FQuantize{ -2.0, 2.0, 10 } });
+	using FieldType = std::decay_t<decltype(Field)>;
+	static_assert(FieldType::Flags == (Reflection::EFieldFlags::Cold | Reflection::EFieldFlags::Quantized));
+	static_assert(Reflection::HasTag<Reflection::FQuantize, FieldType::TagsType>() && !Reflection::HasTag<Reflection::FHotTag, FieldType::TagsType>());
+	static_assert(Reflection::GetTag<Reflection::FQuantize>(Field.Tags).Bits == 10 && Reflection::GetTag<Reflection::FQuantize>(Field.Tags).Min == -2.0);
+	static_assert(Reflection::MakeField<double, 0>().Flags == Reflection::EFieldFlags::None);
+
+	// Fewest bits reaching the precision: 2 / (2^8 - 1) <= 0.01 < 2 / (2^7 - 1)
+	static_assert(Reflection::FQuantize::FromPrecision(-1.0, 1.0, 0.01).Bits == 8);
+	static_assert(Reflection::FQuantize::FromPrecision(0.0, 1e30, 1e-30).Bits == 32);
+
+	// Fields visited by the iterator carry their tags
+	std::vector<std::wstring> Hot;
+	Reflection::IterateLayoutNamed<FUnit>([&Hot](const auto&, const auto& InField)
+	{
+		if constexpr (Reflection::HasAnyFlags(std::decay_t<decltype(InField)>::Flags, Reflection::EFieldFlags::Hot))
+			Hot.emplace_back(InField.GetName().CStr(), InField.GetName().Num());
+		return Reflection::EFieldIterator::Enter;
+	});
+	RF_CHECK((Hot == std::vector<std::wstring>{ L"Position", L"Id", L"Velocity" }));
+}
+
+RF_TEST(TableInheritsFlags)
+{
+	using Reflection::EFieldFlags;
+	const Reflection::FLayoutFieldDesc* Position = Reflection::FindField<FUnit>(L"Position");
+	const Reflection::FLayoutFieldDesc* PositionY = Reflection::FindField<FUnit>(L"Position.Y");
+	RF_REQUIRE(Position != nullptr && PositionY != nullptr);
+	RF_CHECK(Position->Flags == (EFieldFlags::Hot | EFieldFlags::Replicated | EFieldFlags::Quantized) && Position->Quantize.Bits == 16);
+
+	// Quantization belongs to the tagged field only
+	RF_CHECK(PositionY->Flags == (EFieldFlags::Hot | EFieldFlags::Replicated) && PositionY->Quantize.Bits == Reflection::FQuantize{}.Bits);
+	RF_CHECK(Reflection::FindField<FUnit>(L"Velocity.Z")->Flags == EFieldFlags::Hot);
+	RF_CHECK(Reflection::FindField<FUnit>(L"Health")->Flags == EFieldFlags::Cold && Reflection::FindField<FUnit>(L"Team")->Flags == EFieldFlags::None);
+	RF_CHECK(Reflection::FindField<FUnit>(L"Level")->Flags == EFieldFlags::Transient);
+}
+
+RF_TEST(PlanPacksRecords)
+{
+	using PlanType = Reflection::THotColdPlan<FUnit>;
+	static_assert(PlanType::NumLeaves == 11);
+
+	// Hot: 6 floats & an int32, cold: a double, a uint16 & 7 bytes, padded to the double
+	static_assert(PlanType::HotRecordSize == 7 * 4);
+	static_assert(PlanType::ColdRecordSize == 24);
+	static_assert(Rf::TLayoutHotCold<FUnit>::IsHot<decltype(Reflection::MakeField<float, offsetof(FUnit, Velocity) + offsetof(FVector, Y)>())>());
+	static_assert(!Rf::TLayoutHotCold<FUnit>::IsHot<decltype(Reflection::MakeField<std::uint8_t, offsetof(FUnit, Team)>())>());
+
+	// Every leaf in its record, aligned, without overlap
+	std::vector<int> HotBytes(PlanType::HotRecordSize);
+	std::vector<int> ColdBytes(PlanType::ColdRecordSize);
+	for (int Rank = 0; Rank < PlanType::NumLeaves; ++Rank)
+	{
+		const Reflection::FHotColdSlot& Slot = PlanType::Slots[Rank];
+		const Reflection::FLayoutFieldDesc& Leaf = Reflection::TLayoutTable<FUnit>::Fields[Reflection::TLayoutTable<FUnit>::LeafIndices[Rank]];
+		RF_CHECK(Slot.Offset == Leaf.Offset && Slot.Size == Leaf.Size && Slot.RecordOffset % Leaf.Alignment == 0);
+		RF_CHECK(Slot.bHot == Reflection::HasAnyFlags(Leaf.Flags, Reflection::EFieldFlags::Hot));
+
+		std::vector<int>& Bytes = Slot.bHot ? HotBytes : ColdBytes;
+		RF_REQUIRE(Slot.RecordOffset + Slot.Size <= static_cast<int>(Bytes.size()));
+		for (int i = 0; i < Slot.Size; ++i)
+			++Bytes[Slot.RecordOffset + i];
+	}
+	for (int Count : HotBytes)
+		RF_CHECK(Count == 1);
+	int NumColdBytes = 0;
+	for (int Count : ColdBytes)
+	{
+		RF_CHECK(Count <= 1);
+		NumColdBytes += Count;
+	}
+	RF_CHECK(NumColdBytes == 8 + 2 + 1 + 6);
+}
+
+RF_TEST(ContainerRoundTrip)
+{
+	Rf::TLayoutHotCold<FUnit> Units;
+	RF_CHECK(Units.empty() && Units.GetHotData().empty());
+	for (int i = 0; i < 40; ++i)
+		Units.push_back(MakeUnit(i));
+	RF_REQUIRE(Units.size() == 40 && Units.capacity() >= 40);
+	RF_CHECK(Units.GetHotData().size() == 40 * Reflection::THotColdPlan<FUnit>::HotRecordSize);
+	RF_CHECK(reinterpret_cast<std::uintptr_t>(Units.GetHotData().data()) % Rf::TLayoutHotCold<FUnit>::StorageAlignment == 0);
+	for (int i = 0; i < 40; ++i)
+		RF_CHECK(AreEqual(Units.Load(i), MakeUnit(i)) && AreEqual(Units[i].Load(), MakeUnit(i)));
+
+	// Writing hot fields leaves the cold records untouched
+	constexpr auto IdField = Reflection::MakeField<std::int32_t, offsetof(FUnit, Id)>();
+	constexpr auto VelocityXField = Reflection::MakeField<float, offsetof(FUnit, Velocity) + offsetof(FVector, X)>();
+	constexpr auto HealthField = Reflection::MakeField<double, offsetof(FUnit, Health)>();
+	const std::vector<std::uint8_t> Cold(Units.GetColdData().begin(), Units.GetColdData().end());
+	for (int i = 0; i < 40; ++i)
+	{
+		Units[i].Get(IdField) += 1000;
+		Units[i].Get(VelocityXField) = 9.f;
+	}
+	RF_CHECK(std::vector<std::uint8_t>(Units.GetColdData().begin(), Units.GetColdData().end()) == Cold);
+
+	Units[7].Get(HealthField) = -5.0;
+	FUnit Expected = MakeUnit(7);
+	Expected.Id += 1000;
+	Expected.Velocity.X = 9.f;
+	Expected.Health = -5.0;
+	RF_CHECK(AreEqual(std::as_const(Units)[7].Load(), Expected) && std::as_const(Units)[7].Get(IdField) == 1007);
+
+	// Copies are independent, moves leave the source empty
+	Rf::TLayoutHotCold<FUnit> Copy(Units);
+	Copy[3].Store(MakeUnit(99));
+	RF_CHECK(AreEqual(Copy.Load(3), MakeUnit(99)) && Units.Load(3).Id == 1003);
+	Rf::TLayoutHotCold<FUnit> Moved(std::move(Copy));
+	RF_CHECK(Moved.size() == 40 && Copy.empty() && AreEqual(Moved.Load(3), MakeUnit(99)));
+
+	// Resizing fills with default objects
+	Moved.resize(45);
+	RF_CHECK(AreEqual(Moved.Load(44), FUnit{}) && AreEqual(Moved.Load(39), Units.Load(39)));
+	Moved.pop_back();
+	Moved.clear();
+	RF_CHECK(Moved.empty());
+}
+
+RF_TEST(HotOnlyContainer)
+{
+	static_assert(Reflection::THotColdPlan<FHotOnly>::ColdRecordSize == 0);
+	Rf::TLayoutHotCold<FHotOnly> Values;
+	for (int i = 0; i < 20; ++i)
+		Values.push_back(FHotOnly{ 0.5f * i, i });
+	const Rf::TLayoutHotCold<FHotOnly> Copy = Values;
+	RF_CHECK(Copy.GetColdData().empty() && Copy.Load(19).A == 9.5f && Copy.Load(19).B == 19);
+}
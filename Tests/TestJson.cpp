@@ -0,0 +1,165 @@
+/*!
+ *  @file TestJson.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of the JSON writer & reader : round trips, unknown keys, malformed & out of range input.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutJson.h"
+#include "Reflection/LayoutJsonReader.h"
+
+#include <cmath>
+#include <span>
+#include <string_view>
+
+using namespace Test;
+
+namespace
+{
+	struct FConstView
+	{
+		std::int32_t A = 0;
+		std::span<const std::int32_t> Values;
+	};
+}
+
+RF_BEGIN_LAYOUT(FConstView)
+	RF_ENTRY(A),
+	RF_ENTRY(Values)
+RF_END_LAYOUT()
+
+RF_TEST(WriterText)
+{
+	const FFlat Flat{ 1.5, -2.0, std::nan(""), 7 };
+	RF_CHECK(Reflection::ToJson(Flat) == R"({"X":1.5,"Y":-2,"Z":null,"W":7})");
+
+	FRecord Record = MakeRecord(3);
+	Record.Name = "a\"b\n";
+	RF_CHECK(Reflection::ToJson(Record) == R"({"Id":3,"Position":{"X":3,"Y":6,"Z":9},"Health":97,"Name":"a\"b\n","Samples":[3,4,5],"Bounds":[0,0,0,1.5],"Flags":3,"Cache":-1})");
+
+	const FFlat Flats[2] = { FFlat{ 1.0, 2.0, 3.0, 4 }, FFlat{} };
+	std::string Text;
+	Reflection::FJsonWriter Writer(Text);
+	Reflection::WriteJsonArray(std::span<const FFlat>(Flats), Writer);
+	RF_CHECK(Text == R"([{"X":1,"Y":2,"Z":3,"W":4},{"X":0,"Y":0,"Z":0,"W":0}])");
+
+	Text.clear();
+	Reflection::WriteJsonArray(std::span<const FFlat>(), Writer);
+	RF_CHECK(Text == "[]");
+}
+
+RF_TEST(RoundTripRecord)
+{
+	const FRecord Source = MakeRecord(21);
+	const std::string Text = Reflection::ToJson(Source);
+
+	FRecord Result;
+	RF_REQUIRE(Reflection::FromJson(Text, Result));
+	RF_CHECK(HaveSameState(Result, Source));
+}
+
+RF_TEST(RoundTripEscapedString)
+{
+	FRecord Source = MakeRecord(1);
+	Source.Name = "quote \" backslash \\ tab \t newline \n unicode \xc3\xa9";
+	const std::string Text = Reflection::ToJson(Source);
+
+	FRecord Result;
+	RF_REQUIRE(Reflection::FromJson(Text, Result));
+	RF_CHECK(Result.Name == Source.Name);
+}
+
+RF_TEST(UnknownKeysAreSkipped)
+{
+	FFlat Result;
+	RF_REQUIRE(Reflection::FromJson(R"({"Unknown":{"Nested":[1,{"a":"}"}],"S":"x"},"X":1.5,"W":7,"Other":null})", Result));
+	RF_CHECK(Result.X == 1.5 && Result.W == 7);
+	RF_CHECK(Result.Y == 0.0 && Result.Z == 0.0);
+}
+
+RF_TEST(EscapedKeys)
+{
+	FFlat Result;
+	RF_REQUIRE(Reflection::FromJson(R"({"\u0058":2.5,"\u0057":3})", Result));
+	RF_CHECK(Result.X == 2.5 && Result.W == 3);
+}
+
+RF_TEST(MalformedInputFails)
+{
+	constexpr std::string_view Inputs[] =
+	{
+		"",
+		"{",
+		"}",
+		"[]",
+		R"({"X":})",
+		R"({"X":1,})",
+		R"({"X" 1})",
+		R"({X:1})",
+		R"({"X":1 "Y":2})",
+		R"({"X":1.5.5})",
+		R"({"X":1}})",
+		R"({"X":1} trailing)",
+		R"({"W":-1})",
+		R"({"W":4294967296})",
+		R"({"W":1.5})",
+		R"({"W":1e3})",
+		R"({"W":"7"})",
+		R"({"Unknown":[1,2})",
+		R"({"Unknown":"unterminated})",
+		R"({"Unknown":})",
+		R"({"Unknown":]})",
+	};
+
+	for (std::string_view Input : Inputs)
+	{
+		FFlat Result;
+		Reflection::FJsonReader Reader(Input);
+		const bool bSuccess = Reflection::ReadJson(Result, Reader) && Reader.IsAtEnd();
+		RF_CHECK(!bSuccess);
+		if (bSuccess)
+			std::printf("  accepted: %.*s\n", static_cast<int>(Input.size()), Input.data());
+	}
+}
+
+RF_TEST(MalformedRecordFails)
+{
+	constexpr std::string_view Inputs[] =
+	{
+		R"({"Name":"bad escape \q"})",
+		R"({"Name":"truncated \u12"})",
+		R"({"Name":12})",
+		R"({"Samples":[1,2,})",
+		R"({"Samples":[1,"2"]})",
+		R"({"Bounds":[1,2,3]})",
+		R"({"Bounds":[1,2,3,4,5]})",
+		R"({"Flags":256})",
+		R"({"Position":{"X":1,}})",
+		R"({"Position":[1,2,3]})",
+	};
+
+	for (std::string_view Input : Inputs)
+	{
+		FRecord Result;
+		RF_CHECK(!Reflection::FromJson(Input, Result));
+	}
+}
+
+RF_TEST(ConstViewReportsError)
+{
+	FConstView Result;
+	Reflection::FJsonReader Reader(R"({"A":1,"Values":[1,2]})");
+	RF_CHECK(!Reflection::ReadJson(Result, Reader));
+	RF_CHECK(Reader.HasError());
+}
+
+RF_TEST(NullReadsAsNaN)
+{
+	FFlat Result;
+	RF_REQUIRE(Reflection::FromJson(R"({"X":null})", Result));
+	RF_CHECK(std::isnan(Result.X));
+}
@@ -0,0 +1,113 @@
+/*!
+ *  @file TestLayoutTable.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of the flattened field table : names, offsets & nesting, leaf ranks, iteration order, fingerprints.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutIterator.h"
+#include "Reflection/LayoutTable.h"
+
+#include <cstddef>
+#include <iterator>
+
+using namespace Test;
+
+namespace
+{
+	/** FVector with its members swapped, same size & types */
+	struct FSwappedVector
+	{
+		float Y = 0.f;
+		float X = 0.f;
+		float Z = 0.f;
+	};
+}
+
+RF_BEGIN_LAYOUT(FSwappedVector)
+	RF_ENTRY(Y),
+	RF_ENTRY(X),
+	RF_ENTRY(Z)
+RF_END_LAYOUT()
+
+RF_TEST(FieldsOfNestedLayout)
+{
+	using TableType = Reflection::TLayoutTable<FRecord>;
+	static_assert(TableType::Num == 11 && TableType::NumLeaves == 10);
+	static_assert(!TableType::bTriviallyCopyableLeaves);
+
+	constexpr std::wstring_view Names[] = { L"Id", L"Position", L"Position.X", L"Position.Y", L"Position.Z", L"Health", L"Name", L"Samples", L"Bounds", L"Flags", L"Cache" };
+	const std::span<const Reflection::FLayoutFieldDesc> Fields = Reflection::GetLayoutTable<FRecord>();
+	RF_REQUIRE(Fields.size() == std::size(Names));
+	for (std::size_t i = 0; i < Fields.size(); ++i)
+		RF_CHECK(Fields[i].Name == Names[i]);
+
+	const Reflection::FLayoutFieldDesc& Position = Fields[1];
+	RF_CHECK(Position.Offset == static_cast<int>(offsetof(FRecord, Position)) && Position.Size == static_cast<int>(sizeof(FVector)));
+	RF_CHECK(Position.bHasLayout && !Position.IsLeaf() && Position.NumDescendants == 3 && Position.ParentIndex == -1 && Position.Depth == 0);
+
+	const Reflection::FLayoutFieldDesc& Y = Fields[3];
+	RF_CHECK(Y.Offset == static_cast<int>(offsetof(FRecord, Position) + offsetof(FVector, Y)) && Y.Size == 4);
+	RF_CHECK(Y.IsLeaf() && Y.ParentIndex == 1 && Y.Depth == 1 && Y.TypeId == Reflection::GetTypeId<float>());
+
+	const Reflection::FLayoutFieldDesc& Samples = Fields[7];
+	RF_CHECK(Samples.Kind == Reflection::EFieldKind::DynamicArray && Samples.IsContainer() && !Samples.bBlittable);
+	RF_CHECK(Samples.ElementSize == 4 && Samples.ElementTypeId == Reflection::GetTypeId<std::int32_t>() && Samples.bTriviallyCopyableElements);
+
+	const Reflection::FLayoutFieldDesc& Bounds = Fields[8];
+	RF_CHECK(Bounds.Kind == Reflection::EFieldKind::FixedArray && Bounds.NumElements == 4 && Bounds.bBlittable);
+
+	RF_CHECK(!Fields[6].bTriviallyCopyable && Fields[9].bTriviallyCopyable);
+	RF_CHECK(Reflection::HasAnyFlags(Fields[10].Flags, Reflection::EFieldFlags::Transient) && !Reflection::HasAnyFlags(Fields[9].Flags, Reflection::EFieldFlags::Transient));
+}
+
+RF_TEST(LeafRanksAndLookup)
+{
+	using TableType = Reflection::TLayoutTable<FRecord>;
+	constexpr int LeafIndices[] = { 0, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+	for (int i = 0; i < TableType::NumLeaves; ++i)
+		RF_CHECK(TableType::LeafIndices[i] == LeafIndices[i]);
+
+	constexpr int HealthOffset = static_cast<int>(offsetof(FRecord, Health));
+	static_assert(TableType::FindIndex(HealthOffset, Reflection::GetTypeId<double>()) == 5);
+	static_assert(TableType::FindLeafRank(HealthOffset, Reflection::GetTypeId<double>()) == 4);
+	// Same offset, another type
+	RF_CHECK(TableType::FindIndex(HealthOffset, Reflection::GetTypeId<float>()) == -1);
+	// Position & Position.X share their offset, only the leaf has a rank
+	RF_CHECK(TableType::FindLeafRank(static_cast<int>(offsetof(FRecord, Position)), Reflection::GetTypeId<FVector>()) == -1);
+	RF_CHECK(TableType::FindLeafRank(static_cast<int>(offsetof(FRecord, Position)), Reflection::GetTypeId<float>()) == 1);
+}
+
+RF_TEST(MatchesIterationOrder)
+{
+	// Fields visited by the recursive iterator, in order, are the table rows
+	int Index = 0;
+	Reflection::IterateLayoutNamed<FRecord>([&Index](const auto&, const auto& InField)
+	{
+		RF_CHECK(Reflection::GetFieldIndex<FRecord>(InField) == Index);
+		++Index;
+		return Reflection::EFieldIterator::Enter;
+	});
+	RF_CHECK(Index == Reflection::TLayoutTable<FRecord>::Num);
+
+	// Stop skips the nested fields
+	std::vector<std::wstring_view> Visited;
+	Reflection::IterateLayoutTable<FRecord>([&Visited](const Reflection::FLayoutFieldDesc& InField)
+	{
+		Visited.push_back(InField.Name);
+		return InField.bHasLayout ? Reflection::EFieldIterator::Stop : Reflection::EFieldIterator::Enter;
+	});
+	RF_CHECK(Visited.size() == 8 && Visited[1] == L"Position" && Visited[2] == L"Health");
+}
+
+RF_TEST(FingerprintFollowsLayout)
+{
+	static_assert(Reflection::GetLayoutFingerprint<FVector>() == Reflection::GetLayoutFingerprint<FVector>());
+	// Same size, types & names, other order
+	static_assert(Reflection::GetLayoutFingerprint<FVector>() != Reflection::GetLayoutFingerprint<FSwappedVector>());
+	static_assert(Reflection::GetLayoutFingerprint<FRecord>() != Reflection::GetLayoutFingerprint<FFlat>());
+}
@@ -0,0 +1,111 @@
+/*!
+ *  @file TestLookup.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of field lookup by name : every field of nested & wide layouts, near misses, perfect hash tables of any size.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutLookup.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+using namespace Test;
+
+namespace
+{
+	/** More fields than a single perfect hash bucket, with names sharing prefixes & lengths */
+	struct FWide
+	{
+		std::int32_t A0 = 0, A1 = 0, A2 = 0, A3 = 0, A4 = 0, A5 = 0, A6 = 0, A7 = 0, A8 = 0, A9 = 0;
+		std::int32_t B0 = 0, B1 = 0, B2 = 0, B3 = 0, B4 = 0, B5 = 0, B6 = 0, B7 = 0, B8 = 0, B9 = 0;
+		FVector Position;
+		FVector Velocity;
+	};
+
+	/** Hashes of N keys */
+	template<std::size_t n>
+	constexpr std::array<std::uint64_t, n> MakeHashes(std::uint64_t InSeed)
+	{
+		std::array<std::uint64_t, n> Hashes = {};
+		for (std::size_t i = 0; i < n; ++i)
+			Hashes[i] = Reflection::HashCombine(InSeed, i);
+		return Hashes;
+	}
+
+	template<std::size_t n>
+	bool IsPerfect(const std::array<std::uint64_t, n>& InHashes)
+	{
+		const auto Table = Reflection::MakePerfectHashTable(InHashes);
+		bool bResult = Table.bValid;
+		for (std::size_t i = 0; i < n; ++i)
+			bResult = bResult && Table.Find(InHashes[i]) == static_cast<int>(i);
+		return bResult;
+	}
+}
+
+RF_BEGIN_LAYOUT(FWide)
+	RF_ENTRY(A0), RF_ENTRY(A1), RF_ENTRY(A2), RF_ENTRY(A3), RF_ENTRY(A4), RF_ENTRY(A5), RF_ENTRY(A6), RF_ENTRY(A7), RF_ENTRY(A8), RF_ENTRY(A9),
+	RF_ENTRY(B0), RF_ENTRY(B1), RF_ENTRY(B2), RF_ENTRY(B3), RF_ENTRY(B4), RF_ENTRY(B5), RF_ENTRY(B6), RF_ENTRY(B7), RF_ENTRY(B8), RF_ENTRY(B9),
+	RF_ENTRY(Position),
+	RF_ENTRY(Velocity)
+RF_END_LAYOUT()
+
+RF_TEST(FindFieldByName)
+{
+	const Reflection::FLayoutFieldDesc* Field = Reflection::FindField<FRecord>(L"Position.Y");
+	RF_REQUIRE(Field != nullptr);
+	RF_CHECK(Field->Offset == static_cast<int>(offsetof(FRecord, Position) + offsetof(FVector, Y)));
+
+	const Reflection::FLayoutFieldDesc* NarrowField = Reflection::FindField<FRecord>("Health");
+	RF_REQUIRE(NarrowField != nullptr);
+	RF_CHECK(NarrowField->Offset == static_cast<int>(offsetof(FRecord, Health)));
+
+	RF_CHECK(Reflection::FindField<FRecord>(L"Position") != nullptr);
+	RF_CHECK(Reflection::FindField<FRecord>(L"Position.W") == nullptr);
+	RF_CHECK(Reflection::FindField<FRecord>(L"Healt") == nullptr);
+	RF_CHECK(Reflection::FindField<FRecord>(L"") == nullptr);
+	static_assert(Reflection::FindField<FFlat>(L"Z") != nullptr && Reflection::FindField<FFlat>(L"Q") == nullptr);
+}
+
+RF_TEST(EveryFieldIsFound)
+{
+	const std::span<const Reflection::FLayoutFieldDesc> Fields = Reflection::GetLayoutTable<FWide>();
+	RF_REQUIRE(Fields.size() == 28);
+	for (const Reflection::FLayoutFieldDesc& Field : Fields)
+	{
+		RF_CHECK(Reflection::FindField<FWide>(Field.Name) == &Field);
+
+		// Same name in narrow characters
+		const std::string Narrow(Field.Name.begin(), Field.Name.end());
+		RF_CHECK(Reflection::FindField<FWide>(std::string_view(Narrow)) == &Field);
+
+		// Same length, last character changed
+		std::wstring Other(Field.Name);
+		Other.back() = L'#';
+		RF_CHECK(Reflection::FindField<FWide>(Other) == nullptr);
+	}
+
+	RF_CHECK(Reflection::FindField<FWide>(L"A10") == nullptr && Reflection::FindField<FWide>(L"Velocity.") == nullptr);
+	RF_CHECK(Reflection::FindField<FWide>(L"position.x") == nullptr && Reflection::FindField<FWide>("Velocity.Z")->Offset == static_cast<int>(offsetof(FWide, Velocity) + offsetof(FVector, Z)));
+}
+
+RF_TEST(PerfectHashTables)
+{
+	// Empty, single key, one bucket, many buckets
+	RF_CHECK(IsPerfect(MakeHashes<0>(1)));
+	RF_CHECK(IsPerfect(MakeHashes<1>(2)));
+	RF_CHECK(IsPerfect(MakeHashes<3>(3)));
+	RF_CHECK(IsPerfect(MakeHashes<100>(4)));
+	static_assert(Reflection::MakePerfectHashTable(MakeHashes<300>(5)).bValid);
+
+	// Two keys sharing a hash can't be told apart
+	std::array<std::uint64_t, 4> Duplicates = MakeHashes<4>(6);
+	Duplicates[3] = Duplicates[1];
+	RF_CHECK(!Reflection::MakePerfectHashTable(Duplicates).bValid);
+}
@@ -0,0 +1,22 @@
+/*!
+ *  @file TestMain.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Runs the test cases registered in a test executable.
+ */
+
+#include "TestHarness.h"
+
+int main()
+{
+	for (const Test::FTestCase& TestCase : Test::GetTestCases())
+	{
+		const int NumFailures = Test::GetNumFailures();
+		TestCase.Function();
+		std::printf("[%s] %s\n", Test::GetNumFailures() == NumFailures ? "  OK  " : "FAILED", TestCase.Name);
+	}
+
+	std::printf("%zu test cases, %d failed checks\n", Test::GetTestCases().size(), Test::GetNumFailures());
+	return Test::GetNumFailures() == 0 ? 0 : 1;
+}
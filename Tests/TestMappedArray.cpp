@@ -0,0 +1,128 @@
+/*!
+ *  @file TestMappedArray.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of memory-mapped layout arrays : round trip through a file, rejection of foreign, corrupted & truncated files.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutMappedArray.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace Test;
+
+namespace
+{
+	/** Same size as FFlat, other layout */
+	struct FSwapped
+	{
+		double Y = 0.0;
+		double X = 0.0;
+		double Z = 0.0;
+		std::uint32_t W = 0;
+	};
+
+	std::filesystem::path GetTempPath(const char* InName)
+	{
+		return std::filesystem::temp_directory_path() / InName;
+	}
+
+	std::vector<std::uint8_t> ReadFile(const std::filesystem::path& InPath)
+	{
+		std::ifstream File(InPath, std::ios::binary);
+		return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	}
+
+	std::vector<FFlat> MakeFlats(std::size_t InNum)
+	{
+		std::vector<FFlat> Flats(InNum);
+		for (std::size_t i = 0; i < InNum; ++i)
+			Flats[i] = FFlat{ double(i), -double(i), 0.5 * double(i), std::uint32_t(i * 3) };
+		return Flats;
+	}
+}
+
+RF_BEGIN_LAYOUT(FSwapped)
+	RF_ENTRY(Y),
+	RF_ENTRY(X),
+	RF_ENTRY(Z),
+	RF_ENTRY(W)
+RF_END_LAYOUT()
+
+RF_TEST(RoundTripFile)
+{
+	const std::filesystem::path Path = GetTempPath("rf_test_mapped_array.bin");
+	const std::vector<FFlat> Flats = MakeFlats(100);
+	RF_REQUIRE(Reflection::WriteLayoutArrayFile(Path, std::span<const FFlat>(Flats)));
+
+	{
+		Rf::TMappedLayoutArray<FFlat> Mapped;
+		RF_REQUIRE(Mapped.Open(Path) == Reflection::ELayoutArrayFileError::None);
+		RF_REQUIRE(Mapped.size() == Flats.size());
+		RF_CHECK(std::memcmp(Mapped.GetRecords().data(), Flats.data(), Flats.size() * sizeof(FFlat)) == 0);
+		RF_CHECK(reinterpret_cast<std::uintptr_t>(Mapped.begin()) % alignof(FFlat) == 0);
+
+		Rf::TMappedLayoutArray<FSwapped> Foreign;
+		RF_CHECK(Foreign.Open(Path) == Reflection::ELayoutArrayFileError::FingerprintMismatch);
+		RF_CHECK(!Foreign.IsValid());
+	}
+	std::filesystem::remove(Path);
+}
+
+RF_TEST(EmptyAndMissingFiles)
+{
+	const std::filesystem::path Path = GetTempPath("rf_test_mapped_array_empty.bin");
+	RF_REQUIRE(Reflection::WriteLayoutArrayFile(Path, std::span<const FFlat>()));
+	{
+		Rf::TMappedLayoutArray<FFlat> Mapped;
+		RF_CHECK(Mapped.Open(Path) == Reflection::ELayoutArrayFileError::None);
+		RF_CHECK(Mapped.empty());
+	}
+	std::filesystem::remove(Path);
+
+	Rf::TMappedLayoutArray<FFlat> Missing;
+	RF_CHECK(Missing.Open(GetTempPath("rf_test_mapped_array_missing.bin")) == Reflection::ELayoutArrayFileError::OpenFailed);
+}
+
+RF_TEST(CorruptedHeadersAreRejected)
+{
+	using ErrorType = Reflection::ELayoutArrayFileError;
+	using HeaderType = Reflection::FLayoutArrayFileHeader;
+
+	const std::filesystem::path Path = GetTempPath("rf_test_mapped_array_corrupt.bin");
+	const std::vector<FFlat> Flats = MakeFlats(10);
+	RF_REQUIRE(Reflection::WriteLayoutArrayFile(Path, std::span<const FFlat>(Flats)));
+	const std::vector<std::uint8_t> Bytes = ReadFile(Path);
+	std::filesystem::remove(Path);
+	RF_REQUIRE(Rf::TMappedLayoutArray<FFlat>::Validate(Bytes) == ErrorType::None);
+
+	auto ValidateWith = [&Bytes](auto&& InCorrupt)
+	{
+		std::vector<std::uint8_t> Corrupted = Bytes;
+		HeaderType Header;
+		std::memcpy(&Header, Corrupted.data(), sizeof(Header));
+		InCorrupt(Header, Corrupted);
+		std::memcpy(Corrupted.data(), &Header, sizeof(Header));
+		return Rf::TMappedLayoutArray<FFlat>::Validate(Corrupted);
+	};
+
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.Magic = 0x52464c41u; }) == ErrorType::BadMagic);
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.Version = 2; }) == ErrorType::BadVersion);
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.Fingerprint ^= 1; }) == ErrorType::FingerprintMismatch);
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.RecordSize = 16; }) == ErrorType::RecordMismatch);
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.DataOffset = 65; }) == ErrorType::RecordMismatch);
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.DataOffset = std::uint64_t(1) << 40; }) == ErrorType::Truncated);
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.NumRecords = 11; }) == ErrorType::Truncated);
+	RF_CHECK(ValidateWith([](HeaderType& InOut, auto&) { InOut.NumRecords = ~std::uint64_t(0); }) == ErrorType::Truncated);
+	RF_CHECK(ValidateWith([](HeaderType&, std::vector<std::uint8_t>& InOut) { InOut.pop_back(); }) == ErrorType::Truncated);
+
+	for (std::size_t Size = 0; Size < sizeof(HeaderType); ++Size)
+		RF_CHECK(Rf::TMappedLayoutArray<FFlat>::Validate(std::span<const std::uint8_t>(Bytes.data(), Size)) == ErrorType::Truncated);
+}
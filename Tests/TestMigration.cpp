@@ -0,0 +1,202 @@
+/*!
+ *  @file TestMigration.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of schema migration : widening round trip, unknown, truncated & inconsistent schemas, mismatched record buffers.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutMigration.h"
+
+#include <cstring>
+
+using namespace Test;
+
+namespace
+{
+	/** Previous version of FCurrent */
+	struct FPrevious
+	{
+		std::int32_t A = 0;
+		float B = 0.f;
+		std::int16_t C = 0;
+	};
+
+	struct FCurrent
+	{
+		std::int32_t A = 0;
+		double B = 0.0;
+		std::int64_t C = 0;
+		std::int32_t D = 7;
+	};
+
+	std::vector<std::uint8_t> SerializeSchema(const Reflection::FLayoutSchema& InSchema)
+	{
+		std::vector<std::uint8_t> Buffer;
+		Reflection::FBinaryWriter Writer(Buffer);
+		InSchema.Serialize(Writer);
+		return Buffer;
+	}
+
+	std::span<const std::uint8_t> AsBytes(const std::vector<FPrevious>& InRecords)
+	{
+		return std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(InRecords.data()), InRecords.size() * sizeof(FPrevious));
+	}
+
+	std::vector<FPrevious> MakePrevious(std::size_t InNum)
+	{
+		std::vector<FPrevious> Records(InNum);
+		for (std::size_t i = 0; i < InNum; ++i)
+			Records[i] = FPrevious{ static_cast<std::int32_t>(i), 0.5f * i, static_cast<std::int16_t>(-static_cast<int>(i)) };
+		return Records;
+	}
+}
+
+RF_BEGIN_LAYOUT(FPrevious)
+	RF_ENTRY(A),
+	RF_ENTRY(B),
+	RF_ENTRY(C)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FCurrent)
+	RF_ENTRY(A),
+	RF_ENTRY(B),
+	RF_ENTRY(C),
+	RF_ENTRY(D)
+RF_END_LAYOUT()
+
+RF_TEST(MigrateThroughSerializedSchema)
+{
+	const std::vector<std::uint8_t> Bytes = SerializeSchema(Reflection::MakeLayoutSchema<FPrevious>());
+	Reflection::FLayoutSchema Schema;
+	Reflection::FBinaryReader Reader(Bytes);
+	RF_REQUIRE(Schema.Deserialize(Reader));
+	RF_CHECK(Schema.GetFingerprint() == Reflection::GetLayoutFingerprint<FPrevious>());
+
+	// More than one batch
+	const std::vector<FPrevious> Source = MakePrevious(600);
+	std::vector<FCurrent> Result(Source.size());
+	RF_REQUIRE(Reflection::Migrate(Schema, AsBytes(Source), std::span<FCurrent>(Result)));
+	for (std::size_t i = 0; i < Source.size(); ++i)
+		RF_CHECK(Result[i].A == Source[i].A && Result[i].B == Source[i].B && Result[i].C == Source[i].C && Result[i].D == 7);
+
+	const Reflection::FLayoutMigrationPlan& Plan = Reflection::GetMigrationPlan<FCurrent>(Schema);
+	RF_CHECK(Plan.NumCopied == 1 && Plan.NumConverted == 2 && Plan.NumDefaulted == 1);
+
+	// Same layout : a single whole record copy
+	std::vector<FPrevious> Copies(Source.size());
+	RF_REQUIRE(Reflection::Migrate(Schema, AsBytes(Source), std::span<FPrevious>(Copies)));
+	RF_CHECK(std::memcmp(Copies.data(), Source.data(), Source.size() * sizeof(FPrevious)) == 0);
+}
+
+RF_TEST(UnknownOrTruncatedSchemaFails)
+{
+	const std::vector<std::uint8_t> Bytes = SerializeSchema(Reflection::MakeLayoutSchema<FPrevious>());
+	for (std::size_t Size = 0; Size < Bytes.size(); ++Size)
+	{
+		Reflection::FLayoutSchema Schema;
+		Reflection::FBinaryReader Reader(std::span<const std::uint8_t>(Bytes.data(), Size));
+		RF_CHECK(!Schema.Deserialize(Reader));
+	}
+
+	// Not a schema
+	std::vector<std::uint8_t> Unknown = Bytes;
+	Unknown[0] ^= 0xff;
+	Reflection::FLayoutSchema Schema;
+	Reflection::FBinaryReader Reader(Unknown);
+	RF_CHECK(!Schema.Deserialize(Reader));
+}
+
+RF_TEST(InconsistentSchemaIsRejected)
+{
+	const Reflection::FLayoutSchema Valid = Reflection::MakeLayoutSchema<FPrevious>();
+	RF_REQUIRE(Valid.IsValid());
+
+	auto DeserializeWith = [&Valid](auto&& InCorrupt)
+	{
+		Reflection::FLayoutSchema Corrupted = Valid;
+		InCorrupt(Corrupted);
+		const std::vector<std::uint8_t> Bytes = SerializeSchema(Corrupted);
+		Reflection::FLayoutSchema Result;
+		Reflection::FBinaryReader Reader(Bytes);
+		return Result.Deserialize(Reader);
+	};
+
+	RF_CHECK(!DeserializeWith([](Reflection::FLayoutSchema& InOut) { InOut.RecordSize = 0; }));
+	RF_CHECK(!DeserializeWith([](Reflection::FLayoutSchema& InOut) { InOut.RecordSize = -12; }));
+	RF_CHECK(!DeserializeWith([](Reflection::FLayoutSchema& InOut) { InOut.RecordAlignment = 3; }));
+	RF_CHECK(!DeserializeWith([](Reflection::FLayoutSchema& InOut) { InOut.Fields[1].Offset = -4; }));
+	RF_CHECK(!DeserializeWith([](Reflection::FLayoutSchema& InOut) { InOut.Fields[1].Offset = 1 << 20; }));
+	RF_CHECK(!DeserializeWith([](Reflection::FLayoutSchema& InOut) { InOut.Fields[2].Size = 1 << 30; }));
+	RF_CHECK(!DeserializeWith([](Reflection::FLayoutSchema& InOut) { InOut.Fields[2].Offset = 0x7fffffff; InOut.Fields[2].Size = 0x7fffffff; }));
+}
+
+RF_TEST(OutOfRecordLeavesAreDefaulted)
+{
+	// Built in memory, never validated : the plan must not read outside of the source records
+	Reflection::FLayoutSchema Schema = Reflection::MakeLayoutSchema<FPrevious>();
+	Schema.Fields[1].Offset = 1 << 20;
+	Schema.Fields[2].Size = 8;
+
+	const Reflection::FLayoutMigrationPlan Plan = Reflection::MakeMigrationPlan<FCurrent>(Schema);
+	RF_CHECK(Plan.NumCopied == 1 && Plan.NumConverted == 0 && Plan.NumDefaulted == 3);
+
+	const std::vector<FPrevious> Source = MakePrevious(10);
+	std::vector<FCurrent> Result(Source.size());
+	RF_REQUIRE(Reflection::Migrate(Schema, AsBytes(Source), std::span<FCurrent>(Result)));
+	for (std::size_t i = 0; i < Source.size(); ++i)
+		RF_CHECK(Result[i].A == Source[i].A && Result[i].B == 0.0 && Result[i].C == 0 && Result[i].D == 7);
+}
+
+RF_TEST(MismatchedRecordBuffersFail)
+{
+	const Reflection::FLayoutSchema Schema = Reflection::MakeLayoutSchema<FPrevious>();
+	const std::vector<FPrevious> Source = MakePrevious(10);
+	const std::span<const std::uint8_t> Bytes = AsBytes(Source);
+
+	std::vector<FCurrent> Result(Source.size() + 1);
+	RF_CHECK(!Reflection::Migrate(Schema, Bytes, std::span<FCurrent>(Result)));
+	RF_CHECK(!Reflection::Migrate(Schema, Bytes.first(Bytes.size() - 1), std::span<FCurrent>(Result).first(Source.size())));
+
+	const FCurrent Default{};
+	const Reflection::FLayoutMigrationPlan& Plan = Reflection::GetMigrationPlan<FCurrent>(Schema);
+	const std::span<std::uint8_t> Out = std::span<std::uint8_t>(reinterpret_cast<std::uint8_t*>(Result.data()), Result.size() * sizeof(FCurrent));
+	RF_CHECK(!Plan.Execute(Bytes, Out.first(Out.size() - 1), reinterpret_cast<const std::uint8_t*>(&Default)));
+	RF_CHECK(!Plan.Execute(Bytes, Out, reinterpret_cast<const std::uint8_t*>(&Default)));
+	RF_CHECK(Plan.Execute(Bytes, Out.first(Source.size() * sizeof(FCurrent)), reinterpret_cast<const std::uint8_t*>(&Default)));
+	RF_CHECK(Result[9].A == 9 && Result[9].D == 7);
+
+	Reflection::FLayoutSchema Invalid = Schema;
+	Invalid.RecordSize = 0;
+	RF_CHECK(!Reflection::Migrate(Invalid, Bytes, std::span<FCurrent>(Result)));
+}
+
+RF_TEST(StepsStayWithinRecords)
+{
+	const Reflection::FLayoutMigrationPlan& Plan = Reflection::GetMigrationPlan<FCurrent>(Reflection::MakeLayoutSchema<FPrevious>());
+	for (const Reflection::FMigrationStep& Step : Plan.Steps)
+		RF_CHECK(Plan.IsInRecords(Step));
+
+	const std::vector<FPrevious> Source = MakePrevious(4);
+	std::vector<FCurrent> Result(Source.size());
+	const std::span<std::uint8_t> Out(reinterpret_cast<std::uint8_t*>(Result.data()), Result.size() * sizeof(FCurrent));
+	const FCurrent Default{};
+
+	// Hand-built plans reading or writing past a record are rejected before any copy
+	Reflection::FLayoutMigrationPlan Broken = Plan;
+	Broken.Steps.push_back(Reflection::FMigrationStep{ 8, 0, static_cast<std::int32_t>(sizeof(FPrevious)), nullptr });
+	RF_CHECK(!Broken.Execute(AsBytes(Source), Out, reinterpret_cast<const std::uint8_t*>(&Default)));
+	Broken = Plan;
+	Broken.Steps.push_back(Reflection::FMigrationStep{ 0, static_cast<std::int32_t>(sizeof(FCurrent)) - 2, 4, nullptr });
+	RF_CHECK(!Broken.Execute(AsBytes(Source), Out, reinterpret_cast<const std::uint8_t*>(&Default)));
+	Broken = Plan;
+	Broken.Steps.push_back(Reflection::FMigrationStep{ -4, 0, 4, nullptr });
+	RF_CHECK(!Broken.Execute(AsBytes(Source), Out, reinterpret_cast<const std::uint8_t*>(&Default)));
+	RF_CHECK(Result[3].A == 0 && Result[3].B == 0.0);
+
+	RF_CHECK(Plan.Execute(AsBytes(Source), Out, reinterpret_cast<const std::uint8_t*>(&Default)));
+	RF_CHECK(Result[3].A == 3 && Result[3].D == 7);
+}
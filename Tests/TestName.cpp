@@ -0,0 +1,82 @@
+/*!
+ *  @file TestName.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of interned names, including concurrent interning.
+ */
+
+#include "TestHarness.h"
+
+#include "Core/Name.h"
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::wstring MakeNameString(const wchar_t* InPrefix, int InIndex)
+	{
+		return std::wstring(InPrefix) + std::to_wstring(InIndex);
+	}
+}
+
+RF_TEST(InternAndResolve)
+{
+	const FName A(L"TestName.Alpha");
+	const FName B(std::wstring(L"TestName.Alpha"));
+	const FName C(L"TestName.Beta");
+	RF_CHECK(A == B && A != C);
+	RF_CHECK(!A.IsNone() && A.ToStringView() == L"TestName.Alpha");
+	RF_CHECK(FName::Find(L"TestName.Beta") == C);
+	RF_CHECK(FName::Find(L"TestName.NeverAdded").IsNone());
+	RF_CHECK(FName(L"").IsNone() && FName().ToStringView().empty());
+}
+
+RF_TEST(ConcurrentInterning)
+{
+	// Enough names to grow the slot tables of every shard & fill more than one entry chunk per shard
+	constexpr int NumNames = 1 << 17;
+	constexpr int NumThreads = 8;
+	std::vector<std::vector<std::uint32_t>> Indices(NumThreads, std::vector<std::uint32_t>(NumNames));
+	std::atomic<int> NumReady = 0;
+	std::atomic<bool> bResolveFailed = false;
+
+	std::vector<std::thread> Threads;
+	for (int Thread = 0; Thread < NumThreads; ++Thread)
+	{
+		Threads.emplace_back([&, Thread]()
+		{
+			++NumReady;
+			while (NumReady.load() < NumThreads)
+				std::this_thread::yield();
+
+			// Each thread walks the names in a different order (odd strides over a power of two), resolving while others add
+			for (int i = 0; i < NumNames; ++i)
+			{
+				const int Name = static_cast<int>((static_cast<std::int64_t>(i) * (2 * Thread + 1) + Thread * 977) % NumNames);
+				const std::wstring String = MakeNameString(L"Concurrent.", Name);
+				const FName Interned(String);
+				Indices[Thread][Name] = Interned.GetIndex();
+				if (Interned.ToStringView() != String)
+					bResolveFailed = true;
+			}
+		});
+	}
+	for (std::thread& Thread : Threads)
+		Thread.join();
+
+	RF_CHECK(!bResolveFailed);
+	std::set<std::uint32_t> Distinct;
+	for (int Name = 0; Name < NumNames; ++Name)
+	{
+		for (int Thread = 1; Thread < NumThreads; ++Thread)
+			RF_CHECK(Indices[Thread][Name] == Indices[0][Name]);
+		Distinct.insert(Indices[0][Name]);
+	}
+	RF_CHECK(Distinct.size() == NumNames && Distinct.count(0) == 0);
+	RF_CHECK(FName::Find(MakeNameString(L"Concurrent.", NumNames / 2)).GetIndex() == Indices[0][NumNames / 2]);
+}
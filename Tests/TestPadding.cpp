@@ -0,0 +1,131 @@
+/*!
+ *  @file TestPadding.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of the padding analysis : holes & tail padding, nesting levels & arrays, optimal order, runtime reports.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutPaddingReport.h"
+
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Test;
+
+namespace
+{
+	/** 24 bytes, 16 when reordered */
+	struct FPadded
+	{
+		std::uint8_t A = 0;
+		double B = 0.0;
+		std::uint8_t C = 0;
+	};
+
+	/** Padded layouts nested, alone & in a fixed array */
+	struct FOuter
+	{
+		FPadded Inner[2];
+		std::int32_t X = 0;
+		FPadded Single;
+		std::uint8_t Y = 0;
+	};
+
+	/** Hidden is not reflected */
+	struct FPartlyReflected
+	{
+		std::int32_t Visible = 0;
+		std::int32_t Hidden = 0;
+	};
+}
+
+RF_BEGIN_LAYOUT(FPadded)
+	RF_ENTRY(A),
+	RF_ENTRY(B),
+	RF_ENTRY(C)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FOuter)
+	RF_ENTRY(Inner),
+	RF_ENTRY(X),
+	RF_ENTRY(Single),
+	RF_ENTRY(Y)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FPartlyReflected)
+	RF_ENTRY(Visible)
+RF_END_LAYOUT()
+
+RF_TEST(DirectPadding)
+{
+	using Padding = Reflection::TLayoutPadding<FPadded>;
+	static_assert(Padding::Size == 24 && Padding::NumMembers == 3);
+	static_assert(Padding::DirectPadding == 14 && Padding::TailPadding == 7 && Padding::NestedPadding == 0 && Padding::TotalPadding == 14);
+	static_assert(Padding::OptimalOrder == std::array<std::int32_t, 3>{ 1, 0, 2 } && Padding::OptimalSize == 16 && Padding::SavableBytes == 8);
+	static_assert(!Reflection::TIsPaddingFree<FPadded>::Value && !Reflection::TIsOptimallyOrdered<FPadded>::Value);
+
+	static_assert(Reflection::TIsPaddingFree<FVector>::Value && Reflection::TIsOptimallyOrdered<FVector>::Value);
+	static_assert(Reflection::TLayoutPadding<FFlat>::TotalPadding == 4 && Reflection::TLayoutPadding<FFlat>::TailPadding == 4);
+	static_assert(Reflection::TIsOptimallyOrdered<FFlat>::Value);
+
+	// Unreflected members can't be told from padding
+	static_assert(Reflection::TLayoutPadding<FPartlyReflected>::DirectPadding == 4 && Reflection::TLayoutPadding<FPartlyReflected>::TailPadding == 4);
+	RF_CHECK(Reflection::TLayoutPadding<FPadded>::Members[1].Offset == 8);
+}
+
+RF_TEST(NestedPadding)
+{
+	// Inner[2] 0..48, X 48..52, Single 56..80, Y 80..81, size 88
+	using Padding = Reflection::TLayoutPadding<FOuter>;
+	static_assert(Padding::Size == 88 && Padding::DirectPadding == 11 && Padding::TailPadding == 7);
+	static_assert(Padding::NestedPadding == 3 * 14 && Padding::TotalPadding == 11 + 42);
+	static_assert(Padding::NumDepths == 2 && Padding::PaddingPerDepth == std::array<std::int32_t, 2>{ 11, 42 });
+	static_assert(Reflection::GetPaddingBytes<FPadded[3]>() == 42 && Reflection::GetPaddingBytes<double>() == 0);
+
+	// Inner[2], Single, X, Y: 48 + 24 + 4 + 1, aligned to 8
+	static_assert(Padding::OptimalOrder == std::array<std::int32_t, 4>{ 0, 2, 1, 3 } && Padding::OptimalSize == 80);
+	RF_CHECK(Padding::SavableBytes == 8);
+}
+
+RF_TEST(RuntimeReportMatches)
+{
+	const Reflection::FPaddingReport Report = Reflection::AnalyzePadding(Reflection::GetLayoutDescriptor<FOuter>());
+	using Padding = Reflection::TLayoutPadding<FOuter>;
+	RF_CHECK(Report.DirectPadding == Padding::DirectPadding && Report.TailPadding == Padding::TailPadding && Report.TotalPadding == Padding::TotalPadding);
+	RF_CHECK(Report.OptimalSize == Padding::OptimalSize && Report.GetSavableBytes() == Padding::SavableBytes);
+	RF_CHECK(Report.OptimalOrder == std::vector<std::int32_t>(Padding::OptimalOrder.begin(), Padding::OptimalOrder.end()));
+	RF_CHECK(Report.PaddingPerDepth == std::vector<std::int32_t>(Padding::PaddingPerDepth.begin(), Padding::PaddingPerDepth.end()));
+
+	// Trailing levels without padding are dropped
+	RF_CHECK(Reflection::AnalyzePadding(Reflection::GetLayoutDescriptor<FVector>()).PaddingPerDepth == std::vector<std::int32_t>{ 0 });
+
+	// Registered layouts, most padded first
+	const std::vector<Reflection::FPaddingReport> Reports = Reflection::AnalyzeRegisteredPadding();
+	RF_REQUIRE(!Reports.empty());
+	RF_CHECK(Reports[0].Descriptor == &Reflection::GetLayoutDescriptor<FOuter>());
+	for (std::size_t i = 1; i < Reports.size(); ++i)
+		RF_CHECK(Reports[i - 1].TotalPadding >= Reports[i].TotalPadding);
+}
+
+RF_TEST(WritesReport)
+{
+	std::wostringstream Stream;
+	Reflection::WritePaddingReport(Stream, Reflection::AnalyzePadding(Reflection::GetLayoutDescriptor<FPadded>()));
+	const std::wstring Text = Stream.str();
+	RF_CHECK(Text.find(L"FPadded: 24 bytes, align 8, 14 padding bytes (58%)") == 0);
+	RF_CHECK(Text.find(L"+8\tB (8 bytes), 7 padding bytes before") != std::wstring::npos);
+	RF_CHECK(Text.find(L"7 tail padding bytes") != std::wstring::npos);
+	RF_CHECK(Text.find(L"reordering saves 8 bytes (16 bytes): B A C") != std::wstring::npos);
+
+	// Nothing to list without holes
+	std::wostringstream Packed;
+	Reflection::WritePaddingReport(Packed, Reflection::AnalyzePadding(Reflection::GetLayoutDescriptor<FVector>()));
+	RF_CHECK(Packed.str() == L"Test::FVector: 12 bytes, align 4, 0 padding bytes (0%)\n  level 0: 0 bytes\n");
+}
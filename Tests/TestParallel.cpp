@@ -0,0 +1,184 @@
+/*!
+ *  @file TestParallel.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of the work-stealing pool & parallel layout iteration : every item exactly once, nested loops, per-worker reductions.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutParallel.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+using namespace Test;
+
+namespace
+{
+	/** Nested layout, 16 bytes: several objects per cache line */
+	struct FParticle
+	{
+		FVector Position;
+		std::uint32_t Id = 0;
+	};
+
+	/** Run a loop, counting how many times each item was processed */
+	bool ProcessesEveryItemOnce(FWorkStealingPool& InPool, std::int64_t InNum, std::int64_t InGrain)
+	{
+		std::unique_ptr<std::atomic<int>[]> Counts(new std::atomic<int>[static_cast<std::size_t>(InNum > 0 ? InNum : 1)]());
+		std::atomic<bool> bInvalid = false;
+		InPool.ParallelFor(InNum, InGrain, [&](std::int64_t InBegin, std::int64_t InEnd, std::int32_t InWorkerIndex)
+		{
+			if (InBegin < 0 || InEnd > InNum || InBegin >= InEnd || InWorkerIndex < 0 || InWorkerIndex >= InPool.GetNumWorkers())
+				bInvalid = true;
+			for (std::int64_t i = InBegin; i < InEnd && !bInvalid; ++i)
+				++Counts[i];
+		});
+
+		bool bResult = !bInvalid;
+		for (std::int64_t i = 0; i < InNum; ++i)
+			bResult = bResult && Counts[i] == 1;
+		return bResult;
+	}
+}
+
+RF_BEGIN_LAYOUT(FParticle)
+	RF_ENTRY(Position),
+	RF_ENTRY(Id)
+RF_END_LAYOUT()
+
+RF_TEST(ParallelForCoversEveryItem)
+{
+	FWorkStealingPool Pool(3);
+	RF_CHECK(Pool.GetNumWorkers() == 4);
+
+	// Empty, single chunk, fewer chunks than workers, uneven last chunk, many chunks to steal
+	const std::int64_t Sizes[][2] = { { 0, 1 }, { 1, 1 }, { 7, 8 }, { 3, 1 }, { 10, 3 }, { 1001, 7 }, { 100000, 1 }, { 100000, 0 } };
+	for (const auto& Size : Sizes)
+		RF_CHECK(ProcessesEveryItemOnce(Pool, Size[0], Size[1]));
+
+	// Back to back loops reuse the workers
+	for (int i = 0; i < 200; ++i)
+		RF_CHECK(ProcessesEveryItemOnce(Pool, 64 + i, 4));
+
+	// Without background threads, the calling thread does all the work
+	FWorkStealingPool Inline(0);
+	RF_CHECK(Inline.GetNumWorkers() == 1 && ProcessesEveryItemOnce(Inline, 1000, 10));
+}
+
+RF_TEST(NestedLoopsRunInline)
+{
+	FWorkStealingPool Pool(3);
+	constexpr std::int64_t NumOuter = 64;
+	constexpr std::int64_t NumInner = 100;
+	std::vector<std::atomic<int>> Counts(NumOuter * NumInner);
+	std::atomic<bool> bOtherWorker = false;
+
+	Pool.ParallelFor(NumOuter, 1, [&](std::int64_t InBegin, std::int64_t InEnd, std::int32_t InWorkerIndex)
+	{
+		for (std::int64_t Outer = InBegin; Outer < InEnd; ++Outer)
+		{
+			Pool.ParallelFor(NumInner, 1, [&](std::int64_t InInnerBegin, std::int64_t InInnerEnd, std::int32_t InInnerWorkerIndex)
+			{
+				if (InInnerWorkerIndex != InWorkerIndex)
+					bOtherWorker = true;
+				for (std::int64_t Inner = InInnerBegin; Inner < InInnerEnd; ++Inner)
+					++Counts[Outer * NumInner + Inner];
+			});
+		}
+	});
+
+	RF_CHECK(!bOtherWorker);
+	for (const std::atomic<int>& Count : Counts)
+		RF_CHECK(Count == 1);
+}
+
+RF_TEST(GrainSpansCacheLines)
+{
+	static_assert(Reflection::GetParallelGrain<FFlat>() * sizeof(FFlat) % Reflection::CacheLineSize == 0);
+	static_assert(Reflection::GetParallelGrain<FParticle>() * sizeof(FParticle) % Reflection::CacheLineSize == 0);
+	static_assert(Reflection::GetParallelGrain<FVector>() * sizeof(FVector) % Reflection::CacheLineSize == 0);
+	static_assert(Reflection::GetParallelGrain<FVector>() * sizeof(FVector) >= Reflection::MinParallelChunkSize);
+	RF_CHECK(Reflection::GetParallelGrain<FFlat>() * sizeof(FFlat) < Reflection::MinParallelChunkSize + Reflection::CacheLineSize);
+}
+
+RF_TEST(ParallelIterateWritesEveryObject)
+{
+	FWorkStealingPool Pool(3);
+
+	// Several chunks per worker, the last one partial
+	const std::size_t NumObjects = 9 * Reflection::GetParallelGrain<FParticle>() + 5;
+	std::vector<FParticle> Particles(NumObjects);
+	for (std::size_t i = 0; i < NumObjects; ++i)
+		Particles[i] = FParticle{ FVector{ 1.f * i, 2.f, 3.f }, static_cast<std::uint32_t>(i) };
+
+	// Doubles the floats of the nested layout, skips Id
+	Reflection::ParallelIterateLayout<FParticle>(std::span<FParticle>(Particles), [](const auto&, const auto& InField, const Rf::FLayoutFieldView& InView)
+	{
+		using FieldType = typename std::decay_t<decltype(InField)>::Type;
+		if constexpr (std::is_same_v<FieldType, float>)
+			InView.Get(InField) *= 2.f;
+		else if constexpr (std::is_same_v<FieldType, std::uint32_t>)
+			InView.Get(InField) += 1;
+		return Reflection::EFieldIterator::Enter;
+	}, Pool);
+
+	for (std::size_t i = 0; i < NumObjects; ++i)
+	{
+		const FParticle& Particle = Particles[i];
+		RF_CHECK(Particle.Position.X == 2.f * i && Particle.Position.Y == 4.f && Particle.Position.Z == 6.f && Particle.Id == i + 1);
+	}
+
+	// Stop skips the nested fields
+	Reflection::ParallelIterateLayout<FParticle>(std::span<FParticle>(Particles), [](const auto&, const auto& InField, const Rf::FLayoutFieldView& InView)
+	{
+		using FieldType = typename std::decay_t<decltype(InField)>::Type;
+		if constexpr (std::is_same_v<FieldType, float>)
+			InView.Get(InField) = 0.f;
+		return std::is_same_v<FieldType, FVector> ? Reflection::EFieldIterator::Stop : Reflection::EFieldIterator::Enter;
+	}, Pool);
+	RF_CHECK(Particles[NumObjects - 1].Position.X == 2.f * (NumObjects - 1));
+}
+
+RF_TEST(ParallelIterateReduces)
+{
+	FWorkStealingPool Pool(3);
+	const std::size_t NumObjects = 7 * Reflection::GetParallelGrain<FFlat>() + 3;
+	std::vector<FFlat> Objects(NumObjects);
+	std::uint64_t Expected = 0;
+	for (std::size_t i = 0; i < NumObjects; ++i)
+	{
+		Objects[i].W = static_cast<std::uint32_t>(i);
+		Expected += i;
+	}
+
+	struct FState
+	{
+		std::uint64_t Sum = 0;
+		std::uint64_t NumDoubles = 0;
+	};
+	const FState Result = Reflection::ParallelIterateLayout<const FFlat>(std::span<const FFlat>(Objects), FState{},
+		[](const auto&, const auto& InField, const Rf::FLayoutFieldConstView& InView, FState& OutState)
+		{
+			using FieldType = typename std::decay_t<decltype(InField)>::Type;
+			if constexpr (std::is_same_v<FieldType, std::uint32_t>)
+				OutState.Sum += InView.Get(InField);
+			else
+				++OutState.NumDoubles;
+			return Reflection::EFieldIterator::Enter;
+		},
+		[](const FState& InA, const FState& InB) { return FState{ InA.Sum + InB.Sum, InA.NumDoubles + InB.NumDoubles }; }, Pool);
+	RF_CHECK(Result.Sum == Expected && Result.NumDoubles == 3 * NumObjects);
+
+	// Nothing to iterate: the initial state
+	const FState Empty = Reflection::ParallelIterateLayout<const FFlat>(std::span<const FFlat>(), FState{ 5, 0 },
+		[](const auto&, const auto&, const Rf::FLayoutFieldConstView&, FState&) { return Reflection::EFieldIterator::Enter; },
+		[](const FState& InA, const FState&) { return InA; }, Pool);
+	RF_CHECK(Empty.Sum == 5);
+}
@@ -0,0 +1,244 @@
+/*!
+ *  @file TestPool.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of pools & arenas : over-aligned types, stale handles, destruction order & reuse after reset, throwing constructors & invalid array lengths.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutPool.h"
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+using namespace Test;
+
+namespace
+{
+	struct alignas(256) FOverAligned
+	{
+		std::int32_t A = 1;
+		float B = 2.f;
+	};
+
+	struct alignas(4096) FPageAligned
+	{
+		std::int32_t A = 3;
+	};
+
+	/** Records its destruction order */
+	struct FTracked
+	{
+		std::int32_t Id = 0;
+		std::vector<std::int32_t>* Destroyed = nullptr;
+
+		~FTracked()
+		{
+			if (Destroyed != nullptr)
+				Destroyed->push_back(Id);
+		}
+	};
+
+	/** Throws from its constructor on demand */
+	struct FThrowing
+	{
+		static inline bool bThrowOnDefault = false;
+
+		std::int32_t Value = 0;
+
+		FThrowing()
+		{
+			if (bThrowOnDefault)
+				throw std::runtime_error("FThrowing");
+		}
+
+		explicit FThrowing(std::int32_t InValue)
+			: Value(InValue)
+		{
+			if (InValue < 0)
+				throw std::runtime_error("FThrowing");
+		}
+	};
+
+	/** Too large for any array of more than a few thousand elements */
+	struct FHuge
+	{
+		char Data[std::size_t(1) << 40];
+	};
+
+	bool IsAligned(const void* InAddress, std::size_t InAlignment)
+	{
+		return reinterpret_cast<std::uintptr_t>(InAddress) % InAlignment == 0;
+	}
+}
+
+RF_BEGIN_LAYOUT(FOverAligned)
+	RF_ENTRY(A),
+	RF_ENTRY(B)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FPageAligned)
+	RF_ENTRY(A)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(FThrowing)
+	RF_ENTRY(Value)
+RF_END_LAYOUT()
+
+RF_TEST(ArenaOverAlignedTypes)
+{
+	// Small blocks, so that over-aligned objects land at various offsets of several blocks
+	Rf::FLayoutArena Arena(1024);
+	for (int Pass = 0; Pass < 2; ++Pass)
+	{
+		for (int i = 0; i < 64; ++i)
+		{
+			Arena.New<std::uint8_t>(static_cast<std::uint8_t>(i));
+			FOverAligned& OverAligned = Arena.New<FOverAligned>();
+			RF_CHECK(IsAligned(&OverAligned, 256) && OverAligned.A == 1 && OverAligned.B == 2.f);
+			if (i % 8 == 0)
+			{
+				FPageAligned& PageAligned = Arena.New<FPageAligned>();
+				RF_CHECK(IsAligned(&PageAligned, 4096) && PageAligned.A == 3);
+			}
+
+			const std::span<FOverAligned> Array = Arena.NewArray<FOverAligned>(3);
+			RF_CHECK(IsAligned(Array.data(), 256) && Array[2].A == 1);
+
+			const Rf::FLayoutFieldView View = Arena.New(Reflection::GetLayoutDescriptor<FOverAligned>());
+			RF_CHECK(IsAligned(View.GetData().data(), 256) && View.GetData().size() == sizeof(FOverAligned));
+		}
+		// Reused blocks must keep honoring alignments
+		Arena.Reset();
+		RF_CHECK(Arena.GetUsedBytes() == 0);
+	}
+}
+
+RF_TEST(ArenaDestroysInReverseOrder)
+{
+	std::vector<std::int32_t> Destroyed;
+	{
+		Rf::FLayoutArena Arena;
+		for (std::int32_t i = 0; i < 4; ++i)
+			Arena.New<FTracked>(FTracked{ i, nullptr }).Destroyed = &Destroyed;
+		Arena.New<std::uint32_t>(7u);
+
+		Arena.Reset();
+		RF_CHECK((Destroyed == std::vector<std::int32_t>{ 3, 2, 1, 0 }));
+
+		Arena.New<FTracked>(FTracked{ 9, nullptr }).Destroyed = &Destroyed;
+	}
+	RF_CHECK(Destroyed.size() == 5 && Destroyed.back() == 9);
+}
+
+RF_TEST(PoolOverAlignedTypes)
+{
+	Rf::TLayoutPool<FOverAligned> Pool;
+	std::vector<Rf::FLayoutPoolHandle> Handles;
+	Pool.AllocateBulk(300, Handles);
+	for (const Rf::FLayoutPoolHandle Handle : Handles)
+	{
+		const FOverAligned* Object = Pool.Find(Handle);
+		RF_REQUIRE(Object != nullptr);
+		RF_CHECK(IsAligned(Object, 256) && Object->A == 1);
+	}
+
+	Rf::FLayoutPool ErasedPool(Reflection::GetLayoutDescriptor<FPageAligned>());
+	for (int i = 0; i < 20; ++i)
+	{
+		const Rf::FLayoutPoolHandle Handle = ErasedPool.Allocate();
+		RF_CHECK(IsAligned(ErasedPool.Find(Handle), 4096));
+		RF_CHECK(ErasedPool.GetView(Handle).Cast<FPageAligned>().A == 3);
+	}
+}
+
+RF_TEST(PoolStaleHandles)
+{
+	Rf::TLayoutPool<FFlat> Pool;
+	const Rf::FLayoutPoolHandle First = Pool.Emplace(FFlat{ 1.0, 2.0, 3.0, 4 });
+	RF_CHECK(Pool.Free(First));
+	RF_CHECK(!Pool.Free(First) && Pool.Find(First) == nullptr && !Pool.GetView(First).IsValid());
+
+	// Same slot, new generation : the old handle stays stale
+	const Rf::FLayoutPoolHandle Second = Pool.Emplace();
+	RF_CHECK(Second.Index == First.Index && Second.Generation != First.Generation);
+	RF_CHECK(Pool.Find(First) == nullptr && Pool.Find(Second) != nullptr);
+
+	RF_CHECK(Pool.Find(Rf::FLayoutPoolHandle{}) == nullptr);
+	RF_CHECK(Pool.Find(Rf::FLayoutPoolHandle{ 1u << 30, 1 }) == nullptr);
+	RF_CHECK(Pool.Num() == 1);
+}
+
+RF_TEST(PoolConstructorThrows)
+{
+	Rf::TLayoutPool<FThrowing> Pool;
+	const Rf::FLayoutPoolHandle First = Pool.Emplace(1);
+	bool bThrown = false;
+	try
+	{
+		Pool.Emplace(-1);
+	}
+	catch (const std::runtime_error&)
+	{
+		bThrown = true;
+	}
+
+	// The slot was given back, never seen alive
+	RF_CHECK(bThrown && Pool.Num() == 1);
+	int NumVisited = 0;
+	Pool.ForEach([&NumVisited](Rf::FLayoutPoolHandle, FThrowing& InObject) { NumVisited += InObject.Value; });
+	RF_CHECK(NumVisited == 1);
+	const Rf::FLayoutPoolHandle Second = Pool.Emplace(2);
+	RF_CHECK(Second.Index == First.Index + 1 && Pool.Find(Second)->Value == 2 && Pool.Num() == 2);
+
+	// Same through type-erased operations
+	Rf::FLayoutPool ErasedPool(Reflection::GetLayoutDescriptor<FThrowing>());
+	FThrowing::bThrowOnDefault = true;
+	bThrown = false;
+	try
+	{
+		ErasedPool.Allocate();
+	}
+	catch (const std::runtime_error&)
+	{
+		bThrown = true;
+	}
+	FThrowing::bThrowOnDefault = false;
+	RF_CHECK(bThrown && ErasedPool.Num() == 0);
+	const Rf::FLayoutPoolHandle Allocated = ErasedPool.Allocate();
+	RF_CHECK(ErasedPool.Num() == 1 && ErasedPool.Find(Allocated) != nullptr);
+}
+
+RF_TEST(ArenaArrayLengths)
+{
+	Rf::FLayoutArena Arena;
+	const std::span<FFlat> Flats = Arena.NewArray<FFlat>(5);
+	RF_CHECK(Flats.size() == 5 && Flats[4].X == 0.0 && Flats[4].W == 0);
+	RF_CHECK(Arena.NewArray<std::int32_t>(0).empty());
+
+	// Negative & overflowing lengths are rejected before allocating
+	const std::size_t UsedBytes = Arena.GetUsedBytes();
+	int NumThrown = 0;
+	try
+	{
+		Arena.NewArray<std::int32_t>(-1);
+	}
+	catch (const std::bad_array_new_length&)
+	{
+		++NumThrown;
+	}
+	try
+	{
+		Arena.NewArray<FHuge>(std::numeric_limits<std::int32_t>::max());
+	}
+	catch (const std::bad_array_new_length&)
+	{
+		++NumThrown;
+	}
+	RF_CHECK(NumThrown == 2 && Arena.GetUsedBytes() == UsedBytes);
+}
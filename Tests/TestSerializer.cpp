@@ -0,0 +1,143 @@
+/*!
+ *  @file TestSerializer.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of the binary serializer : round trips, truncated & corrupted streams.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutSerializer.h"
+
+#include <cstring>
+#include <limits>
+
+using namespace Test;
+
+namespace
+{
+	std::vector<std::uint8_t> SerializeRecord(const FRecord& InRecord)
+	{
+		std::vector<std::uint8_t> Buffer;
+		Reflection::FBinaryWriter Writer(Buffer);
+		Reflection::Serialize(InRecord, Writer);
+		return Buffer;
+	}
+
+	/** Offset of the element count of FRecord::Samples, past Id, Position, Health & Name */
+	std::size_t GetSamplesCountOffset(const FRecord& InRecord)
+	{
+		return sizeof(std::int32_t) + sizeof(FVector) + sizeof(double) + sizeof(std::uint32_t) + InRecord.Name.size();
+	}
+}
+
+RF_TEST(RoundTripFlat)
+{
+	const FFlat Source{ 1.0, -2.5, 3.25, 42 };
+	std::vector<std::uint8_t> Buffer;
+	Reflection::FBinaryWriter Writer(Buffer);
+	Reflection::Serialize(Source, Writer);
+	RF_CHECK(Buffer.size() == 3 * sizeof(double) + sizeof(std::uint32_t));
+
+	FFlat Result;
+	Reflection::FBinaryReader Reader(Buffer);
+	RF_REQUIRE(Reflection::Deserialize(Result, Reader));
+	RF_CHECK(Result.X == Source.X && Result.Y == Source.Y && Result.Z == Source.Z && Result.W == Source.W);
+	RF_CHECK(Reader.Remaining() == 0 && !Reader.HasError());
+}
+
+RF_TEST(RoundTripRecordSkipsTransient)
+{
+	const FRecord Source = MakeRecord(7);
+	const std::vector<std::uint8_t> Buffer = SerializeRecord(Source);
+
+	FRecord Result;
+	Result.Cache = 1234;
+	Result.Samples = { 9, 9, 9, 9, 9, 9 };
+	Reflection::FBinaryReader Reader(Buffer);
+	RF_REQUIRE(Reflection::Deserialize(Result, Reader));
+	RF_CHECK(HaveSameState(Result, Source));
+	RF_CHECK(Result.Cache == 1234);
+	RF_CHECK(Reader.Remaining() == 0);
+}
+
+RF_TEST(RoundTripArrays)
+{
+	std::vector<FRecord> Records;
+	for (std::int32_t i = 0; i < 17; ++i)
+		Records.push_back(MakeRecord(i));
+	std::vector<FFlat> Flats(33);
+	for (std::size_t i = 0; i < Flats.size(); ++i)
+		Flats[i] = FFlat{ double(i), double(i) * 2.0, double(i) * 3.0, std::uint32_t(i) };
+
+	std::vector<std::uint8_t> Buffer;
+	Reflection::FBinaryWriter Writer(Buffer);
+	Reflection::SerializeArray(std::span<const FRecord>(Records), Writer);
+	Reflection::SerializeArray(std::span<const FFlat>(Flats), Writer);
+
+	std::vector<FRecord> RecordResults(Records.size());
+	std::vector<FFlat> FlatResults(Flats.size());
+	Reflection::FBinaryReader Reader(Buffer);
+	RF_REQUIRE(Reflection::DeserializeArray(std::span<FRecord>(RecordResults), Reader));
+	RF_REQUIRE(Reflection::DeserializeArray(std::span<FFlat>(FlatResults), Reader));
+	for (std::size_t i = 0; i < Records.size(); ++i)
+		RF_CHECK(HaveSameState(RecordResults[i], Records[i]));
+	for (std::size_t i = 0; i < Flats.size(); ++i)
+		RF_CHECK(FlatResults[i].X == Flats[i].X && FlatResults[i].Y == Flats[i].Y && FlatResults[i].Z == Flats[i].Z && FlatResults[i].W == Flats[i].W);
+}
+
+RF_TEST(TruncatedStreamFails)
+{
+	const FRecord Source = MakeRecord(3);
+	const std::vector<std::uint8_t> Buffer = SerializeRecord(Source);
+
+	// Every strict prefix of a valid stream is rejected, without reading past its end
+	for (std::size_t Size = 0; Size < Buffer.size(); ++Size)
+	{
+		const std::vector<std::uint8_t> Truncated(Buffer.begin(), Buffer.begin() + Size);
+		FRecord Result;
+		Reflection::FBinaryReader Reader(Truncated);
+		RF_CHECK(!Reflection::Deserialize(Result, Reader));
+	}
+}
+
+RF_TEST(CorruptedCountsFail)
+{
+	const FRecord Source = MakeRecord(5);
+	const std::uint32_t HugeCount = std::numeric_limits<std::uint32_t>::max();
+
+	// String length past the end of the stream
+	std::vector<std::uint8_t> Buffer = SerializeRecord(Source);
+	std::memcpy(Buffer.data() + sizeof(std::int32_t) + sizeof(FVector) + sizeof(double), &HugeCount, sizeof(HugeCount));
+	{
+		FRecord Result;
+		Reflection::FBinaryReader Reader(Buffer);
+		RF_CHECK(!Reflection::Deserialize(Result, Reader));
+	}
+
+	// Array count past the end of the stream, must fail before allocating
+	Buffer = SerializeRecord(Source);
+	std::memcpy(Buffer.data() + GetSamplesCountOffset(Source), &HugeCount, sizeof(HugeCount));
+	{
+		FRecord Result;
+		Reflection::FBinaryReader Reader(Buffer);
+		RF_CHECK(!Reflection::Deserialize(Result, Reader));
+		RF_CHECK(Result.Samples.capacity() < 1024);
+	}
+}
+
+RF_TEST(ReaderStaysFailed)
+{
+	const std::uint8_t Bytes[4] = { 1, 2, 3, 4 };
+	Reflection::FBinaryReader Reader(Bytes);
+	std::uint64_t Wide = 0;
+	RF_CHECK(!Reader.ReadValue(Wide));
+	RF_CHECK(Reader.HasError());
+
+	// Once failed, reads that would fit are rejected too
+	std::uint8_t Byte = 0;
+	RF_CHECK(!Reader.ReadValue(Byte));
+	RF_CHECK(Reader.Tell() == 0);
+}
@@ -0,0 +1,94 @@
+/*!
+ *  @file TestShapes.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Reflected struct shapes shared by the tests : flat, nested, with containers & strings, with transient state
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Reflection/FieldTags.h"
+#include "Reflection/Layout.h"
+
+namespace Test
+{
+	/** Flat struct, mirrors FooStruct */
+	struct FFlat
+	{
+		double X = 0.0;
+		double Y = 0.0;
+		double Z = 0.0;
+		std::uint32_t W = 0;
+	};
+
+	struct FVector
+	{
+		float X = 0.f;
+		float Y = 0.f;
+		float Z = 0.f;
+	};
+
+	/** Nested layouts, fixed & dynamic arrays, a string & a transient member */
+	struct FRecord
+	{
+		std::int32_t Id = 0;
+		FVector Position;
+		double Health = 0.0;
+		std::string Name;
+		std::vector<std::int32_t> Samples;
+		float Bounds[4] = {};
+		std::uint8_t Flags = 0;
+		std::int32_t Cache = 0;
+	};
+
+	inline FRecord MakeRecord(std::int32_t InId)
+	{
+		FRecord Record;
+		Record.Id = InId;
+		Record.Position = FVector{ 1.f * InId, 2.f * InId, 3.f * InId };
+		Record.Health = 100.0 - InId;
+		Record.Name = "Record " + std::to_string(InId);
+		Record.Samples = { InId, InId + 1, InId + 2 };
+		Record.Bounds[3] = 0.5f * InId;
+		Record.Flags = static_cast<std::uint8_t>(InId & 0xff);
+		Record.Cache = -1;
+		return Record;
+	}
+
+	/** Compare the serialized members of two records (Cache is transient) */
+	inline bool HaveSameState(const FRecord& InA, const FRecord& InB)
+	{
+		return InA.Id == InB.Id && InA.Position.X == InB.Position.X && InA.Position.Y == InB.Position.Y && InA.Position.Z == InB.Position.Z
+			&& InA.Health == InB.Health && InA.Name == InB.Name && InA.Samples == InB.Samples && InA.Bounds[0] == InB.Bounds[0]
+			&& InA.Bounds[1] == InB.Bounds[1] && InA.Bounds[2] == InB.Bounds[2] && InA.Bounds[3] == InB.Bounds[3] && InA.Flags == InB.Flags;
+	}
+}
+
+RF_BEGIN_LAYOUT(Test::FFlat)
+	RF_ENTRY(X),
+	RF_ENTRY(Y),
+	RF_ENTRY(Z),
+	RF_ENTRY(W)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Test::FVector)
+	RF_ENTRY(X),
+	RF_ENTRY(Y),
+	RF_ENTRY(Z)
+RF_END_LAYOUT()
+
+RF_BEGIN_LAYOUT(Test::FRecord)
+	RF_ENTRY(Id),
+	RF_ENTRY(Position),
+	RF_ENTRY(Health),
+	RF_ENTRY(Name),
+	RF_ENTRY(Samples),
+	RF_ENTRY(Bounds),
+	RF_ENTRY(Flags),
+	RF_TAGGED_ENTRY(Cache, Reflection::Transient)
+RF_END_LAYOUT()
@@ -0,0 +1,138 @@
+/*!
+ *  @file TestSoA.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of structure-of-arrays containers : scatter & gather of nested leaves, aligned columns, growth, copies.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutBatch.h"
+#include "Reflection/LayoutSoA.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+using namespace Test;
+
+namespace
+{
+	struct FParticle
+	{
+		FVector Position;
+		double Mass = 1.0;
+		std::int32_t Id = -1;
+		std::uint8_t Flags[3] = { 7, 8, 9 };
+	};
+}
+
+RF_BEGIN_LAYOUT(FParticle)
+	RF_ENTRY(Position),
+	RF_ENTRY(Mass),
+	RF_ENTRY(Id),
+	RF_ENTRY(Flags)
+RF_END_LAYOUT()
+
+namespace
+{
+	using FParticles = Rf::TLayoutSoA<FParticle>;
+
+	constexpr auto MassField = Reflection::MakeField<double, offsetof(FParticle, Mass)>();
+	constexpr auto IdField = Reflection::MakeField<std::int32_t, offsetof(FParticle, Id)>();
+	constexpr auto PositionYField = Reflection::MakeField<float, offsetof(FParticle, Position) + offsetof(FVector, Y)>();
+	constexpr auto FlagsField = Reflection::MakeField<std::uint8_t[3], offsetof(FParticle, Flags)>();
+
+	FParticle MakeParticle(std::int32_t InId)
+	{
+		FParticle Particle;
+		Particle.Position = FVector{ 1.f * InId, 2.f * InId, 3.f * InId };
+		Particle.Mass = 0.5 * InId;
+		Particle.Id = InId;
+		Particle.Flags[1] = static_cast<std::uint8_t>(InId);
+		return Particle;
+	}
+
+	bool IsSame(const FParticle& InA, const FParticle& InB)
+	{
+		return InA.Position.X == InB.Position.X && InA.Position.Y == InB.Position.Y && InA.Position.Z == InB.Position.Z && InA.Mass == InB.Mass
+			&& InA.Id == InB.Id && InA.Flags[0] == InB.Flags[0] && InA.Flags[1] == InB.Flags[1] && InA.Flags[2] == InB.Flags[2];
+	}
+
+	bool IsAligned(const void* InAddress)
+	{
+		return reinterpret_cast<std::uintptr_t>(InAddress) % FParticles::ColumnAlignment == 0;
+	}
+}
+
+RF_TEST(ScatterAndGather)
+{
+	static_assert(FParticles::NumColumns == 6);
+	static_assert(FParticles::GetColumnIndex<decltype(PositionYField)>() == 1 && FParticles::GetColumnIndex<decltype(IdField)>() == 4);
+	// Position itself isn't a leaf
+	static_assert(FParticles::GetColumnIndex<decltype(Reflection::MakeField<FVector, offsetof(FParticle, Position)>())>() == -1);
+
+	// Past the first reserve of 16, existing elements must survive the growth
+	FParticles Particles;
+	for (std::int32_t i = 0; i < 40; ++i)
+		Particles.push_back(MakeParticle(i));
+	RF_REQUIRE(Particles.size() == 40 && Particles.capacity() >= 40);
+
+	for (std::int32_t i = 0; i < 40; ++i)
+		RF_CHECK(IsSame(Particles.Load(i), MakeParticle(i)) && IsSame(Particles[i].Load(), MakeParticle(i)));
+
+	const std::span<const double> Masses = std::as_const(Particles).Column(MassField);
+	const std::span<const float> Ys = std::as_const(Particles).Column(PositionYField);
+	RF_REQUIRE(Masses.size() == 40 && Ys.size() == 40);
+	RF_CHECK(Masses[13] == 6.5 && Ys[13] == 26.f && Particles.Column(FlagsField)[13][1] == 13);
+	for (std::int32_t i = 0; i < FParticles::NumColumns; ++i)
+	{
+		RF_CHECK(IsAligned(Particles.GetColumnData(i).data()));
+		RF_CHECK(Particles.GetColumnData(i).size() == 40 * static_cast<std::size_t>(FParticles::GetLeaf(i).Size));
+	}
+
+	// Columns feed batch kernels directly
+	RF_CHECK(Reflection::Sum(Masses) == 0.5 * (39 * 40 / 2));
+}
+
+RF_TEST(ElementViews)
+{
+	FParticles Particles;
+	Particles.resize(3);
+	RF_CHECK(IsSame(Particles.Load(2), FParticle{}));
+
+	Particles[1].Get(IdField) = 42;
+	Particles[1].Get(PositionYField) = -1.f;
+	const FParticle Particle = Particles[1].Load();
+	RF_CHECK(Particle.Id == 42 && Particle.Position.Y == -1.f && Particle.Mass == 1.0);
+
+	Particles[2].Store(MakeParticle(5));
+	RF_CHECK(std::as_const(Particles)[2].Get(MassField) == 2.5 && Particles[2].GetIndex() == 2);
+	RF_CHECK(IsSame(Particles.Load(0), FParticle{}));
+
+	Particles.pop_back();
+	RF_CHECK(Particles.size() == 2 && Particles.Column(IdField).back() == 42);
+	Particles.clear();
+	RF_CHECK(Particles.empty() && Particles.Column(IdField).empty());
+}
+
+RF_TEST(CopiesAreIndependent)
+{
+	FParticles Particles;
+	for (std::int32_t i = 0; i < 20; ++i)
+		Particles.push_back(MakeParticle(i));
+
+	FParticles Copy = Particles;
+	Copy[3].Get(IdField) = 100;
+	RF_CHECK(Particles[3].Get(IdField) == 3 && Copy[3].Get(IdField) == 100 && Copy.size() == 20);
+	RF_CHECK(IsSame(Copy.Load(19), MakeParticle(19)));
+
+	FParticles Moved = std::move(Copy);
+	RF_CHECK(Moved.size() == 20 && Moved[3].Get(IdField) == 100 && Copy.empty());
+
+	Copy = Moved;
+	Moved = FParticles();
+	RF_CHECK(Moved.empty() && Copy.size() == 20 && IsSame(Copy.Load(7), MakeParticle(7)));
+}
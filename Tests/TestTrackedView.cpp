@@ -0,0 +1,148 @@
+/*!
+ *  @file TestTrackedView.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Tests of dirty field sets & tracked views : nested fields marked along, reads & unchanged sets left clean, word boundaries.
+ */
+
+#include "TestHarness.h"
+#include "TestShapes.h"
+
+#include "Reflection/LayoutTrackedView.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace Test;
+
+namespace
+{
+	using FRecordTable = Reflection::TLayoutTable<FRecord>;
+
+	template<class T>
+	constexpr std::int32_t GetIndex(std::size_t InOffset)
+	{
+		return FRecordTable::FindIndex(static_cast<std::int32_t>(InOffset), Reflection::GetTypeId<T>());
+	}
+
+	std::vector<std::int32_t> GetDirty(const Rf::FDirtyFieldSet& InSet)
+	{
+		std::vector<std::int32_t> Result;
+		InSet.ForEachDirty([&Result](std::int32_t InIndex) { Result.push_back(InIndex); });
+		return Result;
+	}
+}
+
+RF_TEST(DirtyFieldSet)
+{
+	// Three words, the last one partial
+	Rf::FDirtyFieldSet Set(150);
+	RF_CHECK(Set.Num() == 150 && Set.GetWords().size() == 3 && !Set.IsAnyDirty() && Set.CountDirty() == 0);
+
+	Set.Mark(0);
+	Set.Mark(63);
+	Set.Mark(64);
+	Set.Mark(149);
+	RF_CHECK(GetDirty(Set) == (std::vector<std::int32_t>{ 0, 63, 64, 149 }));
+	RF_CHECK(Set.IsDirty(63) && !Set.IsDirty(62) && !Set.IsDirty(65));
+
+	// Ranges within a word, across two words & over a whole word
+	Set.Clear();
+	Set.MarkRange(60, 8);
+	RF_CHECK(Set.CountDirty() == 8 && Set.IsDirty(60) && Set.IsDirty(67) && !Set.IsDirty(59) && !Set.IsDirty(68));
+	RF_CHECK(Set.IsAnyDirty(0, 61) && !Set.IsAnyDirty(0, 60) && Set.IsAnyDirty(67, 83) && !Set.IsAnyDirty(68, 82));
+	Set.MarkRange(64, 64);
+	RF_CHECK(Set.CountDirty() == 4 + 64 && Set.GetWords()[1] == ~std::uint64_t(0) && !Set.IsDirty(128));
+	Set.MarkRange(5, 0);
+	RF_CHECK(!Set.IsDirty(5));
+
+	Set.MarkAll();
+	RF_CHECK(Set.CountDirty() == 150 && Set.GetWords()[2] == (std::uint64_t(1) << 22) - 1);
+	Set.Clear();
+	RF_CHECK(!Set.IsAnyDirty() && Set.Num() == 150);
+
+	// Merging many sets
+	std::vector<Rf::FDirtyFieldSet> Sets(3, Rf::FDirtyFieldSet(70));
+	Sets[0].Mark(1);
+	Sets[1].Mark(65);
+	Sets[2].Mark(1);
+	RF_CHECK(GetDirty(Rf::MergeDirtyFields(Sets)) == (std::vector<std::int32_t>{ 1, 65 }));
+	RF_CHECK(Rf::MergeDirtyFields({}).Num() == 0);
+}
+
+RF_TEST(MergeDifferentSizes)
+{
+	// Larger set: fields past the merged set are dropped, within its last word too
+	Rf::FDirtyFieldSet Small(10);
+	Rf::FDirtyFieldSet Large(150);
+	Large.Mark(3);
+	Large.Mark(12);
+	Large.Mark(140);
+	Small.Merge(Large);
+	RF_CHECK(GetDirty(Small) == std::vector<std::int32_t>{ 3 } && Small.GetWords().size() == 1);
+
+	// Smaller set: fields past it are kept
+	Large.Clear();
+	Large.Mark(100);
+	Small.Mark(9);
+	Large.Merge(Small);
+	RF_CHECK(GetDirty(Large) == (std::vector<std::int32_t>{ 3, 9, 100 }));
+	Large.Merge(Rf::FDirtyFieldSet());
+	RF_CHECK(Large.CountDirty() == 3);
+}
+
+RF_TEST(TrackedWrites)
+{
+	FRecord Record = MakeRecord(2);
+	Rf::FDirtyFieldSet Dirty;
+	const Rf::FTrackedLayoutFieldView View(Rf::TReferenceWrapper<FRecord>(Record), Dirty);
+	RF_REQUIRE(View.IsValid() && Dirty.Num() == FRecordTable::Num && !Dirty.IsAnyDirty());
+
+	constexpr auto HealthField = Reflection::MakeField<double, offsetof(FRecord, Health)>();
+	constexpr auto PositionField = Reflection::MakeField<FVector, offsetof(FRecord, Position)>();
+	constexpr auto PositionYField = Reflection::MakeField<float, offsetof(FRecord, Position) + offsetof(FVector, Y)>();
+	constexpr auto NameField = Reflection::MakeField<std::string, offsetof(FRecord, Name)>();
+
+	// Reads & read-only views don't mark
+	RF_CHECK(View.Read(HealthField) == 98.0 && View.GetConstView().Get(PositionYField) == 4.f && !Dirty.IsAnyDirty());
+
+	// A leaf marks itself only
+	View.Get(PositionYField) = 7.f;
+	RF_CHECK(Record.Position.Y == 7.f);
+	RF_CHECK(GetDirty(Dirty) == std::vector<std::int32_t>{ GetIndex<float>(offsetof(FRecord, Position) + offsetof(FVector, Y)) });
+
+	// A nested layout marks its nested fields along, not its siblings
+	Dirty.Clear();
+	View.Get(PositionField).X = 1.5f;
+	const std::int32_t PositionIndex = GetIndex<FVector>(offsetof(FRecord, Position));
+	RF_CHECK(GetDirty(Dirty) == (std::vector<std::int32_t>{ PositionIndex, PositionIndex + 1, PositionIndex + 2, PositionIndex + 3 }));
+
+	// Set only marks changes
+	Dirty.Clear();
+	RF_CHECK(!View.Set(HealthField, 98.0) && !View.Set(NameField, std::string("Record 2")) && !Dirty.IsAnyDirty());
+	RF_CHECK(View.Set(NameField, "Renamed") && Record.Name == "Renamed");
+	RF_CHECK(GetDirty(Dirty) == std::vector<std::int32_t>{ GetIndex<std::string>(offsetof(FRecord, Name)) });
+
+	// Fields unknown to the viewed type mark everything
+	Dirty.Clear();
+	View.MarkDirty(static_cast<std::int32_t>(offsetof(FRecord, Id)), Reflection::GetTypeId<double>());
+	RF_CHECK(Dirty.CountDirty() == FRecordTable::Num);
+}
+
+RF_TEST(ViewResizesDirtySet)
+{
+	FRecord Record;
+	Rf::FDirtyFieldSet Dirty(3);
+	Dirty.MarkAll();
+	const Rf::FTrackedLayoutFieldView View(Rf::TReferenceWrapper<FRecord>(Record), Dirty);
+	RF_CHECK(Dirty.Num() == FRecordTable::Num && !Dirty.IsAnyDirty());
+
+	// Sized sets are kept as they are
+	Dirty.Mark(1);
+	const Rf::FTrackedLayoutFieldView Other(Rf::TReferenceWrapper<FRecord>(Record), Dirty);
+	RF_CHECK(Dirty.IsDirty(1) && &Other.GetDirtyFields() == &Dirty);
+	RF_CHECK(!Rf::FTrackedLayoutFieldView().IsValid());
+}
@@ -0,0 +1,88 @@
+# Behavior tests
+# One executable per feature, each registered with ctest. Tests flagged OPTIMIZED are also built with full
+# optimizations, where strict aliasing & vectorization bugs show up regardless of the build type. Tests flagged SIMD
+# are also built for AVX & AVX2 when the host runs them, so that every vector path is covered.
+
+enable_testing()
+find_package(Threads REQUIRED)
+include(CheckCXXSourceRuns)
+
+if (MSVC)
+  set(RF_TEST_AVX_OPTIONS /arch:AVX)
+  set(RF_TEST_AVX2_OPTIONS /arch:AVX2)
+else()
+  set(RF_TEST_AVX_OPTIONS -mavx)
+  set(RF_TEST_AVX2_OPTIONS -mavx2)
+endif()
+
+# Runs the instructions, hosts lacking them fail the check
+set(CMAKE_REQUIRED_FLAGS ${RF_TEST_AVX_OPTIONS})
+check_cxx_source_runs("
+  #include <immintrin.h>
+  int main() { volatile float Value = 2.f; return _mm256_cvtss_f32(_mm256_add_ps(_mm256_set1_ps(Value), _mm256_set1_ps(Value))) == 4.f ? 0 : 1; }
+" RF_HOST_RUNS_AVX)
+set(CMAKE_REQUIRED_FLAGS ${RF_TEST_AVX2_OPTIONS})
+check_cxx_source_runs("
+  #include <immintrin.h>
+  int main() { volatile int Value = 2; return _mm256_extract_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(Value), _mm256_set1_epi32(Value)), 0) == 4 ? 0 : 1; }
+" RF_HOST_RUNS_AVX2)
+unset(CMAKE_REQUIRED_FLAGS)
+
+function(rf_add_test Name Source)
+  cmake_parse_arguments(RF_TEST "OPTIMIZED;SIMD" "" "" ${ARGN})
+
+  set(Targets "Test${Name}")
+  if (RF_TEST_OPTIMIZED)
+    list(APPEND Targets "Test${Name}Optimized")
+  endif()
+  if (RF_TEST_SIMD AND RF_HOST_RUNS_AVX)
+    list(APPEND Targets "Test${Name}Avx")
+  endif()
+  if (RF_TEST_SIMD AND RF_HOST_RUNS_AVX2)
+    list(APPEND Targets "Test${Name}Avx2")
+  endif()
+
+  foreach(Target ${Targets})
+    add_executable(${Target} "Tests/${Source}" "Tests/TestMain.cpp" "Tests/TestHarness.h" "Tests/TestShapes.h")
+    target_include_directories(${Target} PRIVATE "include" "Tests")
+    target_link_libraries(${Target} PRIVATE Threads::Threads)
+    set_property(TARGET ${Target} PROPERTY CXX_STANDARD 20)
+    add_test(NAME ${Target} COMMAND ${Target})
+  endforeach()
+
+  if (RF_TEST_OPTIMIZED)
+    if (MSVC)
+      target_compile_options("Test${Name}Optimized" PRIVATE /O2)
+    else()
+      target_compile_options("Test${Name}Optimized" PRIVATE -O3)
+    endif()
+  endif()
+  if (RF_TEST_SIMD AND RF_HOST_RUNS_AVX)
+    target_compile_options("Test${Name}Avx" PRIVATE ${RF_TEST_AVX_OPTIONS})
+  endif()
+  if (RF_TEST_SIMD AND RF_HOST_RUNS_AVX2)
+    target_compile_options("Test${Name}Avx2" PRIVATE ${RF_TEST_AVX2_OPTIONS})
+  endif()
+endfunction()
+
+rf_add_test(LayoutTable TestLayoutTable.cpp)
+rf_add_test(SoA TestSoA.cpp)
+rf_add_test(Batch TestBatch.cpp SIMD)
+rf_add_test(Serializer TestSerializer.cpp)
+rf_add_test(AsyncDeserializer TestAsyncDeserializer.cpp)
+rf_add_test(Json TestJson.cpp)
+rf_add_test(Name TestName.cpp)
+rf_add_test(Lookup TestLookup.cpp)
+rf_add_test(MappedArray TestMappedArray.cpp)
+rf_add_test(Descriptor TestDescriptor.cpp)
+rf_add_test(Padding TestPadding.cpp)
+rf_add_test(Delta TestDelta.cpp)
+rf_add_test(Migration TestMigration.cpp)
+rf_add_test(HotCold TestHotCold.cpp)
+rf_add_test(Parallel TestParallel.cpp)
+rf_add_test(Pool TestPool.cpp)
+rf_add_test(CopyPlan TestCopyPlan.cpp)
+rf_add_test(Blend TestBlend.cpp OPTIMIZED)
+rf_add_test(BitSerializer TestBitSerializer.cpp)
+rf_add_test(TrackedView TestTrackedView.cpp)
+rf_add_test(Compare TestCompare.cpp)
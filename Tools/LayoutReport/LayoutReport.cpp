@@ -0,0 +1,30 @@
+/*!
+ *  @file LayoutReport.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Prints the padding report of every registered layout (RF_REGISTER_LAYOUT), most padded layouts first.
+ *  Layouts are registered by the sources listed in RF_LAYOUT_REPORT_SOURCES.
+ *  Usage: LayoutReport [--strict], --strict returning 1 when a layout would shrink by reordering its members.
+ */
+
+#include "Reflection/LayoutPaddingReport.h"
+
+#include <cstring>
+#include <iostream>
+
+int main(int InArgc, char** InArgv)
+{
+	const bool bStrict = InArgc > 1 && std::strcmp(InArgv[1], "--strict") == 0;
+
+	const std::vector<Reflection::FPaddingReport> Reports = Reflection::AnalyzeRegisteredPadding();
+	int32 TotalSavable = 0;
+	for (const Reflection::FPaddingReport& Report : Reports)
+	{
+		Reflection::WritePaddingReport(std::wcout, Report);
+		TotalSavable += Report.GetSavableBytes();
+	}
+	std::wcout << Reports.size() << L" layouts, " << TotalSavable << L" bytes savable by reordering" << std::endl;
+
+	return bStrict && TotalSavable > 0 ? 1 : 0;
+}
@@ -0,0 +1,21 @@
+/*!
+ *  @file ReportedLayouts.cpp
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Layouts reported by default by the LayoutReport tool: the benchmark shapes.
+ */
+
+#include "Benchmark/BenchmarkShapes.h"
+#include "Reflection/LayoutDescriptor.h"
+#include "Reflection/LayoutPadding.h"
+
+static_assert(Reflection::TIsPaddingFree<Benchmark::FDeep>::Value);
+static_assert(Reflection::TIsPaddingFree<Benchmark::FWide>::Value);
+static_assert(Reflection::TLayoutPadding<Benchmark::FFlat>::TailPadding == 4);
+
+RF_REGISTER_LAYOUT(Benchmark::FFlat)
+RF_REGISTER_LAYOUT(Benchmark::FDeep)
+RF_REGISTER_LAYOUT(Benchmark::FWide)
+RF_REGISTER_LAYOUT(Benchmark::FHotCold)
+RF_REGISTER_LAYOUT(Benchmark::FPayload)
@@ -0,0 +1,93 @@
+/*!
+ *  @file Hash.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares constexpr hashing helpers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	/** FNV-1a 64 bits offset basis */
+	constexpr uint64 Fnv1aOffsetBasis = 14695981039346656037ull;
+	/** FNV-1a 64 bits prime */
+	constexpr uint64 Fnv1aPrime = 1099511628211ull;
+
+	/**
+	 * Hash a sequence of code units (FNV-1a)
+	 * Each code unit is hashed as its integer value, so that narrow & wide ASCII strings produce the same hash
+	 * @param InData Code units
+	 * @param InNum Number of code units
+	 * @param InSeed Initial hash value
+	 * @return Hash
+	 */
+	template<class char_t>
+	constexpr uint64 HashFnv1a(const char_t* InData, std::size_t InNum, uint64 InSeed = Fnv1aOffsetBasis)
+	{
+		uint64 Hash = InSeed;
+		for (std::size_t i = 0; i < InNum; ++i)
+		{
+			Hash ^= static_cast<uint64>(InData[i]);
+			Hash *= Fnv1aPrime;
+		}
+		return Hash;
+	}
+
+	/**
+	 * Hash an integer value into an existing hash (FNV-1a over each byte)
+	 * @param InHash Hash to combine into
+	 * @param InValue Value to hash
+	 * @return Combined hash
+	 */
+	constexpr uint64 HashCombine(uint64 InHash, uint64 InValue)
+	{
+		for (int i = 0; i < 8; ++i)
+		{
+			InHash ^= (InValue >> (i * 8)) & 0xff;
+			InHash *= Fnv1aPrime;
+		}
+		return InHash;
+	}
+
+	/**
+	 * Mix a 64 bits word into an existing hash, at once
+	 * Cheaper than HashCombine, which hashes each byte; the xor-shift spreads the high bits of the product down
+	 * @param InHash Hash to combine into
+	 * @param InWord Word to mix
+	 * @return Combined hash
+	 */
+	constexpr uint64 HashWord(uint64 InHash, uint64 InWord)
+	{
+		InHash = (InHash ^ InWord) * Fnv1aPrime;
+		return InHash ^ (InHash >> 29);
+	}
+
+	/**
+	 * Hash a block of bytes, 8 bytes at a time (remaining bytes are FNV-1a hashed one by one)
+	 * @param InData Bytes
+	 * @param InSize Number of bytes
+	 * @param InSeed Initial hash value
+	 * @return Hash
+	 */
+	inline uint64 HashBytes(const void* InData, std::size_t InSize, uint64 InSeed = Fnv1aOffsetBasis)
+	{
+		const unsigned char* Bytes = static_cast<const unsigned char*>(InData);
+		uint64 Hash = InSeed;
+		std::size_t i = 0;
+		for (; i + sizeof(uint64) <= InSize; i += sizeof(uint64))
+		{
+			uint64 Word;
+			std::memcpy(&Word, Bytes + i, sizeof(uint64));
+			Hash = HashWord(Hash, Word);
+		}
+		return HashFnv1a(Bytes + i, InSize - i, Hash);
+	}
+}
@@ -0,0 +1,176 @@
+/*!
+ *  @file MappedFile.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a read-only memory-mapped file.
+ *  Pages are loaded on access by the OS, so mapping a large file costs neither a read nor resident memory upfront.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <stdint.h>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using uint8 = std::uint8_t;
+
+/**
+ * Read-only memory-mapped file
+ * Move-only, unmapped on destruction
+ */
+class FMappedFile
+{
+public:
+	FMappedFile() = default;
+	FMappedFile(const FMappedFile&) = delete;
+	FMappedFile& operator=(const FMappedFile&) = delete;
+
+	FMappedFile(FMappedFile&& InOther) noexcept
+	{
+		*this = std::move(InOther);
+	}
+
+	FMappedFile& operator=(FMappedFile&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Close();
+			Data = InOther.Data;
+			Size = InOther.Size;
+#if defined(_WIN32)
+			Mapping = InOther.Mapping;
+			InOther.Mapping = nullptr;
+#endif
+			InOther.Data = nullptr;
+			InOther.Size = 0;
+		}
+		return *this;
+	}
+
+	~FMappedFile()
+	{
+		Close();
+	}
+
+	/**
+	 * Map a file, closing the previous one
+	 * @param InPath File path
+	 * @return True on success; mapping an empty file succeeds with no data
+	 */
+	bool Open(const std::filesystem::path& InPath)
+	{
+		Close();
+
+#if defined(_WIN32)
+		const HANDLE File = CreateFileW(InPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER FileSize = {};
+		if (!GetFileSizeEx(File, &FileSize))
+		{
+			CloseHandle(File);
+			return false;
+		}
+		if (FileSize.QuadPart == 0)
+		{
+			CloseHandle(File);
+			return true;
+		}
+
+		// The mapping keeps the file open
+		Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(File);
+		if (Mapping == nullptr)
+			return false;
+
+		Data = static_cast<const uint8*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+		if (Data == nullptr)
+		{
+			CloseHandle(Mapping);
+			Mapping = nullptr;
+			return false;
+		}
+		Size = static_cast<std::size_t>(FileSize.QuadPart);
+#else
+		const int File = ::open(InPath.c_str(), O_RDONLY);
+		if (File < 0)
+			return false;
+
+		struct stat Stat = {};
+		if (::fstat(File, &Stat) != 0)
+		{
+			::close(File);
+			return false;
+		}
+		if (Stat.st_size == 0)
+		{
+			::close(File);
+			return true;
+		}
+
+		// The mapping keeps the file open
+		void* Address = ::mmap(nullptr, static_cast<std::size_t>(Stat.st_size), PROT_READ, MAP_SHARED, File, 0);
+		::close(File);
+		if (Address == MAP_FAILED)
+			return false;
+
+		Data = static_cast<const uint8*>(Address);
+		Size = static_cast<std::size_t>(Stat.st_size);
+#endif
+		return true;
+	}
+
+	/**
+	 * Unmap the file
+	 */
+	void Close()
+	{
+#if defined(_WIN32)
+		if (Data != nullptr)
+			UnmapViewOfFile(Data);
+		if (Mapping != nullptr)
+			CloseHandle(Mapping);
+		Mapping = nullptr;
+#else
+		if (Data != nullptr)
+			::munmap(const_cast<uint8*>(Data), Size);
+#endif
+		Data = nullptr;
+		Size = 0;
+	}
+
+	/**
+	 * Get the mapped bytes
+	 * @return Bytes, empty if not mapped
+	 */
+	std::span<const uint8> GetData() const { return std::span<const uint8>(Data, Size); }
+
+	/**
+	 * Check whether a file is mapped
+	 * @return True if mapped (and not empty)
+	 */
+	bool IsValid() const { return Data != nullptr; }
+
+private:
+	const uint8* Data = nullptr;
+	std::size_t Size = 0;
+#if defined(_WIN32)
+	HANDLE Mapping = nullptr;
+#endif
+};
@@ -3,13 +3,309 @@
  *  @author Paul
  *  @date 2024-11-20
  *
- *  Helper class to wrap wstring
+ *  Declares interned names.
+ *  A name is a 32 bits index into a global name table, so comparing & hashing names is an integer operation.
+ *  The table is split in shards: resolving & finding names is lock-free, adding a name locks a single shard.
  */
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
 #include <string>
+#include <string_view>
+#include <vector>
 
-struct FName
+#include "Hash.h"
+
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+
+namespace Details
+{
+	/**
+	 * Global name table
+	 * Entries are never removed nor moved, so resolved strings stay valid for the whole program
+	 */
+	class FNameTable
+	{
+	public:
+		static constexpr uint32 NumShardBits = 4;
+		static constexpr uint32 NumShards = 1u << NumShardBits;
+		static constexpr uint32 ChunkBits = 12;
+		static constexpr uint32 ChunkSize = 1u << ChunkBits;
+		static constexpr uint32 MaxChunks = 1u << 12;
+
+		static FNameTable& Get()
+		{
+			static FNameTable Instance;
+			return Instance;
+		}
+
+		FNameTable() = default;
+		FNameTable(const FNameTable&) = delete;
+		FNameTable& operator=(const FNameTable&) = delete;
+
+		/**
+		 * Find a name
+		 * @param InStr Name string
+		 * @return Name index, 0 if not found
+		 */
+		uint32 Find(std::wstring_view InStr) const
+		{
+			if (InStr.empty())
+				return 0;
+			const uint64 Hash = Reflection::HashFnv1a(InStr.data(), InStr.size());
+			const uint32 ShardIndex = static_cast<uint32>(Hash & (NumShards - 1));
+			return Shards[ShardIndex].Find(InStr, Hash, ShardIndex);
+		}
+
+		/**
+		 * Find a name, adding it if needed
+		 * @param InStr Name string
+		 * @return Name index, 0 for the empty string
+		 */
+		uint32 FindOrAdd(std::wstring_view InStr)
+		{
+			if (InStr.empty())
+				return 0;
+			const uint64 Hash = Reflection::HashFnv1a(InStr.data(), InStr.size());
+			const uint32 ShardIndex = static_cast<uint32>(Hash & (NumShards - 1));
+			FShard& Shard = Shards[ShardIndex];
+
+			if (const uint32 Index = Shard.Find(InStr, Hash, ShardIndex))
+				return Index;
+			return Shard.Add(InStr, Hash, ShardIndex);
+		}
+
+		/**
+		 * Get the string of a name
+		 * @param InIndex Name index
+		 * @return Name string, empty for index 0
+		 */
+		std::wstring_view Resolve(uint32 InIndex) const
+		{
+			if (InIndex == 0)
+				return std::wstring_view();
+			const uint32 Value = InIndex - 1;
+			const FEntry& Entry = Shards[Value & (NumShards - 1)].GetEntry(Value >> NumShardBits);
+			return std::wstring_view(Entry.Data, Entry.Length);
+		}
+
+	private:
+		struct FEntry
+		{
+			const wchar_t* Data = nullptr;
+			uint32 Length = 0;
+			uint64 Hash = 0;
+		};
+
+		/**
+		 * Open addressing table of entry local indices + 1 (0 = empty slot)
+		 */
+		struct FSlotTable
+		{
+			explicit FSlotTable(uint32 InCapacity)
+				: Mask(InCapacity - 1)
+				, Slots(new std::atomic<uint32>[InCapacity])
+			{
+				for (uint32 i = 0; i < InCapacity; ++i)
+					Slots[i].store(0, std::memory_order_relaxed);
+			}
+
+			uint32 Mask;
+			std::unique_ptr<std::atomic<uint32>[]> Slots;
+		};
+
+		class FShard
+		{
+		public:
+			FShard()
+			{
+				Tables.push_back(std::make_unique<FSlotTable>(256));
+				Table.store(Tables.back().get(), std::memory_order_release);
+			}
+
+			~FShard()
+			{
+				for (std::atomic<FEntry*>& Chunk : Chunks)
+					delete[] Chunk.load(std::memory_order_relaxed);
+			}
+
+			const FEntry& GetEntry(uint32 InLocalIndex) const
+			{
+				return Chunks[InLocalIndex >> ChunkBits].load(std::memory_order_acquire)[InLocalIndex & (ChunkSize - 1)];
+			}
+
+			/**
+			 * Lock-free lookup
+			 * @return Global index, 0 if not found
+			 */
+			uint32 Find(std::wstring_view InStr, uint64 InHash, uint32 InShardIndex) const
+			{
+				const FSlotTable* Current = Table.load(std::memory_order_acquire);
+				for (uint32 Slot = static_cast<uint32>(InHash >> NumShardBits) & Current->Mask; ; Slot = (Slot + 1) & Current->Mask)
+				{
+					const uint32 Value = Current->Slots[Slot].load(std::memory_order_acquire);
+					if (Value == 0)
+						return 0;
+
+					const FEntry& Entry = GetEntry(Value - 1);
+					if (Entry.Hash == InHash && std::wstring_view(Entry.Data, Entry.Length) == InStr)
+						return MakeIndex(Value - 1, InShardIndex);
+				}
+			}
+
+			/**
+			 * Add a name, under the shard lock
+			 * @return Global index
+			 */
+			uint32 Add(std::wstring_view InStr, uint64 InHash, uint32 InShardIndex)
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+
+				// Another thread may have added it in the meantime
+				if (const uint32 Index = Find(InStr, InHash, InShardIndex))
+					return Index;
+
+				const uint32 LocalIndex = NumEntries;
+				const uint32 ChunkIndex = LocalIndex >> ChunkBits;
+				if (ChunkIndex >= MaxChunks)
+					std::terminate();
+
+				FEntry* Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+				if (Chunk == nullptr)
+				{
+					Chunk = new FEntry[ChunkSize];
+					Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+				}
+				Chunk[LocalIndex & (ChunkSize - 1)] = FEntry{ StoreString(InStr), static_cast<uint32>(InStr.size()), InHash };
+				++NumEntries;
+
+				// Keep the table at most half full
+				FSlotTable* Current = Table.load(std::memory_order_relaxed);
+				if (NumEntries * 2 > Current->Mask + 1)
+					Current = Grow(Current);
+
+				Insert(*Current, LocalIndex, InHash);
+				return MakeIndex(LocalIndex, InShardIndex);
+			}
+
+		private:
+			static uint32 MakeIndex(uint32 InLocalIndex, uint32 InShardIndex)
+			{
+				return ((InLocalIndex << NumShardBits) | InShardIndex) + 1;
+			}
+
+			static void Insert(FSlotTable& InTable, uint32 InLocalIndex, uint64 InHash)
+			{
+				uint32 Slot = static_cast<uint32>(InHash >> NumShardBits) & InTable.Mask;
+				while (InTable.Slots[Slot].load(std::memory_order_relaxed) != 0)
+					Slot = (Slot + 1) & InTable.Mask;
+				InTable.Slots[Slot].store(InLocalIndex + 1, std::memory_order_release);
+			}
+
+			/**
+			 * Publish a table twice as large
+			 * The previous table is kept alive, lock-free readers may still be probing it
+			 */
+			FSlotTable* Grow(const FSlotTable* InCurrent)
+			{
+				Tables.push_back(std::make_unique<FSlotTable>((InCurrent->Mask + 1) * 2));
+				FSlotTable* NewTable = Tables.back().get();
+				for (uint32 i = 0; i + 1 < NumEntries; ++i)
+					Insert(*NewTable, i, GetEntry(i).Hash);
+				Table.store(NewTable, std::memory_order_release);
+				return NewTable;
+			}
+
+			/**
+			 * Copy a string into the shard character storage
+			 */
+			const wchar_t* StoreString(std::wstring_view InStr)
+			{
+				constexpr std::size_t BlockSize = 16 * 1024;
+				const std::size_t Size = InStr.size() + 1;
+				if (Blocks.empty() || BlockUsed + Size > BlockCapacity)
+				{
+					BlockCapacity = std::max(BlockSize, Size);
+					Blocks.push_back(std::make_unique<wchar_t[]>(BlockCapacity));
+					BlockUsed = 0;
+				}
+				wchar_t* Result = Blocks.back().get() + BlockUsed;
+				std::memcpy(Result, InStr.data(), InStr.size() * sizeof(wchar_t));
+				Result[InStr.size()] = L'\0';
+				BlockUsed += Size;
+				return Result;
+			}
+
+			std::atomic<FSlotTable*> Table = nullptr;
+			std::atomic<FEntry*> Chunks[MaxChunks] = {};
+
+			// Only accessed under Mutex
+			std::mutex Mutex;
+			uint32 NumEntries = 0;
+			std::vector<std::unique_ptr<FSlotTable>> Tables;
+			std::vector<std::unique_ptr<wchar_t[]>> Blocks;
+			std::size_t BlockUsed = 0;
+			std::size_t BlockCapacity = 0;
+		};
+
+		FShard Shards[NumShards];
+	};
+}
+
+/**
+ * Interned name
+ * Equality & hashing only involve the name index; ordering is by index, not alphabetical
+ */
+class FName
+{
+public:
+	constexpr FName() = default;
+	FName(const wchar_t* InStr) : FName(std::wstring_view(InStr)) {}
+	FName(const std::wstring& InStr) : FName(std::wstring_view(InStr)) {}
+	explicit FName(std::wstring_view InStr) : Index(Details::FNameTable::Get().FindOrAdd(InStr)) {}
+
+	/**
+	 * Find an existing name, without adding it to the name table
+	 * @param InStr Name string
+	 * @return Name, none if it was never added
+	 */
+	static FName Find(std::wstring_view InStr)
+	{
+		FName Result;
+		Result.Index = Details::FNameTable::Get().Find(InStr);
+		return Result;
+	}
+
+	/** Index within the name table, 0 for none */
+	uint32 GetIndex() const { return Index; }
+	/** Whether this is the empty name */
+	bool IsNone() const { return Index == 0; }
+
+	std::wstring_view ToStringView() const { return Details::FNameTable::Get().Resolve(Index); }
+	std::wstring ToString() const { return std::wstring(ToStringView()); }
+
+	bool operator==(const FName& InOther) const { return Index == InOther.Index; }
+	bool operator!=(const FName& InOther) const { return Index != InOther.Index; }
+	bool operator<(const FName& InOther) const { return Index < InOther.Index; }
+
+private:
+	uint32 Index = 0;
+};
+
+template<>
+struct std::hash<FName>
 {
-	std::wstring Str;
-};
\ No newline at end of file
+	std::size_t operator()(const FName& InName) const
+	{
+		// Fibonacci hashing, spreads consecutive indices
+		return static_cast<std::size_t>(InName.GetIndex() * 0x9e3779b97f4a7c15ull);
+	}
+};
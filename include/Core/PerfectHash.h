@@ -0,0 +1,146 @@
+/*!
+ *  @file PerfectHash.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a constexpr minimal-probe perfect hash table (hash & displace).
+ *  Keys are given as 64 bits hashes; a key lands in a bucket, each bucket owns a seed that displaces its keys to free slots.
+ *  A lookup is one hash, two array reads and one key comparison.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+using int32 = std::int32_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	/**
+	 * Perfect hash table over a fixed set of keys
+	 * @tparam num_keys Number of keys
+	 */
+	template<int32 num_keys>
+	struct TPerfectHashTable
+	{
+		/** Number of slots, at most half full */
+		static constexpr int32 NumSlots = static_cast<int32>(std::bit_ceil(static_cast<uint32>(num_keys * 2 > 0 ? num_keys * 2 : 1)));
+		/** Number of buckets, about 4 keys per bucket */
+		static constexpr int32 NumBuckets = num_keys / 4 + 1;
+
+		/** Displacement seed per bucket */
+		std::array<uint32, NumBuckets> Seeds = {};
+		/** Key index per slot, -1 if empty */
+		std::array<int32, NumSlots> Slots = {};
+		/** Whether a seed was found for every bucket (false if two keys share the same hash) */
+		bool bValid = false;
+
+		/**
+		 * Get the bucket of a key hash
+		 */
+		static constexpr int32 GetBucket(uint64 InHash)
+		{
+			return static_cast<int32>((InHash >> 32) % static_cast<uint64>(NumBuckets));
+		}
+
+		/**
+		 * Get the slot of a key hash, given its bucket seed
+		 */
+		static constexpr int32 GetSlot(uint64 InHash, uint32 InSeed)
+		{
+			// splitmix64 finalizer
+			uint64 Value = InHash ^ (static_cast<uint64>(InSeed) * 0x9e3779b97f4a7c15ull);
+			Value = (Value ^ (Value >> 30)) * 0xbf58476d1ce4e5b9ull;
+			Value = (Value ^ (Value >> 27)) * 0x94d049bb133111ebull;
+			Value = Value ^ (Value >> 31);
+			return static_cast<int32>(Value & static_cast<uint64>(NumSlots - 1));
+		}
+
+		/**
+		 * Find the candidate key of a hash
+		 * The caller must compare the candidate key with the searched one
+		 * @return Key index, -1 if none
+		 */
+		constexpr int32 Find(uint64 InHash) const
+		{
+			return Slots[GetSlot(InHash, Seeds[GetBucket(InHash)])];
+		}
+	};
+
+	/**
+	 * Build a perfect hash table
+	 * @param InHashes Hash of each key
+	 * @return Table, check bValid
+	 */
+	template<std::size_t num_keys>
+	constexpr TPerfectHashTable<static_cast<int32>(num_keys)> MakePerfectHashTable(const std::array<uint64, num_keys>& InHashes)
+	{
+		using TableType = TPerfectHashTable<static_cast<int32>(num_keys)>;
+		constexpr int32 NumKeys = static_cast<int32>(num_keys);
+		constexpr uint32 MaxSeed = 1u << 16;
+
+		TableType Table;
+		for (int32& Slot : Table.Slots)
+			Slot = -1;
+
+		// Group keys per bucket (counting sort)
+		std::array<int32, TableType::NumBuckets + 1> BucketStarts = {};
+		for (int32 i = 0; i < NumKeys; ++i)
+			BucketStarts[TableType::GetBucket(InHashes[i]) + 1] += 1;
+		int32 MaxBucketSize = 0;
+		for (int32 Bucket = 0; Bucket < TableType::NumBuckets; ++Bucket)
+		{
+			MaxBucketSize = BucketStarts[Bucket + 1] > MaxBucketSize ? BucketStarts[Bucket + 1] : MaxBucketSize;
+			BucketStarts[Bucket + 1] += BucketStarts[Bucket];
+		}
+		std::array<int32, num_keys> BucketKeys = {};
+		std::array<int32, TableType::NumBuckets> BucketCursors = {};
+		for (int32 i = 0; i < NumKeys; ++i)
+		{
+			const int32 Bucket = TableType::GetBucket(InHashes[i]);
+			BucketKeys[BucketStarts[Bucket] + BucketCursors[Bucket]++] = i;
+		}
+
+		// Place the largest buckets first, while most slots are free
+		for (int32 Size = MaxBucketSize; Size > 0; --Size)
+		{
+			for (int32 Bucket = 0; Bucket < TableType::NumBuckets; ++Bucket)
+			{
+				const int32 First = BucketStarts[Bucket];
+				if (BucketStarts[Bucket + 1] - First != Size)
+					continue;
+
+				bool bPlaced = false;
+				for (uint32 Seed = 0; Seed < MaxSeed && !bPlaced; ++Seed)
+				{
+					bool bFits = true;
+					for (int32 i = 0; i < Size && bFits; ++i)
+					{
+						const int32 Slot = TableType::GetSlot(InHashes[BucketKeys[First + i]], Seed);
+						bFits = Table.Slots[Slot] == -1;
+						for (int32 j = 0; j < i && bFits; ++j)
+							bFits = TableType::GetSlot(InHashes[BucketKeys[First + j]], Seed) != Slot;
+					}
+
+					if (!bFits)
+						continue;
+
+					for (int32 i = 0; i < Size; ++i)
+						Table.Slots[TableType::GetSlot(InHashes[BucketKeys[First + i]], Seed)] = BucketKeys[First + i];
+					Table.Seeds[Bucket] = Seed;
+					bPlaced = true;
+				}
+
+				if (!bPlaced)
+					return Table;
+			}
+		}
+
+		Table.bValid = true;
+		return Table;
+	}
+}
@@ -0,0 +1,195 @@
+/*!
+ *  @file Simd.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  SIMD instruction sets detection & vector traits.
+ *  TSimdTraits<T> is only specialized for types & instruction sets the target supports; code must provide a scalar fallback.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <stdint.h>
+
+#if defined(__AVX2__)
+	#define RF_SIMD_AVX2 1
+#else
+	#define RF_SIMD_AVX2 0
+#endif
+
+#if defined(__AVX__)
+	#define RF_SIMD_AVX 1
+#else
+	#define RF_SIMD_AVX 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RF_SIMD_SSE2 1
+#else
+	#define RF_SIMD_SSE2 0
+#endif
+
+#if RF_SIMD_AVX || RF_SIMD_SSE2
+	#include <immintrin.h>
+#endif
+
+namespace Reflection
+{
+	/**
+	 * Vector traits of a scalar type
+	 * Provides RegisterType, Width, Load/Store (unaligned), Set1, Add, Mul, Min, Max, AllEqual, ReduceAdd/Min/Max
+	 * and, when available, Gather (strided load)
+	 * Min(A, B) is A < B ? A : B and Max(A, B) is A > B ? A : B per lane, i.e B when either lane is NaN
+	 */
+	template<class T>
+	struct TSimdTraits
+	{
+		static constexpr bool bIsSupported = false;
+	};
+
+#if RF_SIMD_AVX
+	template<>
+	struct TSimdTraits<double>
+	{
+		static constexpr bool bIsSupported = true;
+		static constexpr bool bHasGather = RF_SIMD_AVX2;
+		using RegisterType = __m256d;
+		static constexpr int Width = 4;
+
+		static RegisterType Load(const double* InData) { return _mm256_loadu_pd(InData); }
+		static void Store(double* OutData, RegisterType InValue) { _mm256_storeu_pd(OutData, InValue); }
+		static RegisterType Set1(double InValue) { return _mm256_set1_pd(InValue); }
+		static RegisterType Add(RegisterType A, RegisterType B) { return _mm256_add_pd(A, B); }
+		static RegisterType Mul(RegisterType A, RegisterType B) { return _mm256_mul_pd(A, B); }
+		static RegisterType Min(RegisterType A, RegisterType B) { return _mm256_min_pd(A, B); }
+		static RegisterType Max(RegisterType A, RegisterType B) { return _mm256_max_pd(A, B); }
+		/** Whether all lanes compare equal (false for NaN lanes) */
+		static bool AllEqual(RegisterType A, RegisterType B) { return _mm256_movemask_pd(_mm256_cmp_pd(A, B, _CMP_EQ_OQ)) == 0xF; }
+#if RF_SIMD_AVX2
+		/** Load Width values, InStride bytes apart */
+		static RegisterType Gather(const double* InData, int32_t InStride)
+		{
+			const __m128i Offsets = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(InStride));
+			return _mm256_i32gather_pd(InData, Offsets, 1);
+		}
+#endif
+		static double ReduceAdd(RegisterType InValue)
+		{
+			const __m128d Sum = _mm_add_pd(_mm256_castpd256_pd128(InValue), _mm256_extractf128_pd(InValue, 1));
+			return _mm_cvtsd_f64(_mm_add_sd(Sum, _mm_unpackhi_pd(Sum, Sum)));
+		}
+		static double ReduceMin(RegisterType InValue)
+		{
+			const __m128d Min = _mm_min_pd(_mm256_castpd256_pd128(InValue), _mm256_extractf128_pd(InValue, 1));
+			return _mm_cvtsd_f64(_mm_min_sd(Min, _mm_unpackhi_pd(Min, Min)));
+		}
+		static double ReduceMax(RegisterType InValue)
+		{
+			const __m128d Max = _mm_max_pd(_mm256_castpd256_pd128(InValue), _mm256_extractf128_pd(InValue, 1));
+			return _mm_cvtsd_f64(_mm_max_sd(Max, _mm_unpackhi_pd(Max, Max)));
+		}
+	};
+
+	template<>
+	struct TSimdTraits<float>
+	{
+		static constexpr bool bIsSupported = true;
+		static constexpr bool bHasGather = RF_SIMD_AVX2;
+		using RegisterType = __m256;
+		static constexpr int Width = 8;
+
+		static RegisterType Load(const float* InData) { return _mm256_loadu_ps(InData); }
+		static void Store(float* OutData, RegisterType InValue) { _mm256_storeu_ps(OutData, InValue); }
+		static RegisterType Set1(float InValue) { return _mm256_set1_ps(InValue); }
+		static RegisterType Add(RegisterType A, RegisterType B) { return _mm256_add_ps(A, B); }
+		static RegisterType Mul(RegisterType A, RegisterType B) { return _mm256_mul_ps(A, B); }
+		static RegisterType Min(RegisterType A, RegisterType B) { return _mm256_min_ps(A, B); }
+		static RegisterType Max(RegisterType A, RegisterType B) { return _mm256_max_ps(A, B); }
+		/** Whether all lanes compare equal (false for NaN lanes) */
+		static bool AllEqual(RegisterType A, RegisterType B) { return _mm256_movemask_ps(_mm256_cmp_ps(A, B, _CMP_EQ_OQ)) == 0xFF; }
+#if RF_SIMD_AVX2
+		/** Load Width values, InStride bytes apart */
+		static RegisterType Gather(const float* InData, int32_t InStride)
+		{
+			const __m256i Offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(InStride));
+			return _mm256_i32gather_ps(InData, Offsets, 1);
+		}
+#endif
+		static float ReduceAdd(RegisterType InValue)
+		{
+			__m128 Sum = _mm_add_ps(_mm256_castps256_ps128(InValue), _mm256_extractf128_ps(InValue, 1));
+			Sum = _mm_add_ps(Sum, _mm_movehl_ps(Sum, Sum));
+			return _mm_cvtss_f32(_mm_add_ss(Sum, _mm_shuffle_ps(Sum, Sum, 1)));
+		}
+		static float ReduceMin(RegisterType InValue)
+		{
+			__m128 Min = _mm_min_ps(_mm256_castps256_ps128(InValue), _mm256_extractf128_ps(InValue, 1));
+			Min = _mm_min_ps(Min, _mm_movehl_ps(Min, Min));
+			return _mm_cvtss_f32(_mm_min_ss(Min, _mm_shuffle_ps(Min, Min, 1)));
+		}
+		static float ReduceMax(RegisterType InValue)
+		{
+			__m128 Max = _mm_max_ps(_mm256_castps256_ps128(InValue), _mm256_extractf128_ps(InValue, 1));
+			Max = _mm_max_ps(Max, _mm_movehl_ps(Max, Max));
+			return _mm_cvtss_f32(_mm_max_ss(Max, _mm_shuffle_ps(Max, Max, 1)));
+		}
+	};
+#elif RF_SIMD_SSE2
+	template<>
+	struct TSimdTraits<double>
+	{
+		static constexpr bool bIsSupported = true;
+		static constexpr bool bHasGather = false;
+		using RegisterType = __m128d;
+		static constexpr int Width = 2;
+
+		static RegisterType Load(const double* InData) { return _mm_loadu_pd(InData); }
+		static void Store(double* OutData, RegisterType InValue) { _mm_storeu_pd(OutData, InValue); }
+		static RegisterType Set1(double InValue) { return _mm_set1_pd(InValue); }
+		static RegisterType Add(RegisterType A, RegisterType B) { return _mm_add_pd(A, B); }
+		static RegisterType Mul(RegisterType A, RegisterType B) { return _mm_mul_pd(A, B); }
+		static RegisterType Min(RegisterType A, RegisterType B) { return _mm_min_pd(A, B); }
+		static RegisterType Max(RegisterType A, RegisterType B) { return _mm_max_pd(A, B); }
+		/** Whether all lanes compare equal (false for NaN lanes) */
+		static bool AllEqual(RegisterType A, RegisterType B) { return _mm_movemask_pd(_mm_cmpeq_pd(A, B)) == 0x3; }
+		static double ReduceAdd(RegisterType InValue) { return _mm_cvtsd_f64(_mm_add_sd(InValue, _mm_unpackhi_pd(InValue, InValue))); }
+		static double ReduceMin(RegisterType InValue) { return _mm_cvtsd_f64(_mm_min_sd(InValue, _mm_unpackhi_pd(InValue, InValue))); }
+		static double ReduceMax(RegisterType InValue) { return _mm_cvtsd_f64(_mm_max_sd(InValue, _mm_unpackhi_pd(InValue, InValue))); }
+	};
+
+	template<>
+	struct TSimdTraits<float>
+	{
+		static constexpr bool bIsSupported = true;
+		static constexpr bool bHasGather = false;
+		using RegisterType = __m128;
+		static constexpr int Width = 4;
+
+		static RegisterType Load(const float* InData) { return _mm_loadu_ps(InData); }
+		static void Store(float* OutData, RegisterType InValue) { _mm_storeu_ps(OutData, InValue); }
+		static RegisterType Set1(float InValue) { return _mm_set1_ps(InValue); }
+		static RegisterType Add(RegisterType A, RegisterType B) { return _mm_add_ps(A, B); }
+		static RegisterType Mul(RegisterType A, RegisterType B) { return _mm_mul_ps(A, B); }
+		static RegisterType Min(RegisterType A, RegisterType B) { return _mm_min_ps(A, B); }
+		static RegisterType Max(RegisterType A, RegisterType B) { return _mm_max_ps(A, B); }
+		/** Whether all lanes compare equal (false for NaN lanes) */
+		static bool AllEqual(RegisterType A, RegisterType B) { return _mm_movemask_ps(_mm_cmpeq_ps(A, B)) == 0xF; }
+		static float ReduceAdd(RegisterType InValue)
+		{
+			const __m128 Sum = _mm_add_ps(InValue, _mm_movehl_ps(InValue, InValue));
+			return _mm_cvtss_f32(_mm_add_ss(Sum, _mm_shuffle_ps(Sum, Sum, 1)));
+		}
+		static float ReduceMin(RegisterType InValue)
+		{
+			const __m128 Min = _mm_min_ps(InValue, _mm_movehl_ps(InValue, InValue));
+			return _mm_cvtss_f32(_mm_min_ss(Min, _mm_shuffle_ps(Min, Min, 1)));
+		}
+		static float ReduceMax(RegisterType InValue)
+		{
+			const __m128 Max = _mm_max_ps(InValue, _mm_movehl_ps(InValue, InValue));
+			return _mm_cvtss_f32(_mm_max_ss(Max, _mm_shuffle_ps(Max, Max, 1)));
+		}
+	};
+#endif
+}
@@ -0,0 +1,261 @@
+/*!
+ *  @file ThreadPool.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a work-stealing thread pool running parallel loops.
+ *  A loop is split in chunks, dealt evenly to the workers as contiguous ranges. Each worker consumes its range from the
+ *  front; once empty, it steals the back half of another worker's range. The calling thread works too.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using int32 = std::int32_t;
+using int64 = std::int64_t;
+using uint64 = std::uint64_t;
+
+/**
+ * Work-stealing thread pool
+ * Runs one parallel loop at a time; loops started from within a task run inline on the current worker
+ */
+class FWorkStealingPool
+{
+public:
+	/** Task, processing the items [InBegin, InEnd) on a worker */
+	using FTaskFunc = void(*)(void* InContext, int64 InBegin, int64 InEnd, int32 InWorkerIndex);
+
+	/**
+	 * Start the pool
+	 * @param InNumThreads Number of background threads, the calling thread being an extra worker
+	 */
+	explicit FWorkStealingPool(int32 InNumThreads = GetDefaultNumThreads())
+		: Ranges(static_cast<std::size_t>(std::max(InNumThreads, 0) + 1))
+	{
+		for (int32 i = 0; i < std::max(InNumThreads, 0); ++i)
+			Threads.emplace_back([this, i]() { WorkerMain(i + 1); });
+	}
+
+	FWorkStealingPool(const FWorkStealingPool&) = delete;
+	FWorkStealingPool& operator=(const FWorkStealingPool&) = delete;
+
+	~FWorkStealingPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(WakeMutex);
+			bStop = true;
+		}
+		WakeCondition.notify_all();
+		for (std::thread& Thread : Threads)
+			Thread.join();
+	}
+
+	/**
+	 * Get the shared pool, one thread per hardware thread
+	 */
+	static FWorkStealingPool& Get()
+	{
+		static FWorkStealingPool Instance;
+		return Instance;
+	}
+
+	static int32 GetDefaultNumThreads()
+	{
+		return std::max(static_cast<int32>(std::thread::hardware_concurrency()) - 1, 0);
+	}
+
+	/**
+	 * Get the number of workers, including the calling thread
+	 * Worker indices passed to tasks are in [0, GetNumWorkers())
+	 */
+	int32 GetNumWorkers() const { return static_cast<int32>(Ranges.size()); }
+
+	/**
+	 * Process the items [0, InNum) in parallel, blocking until all are processed
+	 * Tasks run concurrently and must not throw
+	 * @param InNum Number of items
+	 * @param InGrain Number of items per chunk, the unit of work distribution
+	 * @param InTask Callable (int64 Begin, int64 End, int32 WorkerIndex)
+	 */
+	template<class callable_t>
+	void ParallelFor(int64 InNum, int64 InGrain, callable_t&& InTask)
+	{
+		using TaskType = std::remove_reference_t<callable_t>;
+		Run(InNum, InGrain, [](void* InContext, int64 InBegin, int64 InEnd, int32 InWorkerIndex)
+		{
+			(*static_cast<TaskType*>(InContext))(InBegin, InEnd, InWorkerIndex);
+		}, const_cast<void*>(static_cast<const void*>(&InTask)));
+	}
+
+private:
+	/**
+	 * Chunks [Begin, End) left to a worker
+	 */
+	struct alignas(64) FWorkerRange
+	{
+		std::mutex Mutex;
+		int64 Begin = 0;
+		int64 End = 0;
+	};
+
+	/**
+	 * Worker the current thread is running a task for, if any
+	 */
+	struct FCurrentWorker
+	{
+		const FWorkStealingPool* Pool = nullptr;
+		int32 Index = 0;
+	};
+
+	static FCurrentWorker& GetCurrentWorker()
+	{
+		static thread_local FCurrentWorker Current;
+		return Current;
+	}
+
+	void Run(int64 InNum, int64 InGrain, FTaskFunc InFunc, void* InContext)
+	{
+		if (InNum <= 0)
+			return;
+		InGrain = std::max<int64>(InGrain, 1);
+		const int64 NumChunks = (InNum + InGrain - 1) / InGrain;
+
+		// Nested loops & single chunks run inline
+		FCurrentWorker& Current = GetCurrentWorker();
+		if (Current.Pool == this || Threads.empty() || NumChunks == 1)
+		{
+			InFunc(InContext, 0, InNum, Current.Pool == this ? Current.Index : 0);
+			return;
+		}
+
+		std::lock_guard<std::mutex> SubmitLock(SubmitMutex);
+
+		Func = InFunc;
+		Context = InContext;
+		Num = InNum;
+		Grain = InGrain;
+		NumRemainingChunks.store(NumChunks, std::memory_order_relaxed);
+
+		// Ranges are published under their lock, after the job they belong to
+		const int64 NumWorkers = static_cast<int64>(Ranges.size());
+		for (int64 i = 0; i < NumWorkers; ++i)
+		{
+			std::lock_guard<std::mutex> Lock(Ranges[i].Mutex);
+			Ranges[i].Begin = NumChunks * i / NumWorkers;
+			Ranges[i].End = NumChunks * (i + 1) / NumWorkers;
+		}
+
+		{
+			std::lock_guard<std::mutex> Lock(WakeMutex);
+			++Generation;
+		}
+		WakeCondition.notify_all();
+
+		const FCurrentWorker Previous = Current;
+		Current = FCurrentWorker{ this, 0 };
+		Work(0);
+		Current = Previous;
+
+		// Wait for chunks stolen by other workers
+		for (int64 Remaining = NumRemainingChunks.load(std::memory_order_acquire); Remaining > 0; Remaining = NumRemainingChunks.load(std::memory_order_acquire))
+			NumRemainingChunks.wait(Remaining, std::memory_order_acquire);
+	}
+
+	void WorkerMain(int32 InWorkerIndex)
+	{
+		GetCurrentWorker() = FCurrentWorker{ this, InWorkerIndex };
+
+		uint64 SeenGeneration = 0;
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> Lock(WakeMutex);
+				WakeCondition.wait(Lock, [&]() { return bStop || Generation != SeenGeneration; });
+				if (bStop)
+					return;
+				SeenGeneration = Generation;
+			}
+			Work(InWorkerIndex);
+		}
+	}
+
+	/**
+	 * Process chunks until none is left, in the own range first, then stealing
+	 */
+	void Work(int32 InWorkerIndex)
+	{
+		FWorkerRange& Own = Ranges[InWorkerIndex];
+		for (;;)
+		{
+			int64 Chunk = -1;
+			{
+				std::lock_guard<std::mutex> Lock(Own.Mutex);
+				if (Own.Begin < Own.End)
+					Chunk = Own.Begin++;
+			}
+
+			if (Chunk < 0)
+			{
+				if (!Steal(InWorkerIndex))
+					return;
+				continue;
+			}
+
+			const int64 Begin = Chunk * Grain;
+			Func(Context, Begin, std::min(Begin + Grain, Num), InWorkerIndex);
+			if (NumRemainingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				NumRemainingChunks.notify_all();
+		}
+	}
+
+	/**
+	 * Move the back half of another worker's range into the own range
+	 * Both ranges are locked together: a worker late from the previous loop may find its own range republished by the
+	 * next one, which must not be overwritten
+	 * @return False if every range is empty
+	 */
+	bool Steal(int32 InWorkerIndex)
+	{
+		const int32 NumWorkers = GetNumWorkers();
+		FWorkerRange& Own = Ranges[InWorkerIndex];
+		for (int32 Offset = 1; Offset < NumWorkers; ++Offset)
+		{
+			FWorkerRange& Victim = Ranges[(InWorkerIndex + Offset) % NumWorkers];
+			std::scoped_lock Lock(Own.Mutex, Victim.Mutex);
+			if (Own.Begin < Own.End)
+				return true;
+			if (Victim.Begin >= Victim.End)
+				continue;
+
+			Own.Begin = Victim.Begin + (Victim.End - Victim.Begin) / 2;
+			Own.End = Victim.End;
+			Victim.End = Own.Begin;
+			return true;
+		}
+		return false;
+	}
+
+	std::vector<FWorkerRange> Ranges;
+	std::vector<std::thread> Threads;
+
+	// Current job, written under SubmitMutex before the ranges are published
+	std::mutex SubmitMutex;
+	FTaskFunc Func = nullptr;
+	void* Context = nullptr;
+	int64 Num = 0;
+	int64 Grain = 1;
+	std::atomic<int64> NumRemainingChunks = 0;
+
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+	uint64 Generation = 0;
+	bool bStop = false;
+};
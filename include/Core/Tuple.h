@@ -8,8 +8,8 @@
 
 #pragma once
 
-#include <tuple>
-#include <utility> 
+#include <functional>
+#include <utility>
 #include <type_traits>
 
 template <class _Ty>
@@ -25,19 +25,107 @@ struct _Unrefwrap_helper<std::reference_wrapper<_Ty>> { // make a reference from
 template <class _Ty>
 using _Unrefwrap_t = typename _Unrefwrap_helper<std::decay_t<_Ty>>::type;
 
+namespace Details
+{
+	/**
+	 * Tuple element, tagged with its index so that duplicated types stay distinct bases
+	 */
+	template <std::size_t Index, class T>
+	struct TTupleElement
+	{
+		T Value;
+	};
+
+	template <class IndexSequence, class... Ts>
+	struct TTupleStorage;
+
+	/**
+	 * Flat tuple storage : a single level of inheritance whatever the number of elements,
+	 * instead of the recursive instantiations of std::tuple
+	 */
+	template <std::size_t... Indices, class... Ts>
+	struct TTupleStorage<std::index_sequence<Indices...>, Ts...> : TTupleElement<Indices, Ts>...
+	{
+		constexpr TTupleStorage() = default;
+
+		template <class... ArgTypes>
+		constexpr explicit TTupleStorage(ArgTypes&&... InArgs)
+			: TTupleElement<Indices, Ts>{ std::forward<ArgTypes>(InArgs) }...
+		{
+		}
+	};
+
+	/** Resolve an element from its index, deducing its type from the matching base */
+	template <std::size_t Index, class T>
+	constexpr const T& GetTupleElement(const TTupleElement<Index, T>& InElement)
+	{
+		return InElement.Value;
+	}
+
+	template <std::size_t Index, class T>
+	constexpr T& GetTupleElement(TTupleElement<Index, T>& InElement)
+	{
+		return InElement.Value;
+	}
+
+	/** Invoke a callable on each element, in order, within a single instantiation */
+	template <class FuncType, class StorageType, std::size_t... Indices, class... Ts>
+	constexpr void VisitTupleStorage(FuncType&& Func, StorageType& InStorage, TTupleStorage<std::index_sequence<Indices...>, Ts...>*)
+	{
+		(Func(InStorage.TTupleElement<Indices, Ts>::Value), ...);
+	}
+}
+
 /*!
- * Tuple child class to add the templated Get method 
+ * Tuple class with a templated Get method
  */
 template <typename... Ts>
-class RTuple : public std::tuple<Ts...> 
+class RTuple : private Details::TTupleStorage<std::index_sequence_for<Ts...>, Ts...>
 {
+	using StorageType = Details::TTupleStorage<std::index_sequence_for<Ts...>, Ts...>;
+
 public:
-	using std::tuple<Ts...>::tuple;
+	constexpr RTuple() = default;
+	constexpr RTuple(const RTuple&) = default;
+	constexpr RTuple(RTuple&&) = default;
+	constexpr RTuple& operator=(const RTuple&) = default;
+	constexpr RTuple& operator=(RTuple&&) = default;
+
+	// Only the first argument is checked against RTuple (copy construction) : a constraint folded over every argument
+	// is evaluated per element and dominates the compile time of wide tuples
+	template <class FirstArgType, class... ArgTypes>
+		requires (sizeof...(ArgTypes) + 1 == sizeof...(Ts) && !std::is_same_v<std::remove_cvref_t<FirstArgType>, RTuple>)
+	constexpr RTuple(FirstArgType&& InFirstArg, ArgTypes&&... InArgs)
+		: StorageType(std::forward<FirstArgType>(InFirstArg), std::forward<ArgTypes>(InArgs)...)
+	{
+	}
 
 	template <std::size_t N>
-	decltype(auto) Get() const
+	constexpr decltype(auto) Get() const
+	{
+		return Details::GetTupleElement<N>(static_cast<const StorageType&>(*this));
+	}
+
+	template <std::size_t N>
+	constexpr decltype(auto) Get()
+	{
+		return Details::GetTupleElement<N>(static_cast<StorageType&>(*this));
+	}
+
+	/**
+	 * Invoke a callable on each element, in order
+	 * Prefer it over a loop of Get<N>() on large tuples : it does not instantiate a function per element
+	 */
+	template <class FuncType>
+	constexpr void Visit(FuncType&& Func) const
+	{
+		Details::VisitTupleStorage(Func, static_cast<const StorageType&>(*this), static_cast<StorageType*>(nullptr));
+	}
+
+	template <class FuncType>
+	constexpr void Visit(FuncType&& Func)
 	{
-		return std::get<N>(*this);
+		Details::VisitTupleStorage(Func, static_cast<StorageType&>(*this), static_cast<StorageType*>(nullptr));
 	}
 };
 
@@ -5,6 +5,8 @@
  *
  */
 
+#pragma once
+
 #include <functional>
 #include <stdint.h>
 #include "Tuple.h"
@@ -36,7 +38,7 @@ template <typename T, T N>
 using TMakeIntegerSequence = __make_integer_seq<TIntegerSequence, T, N>;
 #else 
 template <typename T, T N>
-using TMakeIntegerSequence = __integer_pack<TIntegerSequence, T, N>;
+using TMakeIntegerSequence = TIntegerSequence<T, __integer_pack(N)...>;
 #endif
 
 template <typename IntegerSequence>
@@ -48,22 +50,30 @@ struct TVisitTupleElements_Impl<TIntegerSequence<uint32, Indices...>>
 	// We need a second function to do the invocation for a particular index, to avoid the pack expansion being
 	// attempted on the indices and tuples simultaneously.
 	template <uint32 Index, typename FuncType, typename... TupleTypes>
-	inline static void InvokeFunc(FuncType&& Func, TupleTypes&&... Tuples)
+	constexpr static void InvokeFunc(FuncType&& Func, TupleTypes&&... Tuples)
 	{
 		std::invoke(std::forward<FuncType>(Func), std::forward<TupleTypes>(Tuples).template Get<Index>()...);
 	}
 
 	template <typename FuncType, typename... TupleTypes>
-	static void Do(FuncType&& Func, TupleTypes&&... Tuples)
+	constexpr static void Do(FuncType&& Func, TupleTypes&&... Tuples)
 	{
-		// This should be implemented with a fold expression when our compilers support it
-		int Temp[] = { 0, (InvokeFunc<Indices>(std::forward<FuncType>(Func), std::forward<TupleTypes>(Tuples)...), 0)... };
-		(void)Temp;
+		(InvokeFunc<Indices>(std::forward<FuncType>(Func), std::forward<TupleTypes>(Tuples)...), ...);
 	}
 };
 
+/**
+ * Visit the elements of a single tuple
+ * A single fold over the elements, no per-index instantiation (whose symbols would embed the whole tuple type)
+ */
+template <typename FuncType, typename TupleType>
+constexpr void VisitTupleElements(FuncType&& Func, TupleType&& Tuple)
+{
+	Tuple.Visit(std::forward<FuncType>(Func));
+}
+
 template <typename FuncType, typename FirstTupleType, typename... TupleTypes>
-inline void VisitTupleElements(FuncType&& Func, FirstTupleType&& FirstTuple, TupleTypes&&... Tuples)
+constexpr void VisitTupleElements(FuncType&& Func, FirstTupleType&& FirstTuple, TupleTypes&&... Tuples)
 {
 	TVisitTupleElements_Impl<TMakeIntegerSequence<uint32, TTupleArity<std::decay_t<FirstTupleType>>::Value>>::Do(std::forward<FuncType>(Func), std::forward<FirstTupleType>(FirstTuple), std::forward<TupleTypes>(Tuples)...);
 }
\ No newline at end of file
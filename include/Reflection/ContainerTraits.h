@@ -0,0 +1,205 @@
+/*!
+ *  @file ContainerTraits.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares the traits of container field types: C arrays, std::array, std::vector & std::span.
+ *  Containers are leaves of a layout; their elements are contiguous, so trivially copyable elements can be processed
+ *  as a single block by the serializer, the delta encoder & the hasher.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+#include "Layout.h"
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+
+namespace Reflection
+{
+	/**
+	 * Kind of a field, from its type
+	 */
+	enum class EFieldKind : uint8
+	{
+		/** Plain value */
+		Value,
+		/** Nested layout */
+		Layout,
+		/** Fixed number of elements stored in place (C array, std::array) */
+		FixedArray,
+		/** Owned, resizable elements (std::vector) */
+		DynamicArray,
+		/** Non-owning view to elements stored elsewhere (std::span) */
+		ArrayView
+	};
+
+	/**
+	 * Container traits
+	 * Primary template for non container types
+	 */
+	template<class T>
+	struct TContainerTraits
+	{
+		static constexpr bool bIsContainer = false;
+		static constexpr EFieldKind Kind = EFieldKind::Value;
+	};
+
+	template<class E, std::size_t N>
+	struct TContainerTraits<E[N]>
+	{
+		using ElementType = E;
+		static constexpr bool bIsContainer = true;
+		static constexpr EFieldKind Kind = EFieldKind::FixedArray;
+		static constexpr std::size_t FixedNum = N;
+
+		static constexpr std::size_t Num(const E(&)[N]) { return N; }
+		static constexpr E* GetData(E(&InContainer)[N]) { return InContainer; }
+		static constexpr const E* GetData(const E(&InContainer)[N]) { return InContainer; }
+	};
+
+	template<class E, std::size_t N>
+	struct TContainerTraits<std::array<E, N>>
+	{
+		using ElementType = E;
+		static constexpr bool bIsContainer = true;
+		static constexpr EFieldKind Kind = EFieldKind::FixedArray;
+		static constexpr std::size_t FixedNum = N;
+
+		static constexpr std::size_t Num(const std::array<E, N>&) { return N; }
+		static constexpr E* GetData(std::array<E, N>& InContainer) { return InContainer.data(); }
+		static constexpr const E* GetData(const std::array<E, N>& InContainer) { return InContainer.data(); }
+	};
+
+	/**
+	 * std::vector, except std::vector<bool> whose elements aren't addressable
+	 */
+	template<class E, class allocator_t> requires (!std::is_same_v<E, bool>)
+	struct TContainerTraits<std::vector<E, allocator_t>>
+	{
+		using ElementType = E;
+		static constexpr bool bIsContainer = true;
+		static constexpr EFieldKind Kind = EFieldKind::DynamicArray;
+		static constexpr std::size_t FixedNum = 0;
+
+		static std::size_t Num(const std::vector<E, allocator_t>& InContainer) { return InContainer.size(); }
+		static E* GetData(std::vector<E, allocator_t>& InContainer) { return InContainer.data(); }
+		static const E* GetData(const std::vector<E, allocator_t>& InContainer) { return InContainer.data(); }
+		static void Resize(std::vector<E, allocator_t>& InContainer, std::size_t InNum) { InContainer.resize(InNum); }
+	};
+
+	/**
+	 * std::span; ElementType may be const, in which case elements are read-only
+	 */
+	template<class E, std::size_t extent>
+	struct TContainerTraits<std::span<E, extent>>
+	{
+		using ElementType = E;
+		static constexpr bool bIsContainer = true;
+		static constexpr EFieldKind Kind = EFieldKind::ArrayView;
+		static constexpr std::size_t FixedNum = extent == std::dynamic_extent ? 0 : extent;
+
+		static constexpr std::size_t Num(const std::span<E, extent>& InContainer) { return InContainer.size(); }
+		static constexpr E* GetData(const std::span<E, extent>& InContainer) { return InContainer.data(); }
+	};
+
+	/**
+	 * Check whether a type is a container
+	 * Provides IsContainer<T>::Value
+	 */
+	template<class T>
+	struct IsContainer
+	{
+		static constexpr bool Value = TContainerTraits<std::remove_cv_t<T>>::bIsContainer;
+	};
+
+	/**
+	 * Type of the elements of a container
+	 */
+	template<class T>
+	using TContainerElementType = typename TContainerTraits<std::remove_cv_t<T>>::ElementType;
+
+	/**
+	 * Get the kind of a field type
+	 * @tparam T Field type
+	 * @return Field kind
+	 */
+	template<class T>
+	constexpr EFieldKind GetFieldKind()
+	{
+		if constexpr (HasLayout<std::remove_cv_t<T>>::Value)
+			return EFieldKind::Layout;
+		else
+			return TContainerTraits<std::remove_cv_t<T>>::Kind;
+	}
+
+	template<class T>
+	constexpr bool IsBlittable();
+
+	namespace Details
+	{
+		template<class T>
+		constexpr bool AreLayoutFieldsBlittable()
+		{
+			bool bResult = true;
+			VisitTupleElements([&bResult](const auto& InField)
+			{
+				bResult = bResult && IsBlittable<typename std::decay_t<decltype(InField)>::Type>();
+			}, MakeNamedLayout<T>());
+			return bResult;
+		}
+	}
+
+	/**
+	 * Check whether the bytes of a value hold its whole state, so that it can be copied or compared with memcpy/memcmp
+	 * Trivially copyable types are, except views (whose bytes reference memory they don't own), recursively
+	 * @tparam T Type
+	 */
+	template<class T>
+	constexpr bool IsBlittable()
+	{
+		using Type = std::remove_cv_t<T>;
+		if constexpr (!std::is_trivially_copyable_v<Type> || GetFieldKind<Type>() == EFieldKind::ArrayView)
+			return false;
+		else if constexpr (GetFieldKind<Type>() == EFieldKind::FixedArray)
+			return IsBlittable<TContainerElementType<Type>>();
+		else if constexpr (HasLayout<Type>::Value)
+			return Details::AreLayoutFieldsBlittable<Type>();
+		else
+			return true;
+	}
+
+	/**
+	 * Get the elements of a container
+	 * @param InContainer Container
+	 * @return Contiguous elements
+	 */
+	template<class T>
+	constexpr auto GetElements(T& InContainer)
+	{
+		using TraitsType = TContainerTraits<std::remove_const_t<T>>;
+		using ElementType = std::remove_pointer_t<decltype(TraitsType::GetData(InContainer))>;
+		return std::span<ElementType>(TraitsType::GetData(InContainer), TraitsType::Num(InContainer));
+	}
+
+	/**
+	 * Invoke a callable on each element of a container
+	 * @param InContainer Container
+	 * @param InCallable Callable (std::size_t Index, Element&)
+	 */
+	template<class T, class callable_t>
+	constexpr void ForEachElement(T& InContainer, callable_t&& InCallable)
+	{
+		const auto Elements = GetElements(InContainer);
+		for (std::size_t i = 0; i < Elements.size(); ++i)
+			InCallable(i, Elements[i]);
+	}
+}
@@ -10,6 +10,8 @@
 #include <type_traits>
 #include <Core/StaticString.h>
 
+#include "FieldTags.h"
+
 #define WIDETEXT(x)  L ## x
 
 
@@ -43,8 +45,9 @@ namespace Reflection
 	* Type : Type of the field
 	* MemberOffset : Local field offset
 	* Name() : Name of the field (if parsed)
+	* Tags : Compile-time tags (see FieldTags.h), Flags : flags of these tags
 	*/
-	template<class T, int32 offset, int32 name_len = 0>
+	template<class T, int32 offset, int32 name_len = 0, class tags_t = TTags<>>
 	struct TLayoutField : std::conditional<(name_len > 0), TStaticString<name_len>, Details::FLayoutNameEmptyString>::type
 	{
 		/**
@@ -59,12 +62,14 @@ namespace Reflection
 	enum { MemberOffset = offset };
 
 	/** Anonymous field type */
-	using AnonymousType = TLayoutField<T, offset>;
+	using AnonymousType = TLayoutField<T, offset, 0, tags_t>;
 
-	///** Tags held by this field */
-	//using TTags = Tuple;
-	///** Tag values */
-	//TTags Tags;
+	/** Tags held by this field */
+	using TagsType = tags_t;
+	/** Flags of the tags */
+	static constexpr EFieldFlags Flags = GetTagFlags<tags_t>();
+	/** Tag values */
+	[[no_unique_address]] TagsType Tags;
 
 
 	constexpr TLayoutField() = default;
@@ -75,6 +80,7 @@ namespace Reflection
 
 	constexpr TLayoutField(const NameType& InName) : NameType(InName) {}
 	constexpr TLayoutField(NameType&& InName) : NameType(std::move(InName)) {}
+	constexpr TLayoutField(const NameType& InName, const TagsType& InTags) : NameType(InName), Tags(InTags) {}
 
 	/**
 	* Get the offset of this field
@@ -139,6 +145,41 @@ namespace Reflection
 		return TLayoutField<T, offset, n>{TStaticString<n>{InName}};
 	}
 
+	/**
+	* Create a tagged field
+	* @param InName Name of the field
+	* @param InTags Tags of the field
+	* @return Field
+	*/
+	template<class T, int32 offset, int32 n, class tags_t>
+	constexpr TLayoutField<T, offset, n, tags_t> MakeTaggedField(const TStaticString<n>& InName, const tags_t& InTags)
+	{
+		return TLayoutField<T, offset, n, tags_t>{InName, InTags};
+	}
+
+	/**
+	* Create a tagged field
+	* @param InName Name of the field
+	* @param InTags Tags of the field
+	* @return Field
+	*/
+	template<class T, int32 offset, int32 n, class tags_t>
+	constexpr TLayoutField<T, offset, n, tags_t> MakeTaggedField(const wchar_t(&InName)[n], const tags_t& InTags)
+	{
+		return TLayoutField<T, offset, n, tags_t>{TStaticString<n>{InName}, InTags};
+	}
+
+	/**
+	* Create an anonymous tagged field
+	* @param InTags Tags of the field
+	* @return Field
+	*/
+	template<class T, int32 offset, class tags_t>
+	constexpr TLayoutField<T, offset, 0, tags_t> MakeTaggedField(Details::FLayoutNameEmptyString, const tags_t& InTags)
+	{
+		return TLayoutField<T, offset, 0, tags_t>{Details::FLayoutNameEmptyString{}, InTags};
+	}
+
 	/**
 	* Concatenate names ; empty base
 	* @param InBase base name
@@ -148,7 +189,14 @@ namespace Reflection
 	template<int32 n1, int32 n2>
 	constexpr TStaticString<n1 + n2> ConcatFieldName(const TStaticString<n1>& InBase, const TStaticString<n2>& InDerived)
 	{
-		return InBase + MakeStaticString(WIDETEXT(".")) + InDerived;
+		// Filled in place rather than through operator+, which would instantiate an intermediate "Base." string type per level
+		TStaticString<n1 + n2> Result;
+		for (int32 i = 0; i < n1 - 1; ++i)
+			Result[i] = InBase[i];
+		Result[n1 - 1] = L'.';
+		for (int32 i = 0; i < n2; ++i)
+			Result[n1 + i] = InDerived[i];
+		return Result;
 	}
 	/**
 	* Concatenate names ; empty base
@@ -0,0 +1,169 @@
+/*!
+ *  @file FieldTags.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares compile-time tags attached to layout fields with RF_TAGGED_ENTRY.
+ *  Tags are values held by the field (e.g a quantization range); each tag type also contributes flags, readable from
+ *  the field type (TLayoutField::Flags) and from the layout table.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include <Core/Tuple.h>
+
+using int32 = std::int32_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	/**
+	 * Flags contributed by field tags
+	 */
+	enum class EFieldFlags : uint32
+	{
+		None = 0,
+		/** Touched every frame, stored densely by hot/cold containers */
+		Hot = 1 << 0,
+		/** Rarely touched, stored in side tables by hot/cold containers */
+		Cold = 1 << 1,
+		/** Runtime state, skipped by the serializer & delta encoding */
+		Transient = 1 << 2,
+		/** Replicated over the network */
+		Replicated = 1 << 3,
+		/** Holds a quantization range, see FQuantize */
+		Quantized = 1 << 4,
+		/** Never interpolated, keeps the value of the first blended state */
+		NoBlend = 1 << 5
+	};
+
+	constexpr EFieldFlags operator|(EFieldFlags InA, EFieldFlags InB) { return static_cast<EFieldFlags>(static_cast<uint32>(InA) | static_cast<uint32>(InB)); }
+	constexpr EFieldFlags operator&(EFieldFlags InA, EFieldFlags InB) { return static_cast<EFieldFlags>(static_cast<uint32>(InA) & static_cast<uint32>(InB)); }
+	constexpr EFieldFlags operator~(EFieldFlags InA) { return static_cast<EFieldFlags>(~static_cast<uint32>(InA)); }
+
+	/**
+	 * Check whether any of the tested flags is set
+	 * @param InFlags Flags
+	 * @param InTest Flags to test
+	 * @return True if any tested flag is set
+	 */
+	constexpr bool HasAnyFlags(EFieldFlags InFlags, EFieldFlags InTest) { return (InFlags & InTest) != EFieldFlags::None; }
+
+	struct FHotTag { static constexpr EFieldFlags Flags = EFieldFlags::Hot; };
+	struct FColdTag { static constexpr EFieldFlags Flags = EFieldFlags::Cold; };
+	struct FTransientTag { static constexpr EFieldFlags Flags = EFieldFlags::Transient; };
+	struct FReplicatedTag { static constexpr EFieldFlags Flags = EFieldFlags::Replicated; };
+	struct FNoBlendTag { static constexpr EFieldFlags Flags = EFieldFlags::NoBlend; };
+
+	inline constexpr FHotTag Hot;
+	inline constexpr FColdTag Cold;
+	inline constexpr FTransientTag Transient;
+	inline constexpr FReplicatedTag Replicated;
+	inline constexpr FNoBlendTag NoBlend;
+
+	/**
+	 * Quantization range of a numeric field: values in [Min, Max] are stored on Bits bits
+	 * Floating point values are mapped uniformly on the range, integers are stored as their offset from Min
+	 * Bounds are held as doubles, so that integer ranges are exact up to 2^53 (a float would round bounds past 2^24)
+	 */
+	struct FQuantize
+	{
+		static constexpr EFieldFlags Flags = EFieldFlags::Quantized;
+
+		double Min = 0.0;
+		double Max = 1.0;
+		int32 Bits = 32;
+
+		/**
+		 * Make a range storing floating point values with a given precision
+		 * @param InPrecision Largest distance between two consecutive quantized values
+		 * @return Range on the fewest bits reaching the precision (32 at most)
+		 */
+		static constexpr FQuantize FromPrecision(double InMin, double InMax, double InPrecision)
+		{
+			int32 Bits = 1;
+			while (Bits < 32 && (InMax - InMin) / static_cast<double>((uint64(1) << Bits) - 1) > InPrecision)
+				++Bits;
+			return FQuantize{ InMin, InMax, Bits };
+		}
+	};
+
+	/**
+	 * Tags of a field
+	 */
+	template<class... Ts>
+	using TTags = RTuple<Ts...>;
+
+	namespace Details
+	{
+		template<class T>
+		constexpr EFieldFlags GetTagTypeFlags()
+		{
+			if constexpr (requires { T::Flags; })
+				return T::Flags;
+			else
+				return EFieldFlags::None;
+		}
+
+		template<class tags_t>
+		struct TTagFlags;
+
+		template<class... Ts>
+		struct TTagFlags<RTuple<Ts...>>
+		{
+			static constexpr EFieldFlags Value = (EFieldFlags::None | ... | GetTagTypeFlags<Ts>());
+		};
+
+		template<class tag_t, class tags_t>
+		struct THasTag;
+
+		template<class tag_t, class... Ts>
+		struct THasTag<tag_t, RTuple<Ts...>>
+		{
+			static constexpr bool Value = (std::is_same_v<tag_t, Ts> || ...);
+		};
+	}
+
+	/**
+	 * Get the flags contributed by a set of tags
+	 * @tparam tags_t TTags<...>
+	 */
+	template<class tags_t>
+	constexpr EFieldFlags GetTagFlags() { return Details::TTagFlags<tags_t>::Value; }
+
+	/**
+	 * Check whether a set of tags holds a tag type
+	 * @tparam tag_t Tag type
+	 * @tparam tags_t TTags<...>
+	 */
+	template<class tag_t, class tags_t>
+	constexpr bool HasTag() { return Details::THasTag<tag_t, tags_t>::Value; }
+
+	/**
+	 * Get a tag value, the first of its type
+	 * @tparam tag_t Tag type, must be held by the tags
+	 * @param InTags Tags
+	 * @return Tag value
+	 */
+	template<class tag_t, class tags_t>
+	constexpr tag_t GetTag(const tags_t& InTags)
+	{
+		static_assert(HasTag<tag_t, tags_t>(), "Tag not found");
+		tag_t Result{};
+		bool bFound = false;
+		InTags.Visit([&](const auto& InTag)
+		{
+			if constexpr (std::is_same_v<std::decay_t<decltype(InTag)>, tag_t>)
+			{
+				if (!bFound)
+					Result = InTag;
+				bFound = true;
+			}
+		});
+		return Result;
+	}
+}
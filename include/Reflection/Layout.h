@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <stdint.h>
 
 #include "Field.h"
@@ -139,4 +140,8 @@ public:\
 );}\
 };}
 
-#define RF_ENTRY(N) ::Reflection::MakeField<typename std::decay<decltype(Type::N)>::type, offsetof(Type, N)>(WIDETEXT(#N))
+// Members keep their declared type (cv-qualifiers aside): C arrays must not decay to pointers
+#define RF_ENTRY(N) ::Reflection::MakeField<typename std::remove_cv<decltype(Type::N)>::type, offsetof(Type, N)>(WIDETEXT(#N))
+
+// Entry carrying tags, e.g RF_TAGGED_ENTRY(Position, Hot, Replicated, FQuantize{ -1.f, 1.f, 12 })
+#define RF_TAGGED_ENTRY(N, ...) ::Reflection::MakeTaggedField<typename std::remove_cv<decltype(Type::N)>::type, offsetof(Type, N)>(WIDETEXT(#N), MakeTuple(__VA_ARGS__))
@@ -0,0 +1,756 @@
+/*!
+ *  @file LayoutAsyncDeserializer.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares an incremental deserializer of the LayoutSerializer format, fed with chunks of bytes as they arrive.
+ *  Deserialization runs as a coroutine suspended whenever the pushed chunks run dry; bytes are copied straight from the
+ *  chunks into the objects, so a message is never buffered whole. DeserializeRecords() yields the objects of a stream
+ *  of records as soon as each is complete.
+ *  Nested layouts are flattened into memcpy runs like TSerializePlan; each container or string leaf (and each element
+ *  of containers of non-blittable elements) runs as a nested coroutine, whose frames are recycled per thread.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <coroutine>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <span>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "LayoutSerializer.h"
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+
+namespace Reflection
+{
+	/**
+	 * Chunked byte input of incremental deserialization
+	 * Chunks aren't copied: they must stay valid until consumed (see GetNumPendingBytes())
+	 * A source feeds a single deserialization at a time
+	 */
+	class FChunkedSource
+	{
+	public:
+		/**
+		 * Awaitable read of bytes, suspending until enough chunks are pushed
+		 * Resumes with false if the source is closed first
+		 */
+		struct FReadAwaiter
+		{
+			FChunkedSource* Source = nullptr;
+			uint8* Data = nullptr;
+			std::size_t Remaining = 0;
+			/** Wait for any input instead of reading */
+			bool bWaitForInput = false;
+
+			bool await_ready() { return Source->Fill(*this); }
+			void await_suspend(std::coroutine_handle<> InHandle)
+			{
+				Source->Waiting = InHandle;
+				Source->PendingRead = this;
+			}
+			bool await_resume() const { return bWaitForInput ? Source->NumPendingBytes > 0 : Remaining == 0; }
+		};
+
+		FChunkedSource() = default;
+		FChunkedSource(const FChunkedSource&) = delete;
+		FChunkedSource& operator=(const FChunkedSource&) = delete;
+
+		/**
+		 * Append a chunk of input
+		 * @param InChunk Bytes, referenced until consumed
+		 */
+		void Push(std::span<const uint8> InChunk)
+		{
+			if (InChunk.empty())
+				return;
+			Chunks.push_back(InChunk);
+			NumPendingBytes += InChunk.size();
+		}
+
+		/**
+		 * Mark the end of the input: reads waiting for more bytes fail
+		 */
+		void Close() { bClosed = true; }
+
+		bool IsClosed() const { return bClosed; }
+
+		/** Number of bytes pushed but not consumed yet */
+		std::size_t GetNumPendingBytes() const { return NumPendingBytes; }
+
+		/** Whether a coroutine is suspended waiting for input */
+		bool IsWaiting() const { return static_cast<bool>(Waiting); }
+
+		/**
+		 * Read bytes
+		 * @param OutData Destination
+		 * @param InSize Number of bytes
+		 * @return Awaiter resuming with false if the source is closed before InSize bytes are read
+		 */
+		FReadAwaiter Read(void* OutData, std::size_t InSize) { return FReadAwaiter{ this, static_cast<uint8*>(OutData), InSize, false }; }
+
+		/**
+		 * Wait for input
+		 * @return Awaiter resuming with false if the source is closed without pending bytes
+		 */
+		FReadAwaiter WaitForInput() { return FReadAwaiter{ this, nullptr, 0, true }; }
+
+		/**
+		 * Feed the pending read with the pushed chunks, resuming the waiting coroutine once it is complete
+		 * @return True if the coroutine was resumed
+		 */
+		bool ResumeWaiting()
+		{
+			if (!Waiting || !Fill(*PendingRead))
+				return false;
+			PendingRead = nullptr;
+			std::exchange(Waiting, nullptr).resume();
+			return true;
+		}
+
+		/**
+		 * Forget the waiting coroutine, e.g once destroyed
+		 */
+		void Detach()
+		{
+			Waiting = nullptr;
+			PendingRead = nullptr;
+		}
+
+	private:
+		/**
+		 * Copy pushed bytes to a read
+		 * @return True if the read can resume: complete, or failed as the source is closed
+		 */
+		bool Fill(FReadAwaiter& InOutRead)
+		{
+			if (InOutRead.bWaitForInput)
+				return NumPendingBytes > 0 || bClosed;
+
+			while (InOutRead.Remaining > 0 && !Chunks.empty())
+			{
+				std::span<const uint8>& Chunk = Chunks.front();
+				const std::size_t Num = std::min(Chunk.size(), InOutRead.Remaining);
+				std::memcpy(InOutRead.Data, Chunk.data(), Num);
+				InOutRead.Data += Num;
+				InOutRead.Remaining -= Num;
+				NumPendingBytes -= Num;
+				Chunk = Chunk.subspan(Num);
+				if (Chunk.empty())
+					Chunks.pop_front();
+			}
+			return InOutRead.Remaining == 0 || bClosed;
+		}
+
+		std::deque<std::span<const uint8>> Chunks;
+		std::size_t NumPendingBytes = 0;
+		std::coroutine_handle<> Waiting;
+		FReadAwaiter* PendingRead = nullptr;
+		bool bClosed = false;
+	};
+
+	namespace Details
+	{
+		/**
+		 * Recycles the coroutine frames of deserialization tasks, per thread & size class
+		 * A stream of records allocates the same frames for every record
+		 */
+		class FFrameCache
+		{
+		public:
+			static constexpr std::size_t Granularity = 64;
+			static constexpr std::size_t NumClasses = 16;
+
+			~FFrameCache()
+			{
+				for (FFreeFrame* Head : FreeLists)
+				{
+					while (Head)
+						::operator delete(std::exchange(Head, Head->Next));
+				}
+			}
+
+			static FFrameCache& Get()
+			{
+				thread_local FFrameCache Cache;
+				return Cache;
+			}
+
+			void* Allocate(std::size_t InSize)
+			{
+				const std::size_t Class = (InSize - 1) / Granularity;
+				if (Class >= NumClasses)
+					return ::operator new(InSize);
+				if (FFreeFrame* Frame = FreeLists[Class])
+				{
+					FreeLists[Class] = Frame->Next;
+					return Frame;
+				}
+				return ::operator new((Class + 1) * Granularity);
+			}
+
+			void Free(void* InFrame, std::size_t InSize)
+			{
+				const std::size_t Class = (InSize - 1) / Granularity;
+				if (Class >= NumClasses)
+				{
+					::operator delete(InFrame);
+					return;
+				}
+				FFreeFrame* Frame = static_cast<FFreeFrame*>(InFrame);
+				Frame->Next = FreeLists[Class];
+				FreeLists[Class] = Frame;
+			}
+
+		private:
+			struct FFreeFrame
+			{
+				FFreeFrame* Next;
+			};
+
+			std::array<FFreeFrame*, NumClasses> FreeLists = {};
+		};
+	}
+
+	/**
+	 * Incremental deserialization of a value, see DeserializeAsync()
+	 * Lazily started by the first Resume(); awaitable from other deserialization coroutines
+	 */
+	class [[nodiscard]] FDeserializeTask
+	{
+	public:
+		struct promise_type
+		{
+			/** Deserialization coroutines take their source first */
+			template<class... args_t>
+			promise_type(FChunkedSource& InSource, args_t&&...)
+				: Source(&InSource)
+			{
+			}
+
+			struct FFinalAwaiter
+			{
+				bool await_ready() noexcept { return false; }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> InHandle) noexcept
+				{
+					// Symmetric transfer to the awaiting coroutine, back to the resumer for the root task
+					const std::coroutine_handle<> Continuation = InHandle.promise().Continuation;
+					return Continuation ? Continuation : std::noop_coroutine();
+				}
+				void await_resume() noexcept {}
+			};
+
+			static void* operator new(std::size_t InSize) { return Details::FFrameCache::Get().Allocate(InSize); }
+			static void operator delete(void* InFrame, std::size_t InSize) { Details::FFrameCache::Get().Free(InFrame, InSize); }
+
+			FDeserializeTask get_return_object() { return FDeserializeTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			FFinalAwaiter final_suspend() noexcept { return {}; }
+			void return_value(bool bInSuccess) { bSuccess = bInSuccess; }
+			void unhandled_exception() { std::terminate(); }
+
+			FChunkedSource* Source;
+			std::coroutine_handle<> Continuation;
+			bool bSuccess = false;
+		};
+
+		FDeserializeTask(FDeserializeTask&& InOther) noexcept
+			: Handle(std::exchange(InOther.Handle, nullptr))
+			, bStarted(InOther.bStarted)
+		{
+		}
+
+		FDeserializeTask& operator=(FDeserializeTask&& InOther) noexcept
+		{
+			if (this != &InOther)
+			{
+				Release();
+				Handle = std::exchange(InOther.Handle, nullptr);
+				bStarted = InOther.bStarted;
+			}
+			return *this;
+		}
+
+		~FDeserializeTask()
+		{
+			Release();
+		}
+
+		/**
+		 * Run the deserialization until the pushed input runs dry
+		 * @return True once done, see GetResult()
+		 */
+		bool Resume()
+		{
+			if (Handle.done())
+				return true;
+			if (!bStarted)
+			{
+				bStarted = true;
+				Handle.resume();
+			}
+			else
+			{
+				Handle.promise().Source->ResumeWaiting();
+			}
+			return Handle.done();
+		}
+
+		bool IsDone() const { return Handle.done(); }
+
+		/**
+		 * Get the result of a finished deserialization
+		 * @return False if the input is malformed, or closed before the end of the value
+		 */
+		bool GetResult() const { return Handle.done() && Handle.promise().bSuccess; }
+
+		bool await_ready() const noexcept { return false; }
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> InParent) noexcept
+		{
+			Handle.promise().Continuation = InParent;
+			return Handle;
+		}
+		bool await_resume() const { return Handle.promise().bSuccess; }
+
+	private:
+		explicit FDeserializeTask(std::coroutine_handle<promise_type> InHandle)
+			: Handle(InHandle)
+		{
+		}
+
+		void Release()
+		{
+			if (!Handle)
+				return;
+			// Destroying a root task suspended on input destroys the coroutines it awaits
+			if (bStarted && !Handle.done())
+				Handle.promise().Source->Detach();
+			Handle.destroy();
+			Handle = nullptr;
+		}
+
+		std::coroutine_handle<promise_type> Handle;
+		bool bStarted = false;
+	};
+
+	/**
+	 * Generator of the objects of a stream of records, see DeserializeRecords()
+	 * Iterating yields the records completed by the pushed input, then stops until more input is pushed
+	 * @tparam T Record type
+	 */
+	template<class T>
+	class [[nodiscard]] TRecordGenerator
+	{
+	public:
+		struct promise_type
+		{
+			explicit promise_type(FChunkedSource& InSource)
+				: Source(&InSource)
+			{
+			}
+
+			TRecordGenerator get_return_object() { return TRecordGenerator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+			std::suspend_always yield_value(T& InRecord)
+			{
+				Current = &InRecord;
+				return {};
+			}
+			void return_value(bool bInSuccess) { bSuccess = bInSuccess; }
+			void unhandled_exception() { std::terminate(); }
+
+			FChunkedSource* Source;
+			T* Current = nullptr;
+			bool bSuccess = false;
+		};
+
+		class FIterator
+		{
+		public:
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+
+			FIterator() = default;
+			explicit FIterator(TRecordGenerator* InGenerator)
+				: Generator(InGenerator)
+			{
+			}
+
+			/** Record, valid until the iterator is incremented; may be moved from */
+			T& operator*() const { return *Generator->Handle.promise().Current; }
+			T* operator->() const { return Generator->Handle.promise().Current; }
+
+			FIterator& operator++()
+			{
+				Generator->Advance();
+				return *this;
+			}
+			void operator++(int) { ++*this; }
+
+			bool operator==(std::default_sentinel_t) const { return Generator->Handle.promise().Current == nullptr; }
+
+		private:
+			TRecordGenerator* Generator = nullptr;
+		};
+
+		TRecordGenerator(TRecordGenerator&& InOther) noexcept
+			: Handle(std::exchange(InOther.Handle, nullptr))
+			, bStarted(InOther.bStarted)
+		{
+		}
+
+		TRecordGenerator& operator=(TRecordGenerator&& InOther) noexcept
+		{
+			if (this != &InOther)
+			{
+				Release();
+				Handle = std::exchange(InOther.Handle, nullptr);
+				bStarted = InOther.bStarted;
+			}
+			return *this;
+		}
+
+		~TRecordGenerator()
+		{
+			Release();
+		}
+
+		/**
+		 * Deserialize the next record available
+		 * @return Iterator to the record, or to the end if the pushed input doesn't complete any
+		 */
+		FIterator begin()
+		{
+			Advance();
+			return FIterator(this);
+		}
+
+		std::default_sentinel_t end() const { return std::default_sentinel; }
+
+		/** Whether the stream ended: closed after a whole number of records, or malformed */
+		bool IsDone() const { return Handle.done(); }
+
+		/** Whether the stream ended on a malformed or truncated record */
+		bool HasError() const { return Handle.done() && !Handle.promise().bSuccess; }
+
+	private:
+		explicit TRecordGenerator(std::coroutine_handle<promise_type> InHandle)
+			: Handle(InHandle)
+		{
+		}
+
+		void Advance()
+		{
+			promise_type& Promise = Handle.promise();
+			Promise.Current = nullptr;
+			if (Handle.done())
+				return;
+
+			if (!bStarted)
+			{
+				bStarted = true;
+				Handle.resume();
+			}
+			else if (Promise.Source->IsWaiting())
+			{
+				Promise.Source->ResumeWaiting();
+			}
+			else
+			{
+				Handle.resume();
+			}
+		}
+
+		void Release()
+		{
+			if (!Handle)
+				return;
+			if (bStarted && !Handle.done())
+				Handle.promise().Source->Detach();
+			Handle.destroy();
+			Handle = nullptr;
+		}
+
+		std::coroutine_handle<promise_type> Handle;
+		bool bStarted = false;
+	};
+
+	namespace Details
+	{
+		/** Largest block of bulk elements allocated ahead of the input */
+		inline constexpr std::size_t MaxAsyncReadBlock = 64 * 1024;
+
+		template<class T>
+		struct TIsBasicString : std::false_type {};
+
+		template<class char_t, class traits_t, class allocator_t>
+		struct TIsBasicString<std::basic_string<char_t, traits_t, allocator_t>> : std::true_type {};
+
+		/**
+		 * Check whether a type is read by resizing it block by block: strings & dynamic arrays of blittable elements
+		 */
+		template<class U>
+		constexpr bool IsReadByBlocks()
+		{
+			if constexpr (TIsBasicString<U>::value)
+				return true;
+			else if constexpr (GetFieldKind<U>() == EFieldKind::DynamicArray)
+				return IsBulkSerializable<TContainerElementType<U>>();
+			else
+				return false;
+		}
+
+		template<class U>
+		FDeserializeTask ReadValueAsync(FChunkedSource& InSource, uint8* OutData);
+
+		/**
+		 * Incremental deserialization step
+		 * Either a memcpy run (Read is null) or a leaf running as a nested coroutine
+		 */
+		struct FAsyncReadStep
+		{
+			using ReadFunc = FDeserializeTask(*)(FChunkedSource&, uint8*);
+
+			/** Offset from the root object */
+			int32 Offset = 0;
+			/** Size of the run, in bytes (memcpy runs only) */
+			int32 Size = 0;
+			ReadFunc Read = nullptr;
+		};
+
+		template<int32 max_steps>
+		struct TAsyncReadPlanBuilder
+		{
+			std::array<FAsyncReadStep, max_steps> Steps = {};
+			int32 NumSteps = 0;
+
+			constexpr void AddRun(int32 InOffset, int32 InSize)
+			{
+				if (NumSteps > 0)
+				{
+					FAsyncReadStep& Last = Steps[NumSteps - 1];
+					if (Last.Read == nullptr && Last.Offset + Last.Size == InOffset)
+					{
+						Last.Size += InSize;
+						return;
+					}
+				}
+				Steps[NumSteps++] = FAsyncReadStep{ InOffset, InSize, nullptr };
+			}
+
+			constexpr void AddCustom(int32 InOffset, FAsyncReadStep::ReadFunc InRead)
+			{
+				Steps[NumSteps++] = FAsyncReadStep{ InOffset, 0, InRead };
+			}
+		};
+
+		/**
+		 * Append the steps of a layout, in the order of AppendSerializeSteps
+		 */
+		template<class T, class builder_t>
+		constexpr void AppendAsyncReadSteps(builder_t& InBuilder, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				using FieldType = typename field_t::Type;
+				const int32 Offset = InBaseOffset + static_cast<int32>(field_t::MemberOffset);
+
+				if constexpr (HasAnyFlags(field_t::Flags, EFieldFlags::Transient))
+					return;
+				else if constexpr (HasLayout<FieldType>::Value)
+					AppendAsyncReadSteps<FieldType>(InBuilder, Offset);
+				else if constexpr (IsBulkSerializable<FieldType>())
+					InBuilder.AddRun(Offset, static_cast<int32>(sizeof(FieldType)));
+				else
+					InBuilder.AddCustom(Offset, &ReadValueAsync<FieldType>);
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class T>
+		struct TAsyncReadPlan
+		{
+		private:
+			static constexpr auto Builder = []()
+			{
+				TAsyncReadPlanBuilder<TLayoutTable<T>::NumLeaves> Result;
+				AppendAsyncReadSteps<T>(Result, 0);
+				return Result;
+			}();
+
+			static constexpr std::array<FAsyncReadStep, Builder.NumSteps> BuildSteps()
+			{
+				std::array<FAsyncReadStep, Builder.NumSteps> Result = {};
+				for (int32 i = 0; i < Builder.NumSteps; ++i)
+					Result[i] = Builder.Steps[i];
+				return Result;
+			}
+
+		public:
+			static constexpr std::array<FAsyncReadStep, Builder.NumSteps> Steps = BuildSteps();
+		};
+
+		/**
+		 * Read a single value in a single coroutine frame: layouts go through their plan, container & string leaves
+		 * through nested coroutines, as do the elements of containers of non-blittable elements
+		 * @param OutData Value, of type U
+		 */
+		template<class U>
+		FDeserializeTask ReadValueAsync(FChunkedSource& InSource, uint8* OutData)
+		{
+			using TraitsType = TContainerTraits<U>;
+
+			if constexpr (HasLayout<U>::Value)
+			{
+				for (const FAsyncReadStep& Step : TAsyncReadPlan<U>::Steps)
+				{
+					bool bSuccess = false;
+					if (Step.Read == nullptr)
+						bSuccess = co_await InSource.Read(OutData + Step.Offset, Step.Size);
+					else
+						bSuccess = co_await Step.Read(InSource, OutData + Step.Offset);
+					if (!bSuccess)
+						co_return false;
+				}
+				co_return true;
+			}
+			else if constexpr (IsBlittable<U>())
+			{
+				co_return co_await InSource.Read(OutData, sizeof(U));
+			}
+			else if constexpr (IsReadByBlocks<U>())
+			{
+				using ElementType = typename U::value_type;
+				constexpr std::size_t BlockNum = std::max<std::size_t>(1, MaxAsyncReadBlock / sizeof(ElementType));
+				U& Value = *reinterpret_cast<U*>(OutData);
+
+				uint32 Num = 0;
+				if (!co_await InSource.Read(&Num, sizeof(Num)))
+					co_return false;
+
+				// Allocated as the input arrives, a corrupted count must not allocate more than the input can fill
+				Value.clear();
+				for (std::size_t Done = 0; Done < Num;)
+				{
+					const std::size_t BlockSize = std::min(Num - Done, BlockNum);
+					Value.resize(Done + BlockSize);
+					if (!co_await InSource.Read(Value.data() + Done, BlockSize * sizeof(ElementType)))
+						co_return false;
+					Done += BlockSize;
+				}
+				co_return true;
+			}
+			else if constexpr (IsContainer<U>::Value)
+			{
+				using ElementType = std::remove_const_t<typename TraitsType::ElementType>;
+				U& Value = *reinterpret_cast<U*>(OutData);
+
+				std::size_t Num = TraitsType::FixedNum;
+				if constexpr (TraitsType::Kind != EFieldKind::FixedArray)
+				{
+					uint32 SerializedNum = 0;
+					if (!co_await InSource.Read(&SerializedNum, sizeof(SerializedNum)))
+						co_return false;
+					Num = SerializedNum;
+				}
+
+				if constexpr (TraitsType::Kind == EFieldKind::DynamicArray)
+				{
+					// Non-blittable elements, grown one at a time
+					Value.clear();
+					for (std::size_t i = 0; i < Num; ++i)
+					{
+						if (!co_await ReadValueAsync<ElementType>(InSource, reinterpret_cast<uint8*>(&Value.emplace_back())))
+							co_return false;
+					}
+					co_return true;
+				}
+				else if constexpr (std::is_const_v<typename TraitsType::ElementType>)
+				{
+					co_return false;
+				}
+				else
+				{
+					if (TraitsType::Num(Value) != Num)
+						co_return false;
+
+					ElementType* Elements = TraitsType::GetData(Value);
+					if constexpr (IsBulkSerializable<ElementType>())
+					{
+						co_return co_await InSource.Read(Elements, Num * sizeof(ElementType));
+					}
+					else
+					{
+						for (std::size_t i = 0; i < Num; ++i)
+						{
+							if (!co_await ReadValueAsync<ElementType>(InSource, reinterpret_cast<uint8*>(Elements + i)))
+								co_return false;
+						}
+						co_return true;
+					}
+				}
+			}
+			else
+			{
+				static_assert(sizeof(U) == 0, "Incremental deserialization supports blittable leaves, nested layouts, containers & strings");
+				co_return false;
+			}
+		}
+
+		template<class T>
+		TRecordGenerator<T> ReadRecordsAsync(FChunkedSource& InSource)
+		{
+			for (;;)
+			{
+				// End of stream between two records
+				if (!co_await InSource.WaitForInput())
+					co_return true;
+
+				T Record{};
+				if (!co_await ReadValueAsync<T>(InSource, reinterpret_cast<uint8*>(&Record)))
+					co_return false;
+				co_yield Record;
+			}
+		}
+	}
+
+	/**
+	 * Deserialize an object incrementally, from the format written by Serialize()
+	 * Resume() the task after each Push() to the source; close the source once the input ends
+	 * @param OutObject Object to deserialize into, must outlive the task
+	 * @param InSource Input, must outlive the task
+	 * @return Task, not started
+	 */
+	template<class T>
+	FDeserializeTask DeserializeAsync(T& OutObject, FChunkedSource& InSource)
+	{
+		return Details::ReadValueAsync<T>(InSource, reinterpret_cast<uint8*>(&OutObject));
+	}
+
+	/**
+	 * Deserialize a stream of records written back to back by Serialize()
+	 * Iterate the generator after each Push() to the source; close the source once the input ends
+	 * @param InSource Input, must outlive the generator
+	 * @return Generator of records, not started
+	 */
+	template<class T>
+	TRecordGenerator<T> DeserializeRecords(FChunkedSource& InSource)
+	{
+		return Details::ReadRecordsAsync<T>(InSource);
+	}
+}
@@ -0,0 +1,342 @@
+/*!
+ *  @file LayoutBatch.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares batch operations over a single field of many objects.
+ *  Fields are accessed with a byte stride (AoS) or contiguously (e.g TLayoutSoA columns).
+ *  Float/double use SIMD when available (contiguous loads, AVX2 gathers for strided data), other types use an unrolled scalar loop.
+ *  Floating point sums are reassociated, results may differ from a sequential sum in the last bits.
+ *  NaN values are skipped by MinMax (only NaN gives the empty result) and left as is by Clamp, in vector & scalar
+ *  paths alike; Sum, Scale & AddConstant propagate them.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "Field.h"
+#include <Core/Simd.h>
+
+using int32 = std::int32_t;
+using int64 = std::int64_t;
+using uint8 = std::uint8_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	/**
+	 * Type of the result of Sum(): floating point types are summed in their own type, integers in 64 bits
+	 */
+	template<class T>
+	using TBatchSumType = typename std::conditional<std::is_floating_point_v<T>, T, typename std::conditional<std::is_signed_v<T>, int64, uint64>::type>::type;
+
+	/**
+	 * Result of MinMax()
+	 */
+	template<class T>
+	struct TMinMax
+	{
+		T Min = std::numeric_limits<T>::max();
+		T Max = std::numeric_limits<T>::lowest();
+	};
+
+	namespace Details
+	{
+		template<class T>
+		const T& StridedAt(const uint8* InBase, std::size_t InStride, std::size_t InIndex)
+		{
+			return *reinterpret_cast<const T*>(InBase + InIndex * InStride);
+		}
+
+		template<class T>
+		T& StridedAt(uint8* InBase, std::size_t InStride, std::size_t InIndex)
+		{
+			return *reinterpret_cast<T*>(InBase + InIndex * InStride);
+		}
+
+		/**
+		 * Check whether strided data can use the gather path
+		 */
+		template<class traits_t>
+		bool CanGather(std::size_t InStride)
+		{
+			return InStride * traits_t::Width <= static_cast<std::size_t>(std::numeric_limits<int32>::max());
+		}
+
+		template<class T>
+		TBatchSumType<T> SumStrided(const uint8* InBase, std::size_t InStride, std::size_t InNum)
+		{
+			using Traits = TSimdTraits<T>;
+			TBatchSumType<T> Acc[4] = {};
+			std::size_t i = 0;
+
+			if constexpr (Traits::bIsSupported)
+			{
+				typename Traits::RegisterType VAcc0 = Traits::Set1(T(0));
+				typename Traits::RegisterType VAcc1 = Traits::Set1(T(0));
+				if (InStride == sizeof(T))
+				{
+					const T* Data = reinterpret_cast<const T*>(InBase);
+					for (; i + 2 * Traits::Width <= InNum; i += 2 * Traits::Width)
+					{
+						VAcc0 = Traits::Add(VAcc0, Traits::Load(Data + i));
+						VAcc1 = Traits::Add(VAcc1, Traits::Load(Data + i + Traits::Width));
+					}
+				}
+				else if constexpr (Traits::bHasGather)
+				{
+					if (CanGather<Traits>(InStride))
+					{
+						const int32 Stride = static_cast<int32>(InStride);
+						for (; i + 2 * Traits::Width <= InNum; i += 2 * Traits::Width)
+						{
+							VAcc0 = Traits::Add(VAcc0, Traits::Gather(&StridedAt<T>(InBase, InStride, i), Stride));
+							VAcc1 = Traits::Add(VAcc1, Traits::Gather(&StridedAt<T>(InBase, InStride, i + Traits::Width), Stride));
+						}
+					}
+				}
+				Acc[0] = Traits::ReduceAdd(Traits::Add(VAcc0, VAcc1));
+			}
+
+			for (; i + 4 <= InNum; i += 4)
+			{
+				Acc[0] += StridedAt<T>(InBase, InStride, i);
+				Acc[1] += StridedAt<T>(InBase, InStride, i + 1);
+				Acc[2] += StridedAt<T>(InBase, InStride, i + 2);
+				Acc[3] += StridedAt<T>(InBase, InStride, i + 3);
+			}
+			for (; i < InNum; ++i)
+				Acc[0] += StridedAt<T>(InBase, InStride, i);
+
+			return (Acc[0] + Acc[1]) + (Acc[2] + Acc[3]);
+		}
+
+		template<class T>
+		TMinMax<T> MinMaxStrided(const uint8* InBase, std::size_t InStride, std::size_t InNum)
+		{
+			using Traits = TSimdTraits<T>;
+			TMinMax<T> Result;
+			std::size_t i = 0;
+
+			if constexpr (Traits::bIsSupported)
+			{
+				typename Traits::RegisterType VMin = Traits::Set1(Result.Min);
+				typename Traits::RegisterType VMax = Traits::Set1(Result.Max);
+				if (InStride == sizeof(T))
+				{
+					const T* Data = reinterpret_cast<const T*>(InBase);
+					for (; i + Traits::Width <= InNum; i += Traits::Width)
+					{
+						// Value first, so that NaN lanes keep the current bound, as the scalar comparisons below do
+						const typename Traits::RegisterType Value = Traits::Load(Data + i);
+						VMin = Traits::Min(Value, VMin);
+						VMax = Traits::Max(Value, VMax);
+					}
+				}
+				else if constexpr (Traits::bHasGather)
+				{
+					if (CanGather<Traits>(InStride))
+					{
+						const int32 Stride = static_cast<int32>(InStride);
+						for (; i + Traits::Width <= InNum; i += Traits::Width)
+						{
+							const typename Traits::RegisterType Value = Traits::Gather(&StridedAt<T>(InBase, InStride, i), Stride);
+							VMin = Traits::Min(Value, VMin);
+							VMax = Traits::Max(Value, VMax);
+						}
+					}
+				}
+				Result.Min = Traits::ReduceMin(VMin);
+				Result.Max = Traits::ReduceMax(VMax);
+			}
+
+			for (; i < InNum; ++i)
+			{
+				const T Value = StridedAt<T>(InBase, InStride, i);
+				Result.Min = Value < Result.Min ? Value : Result.Min;
+				Result.Max = Value > Result.Max ? Value : Result.Max;
+			}
+			return Result;
+		}
+
+		/**
+		 * Apply an element-wise operation in place
+		 * op_t provides Scalar(T) and Vector<traits_t>(traits_t::RegisterType)
+		 */
+		template<class T, class op_t>
+		void MapStrided(uint8* InBase, std::size_t InStride, std::size_t InNum, const op_t& InOp)
+		{
+			using Traits = TSimdTraits<T>;
+			std::size_t i = 0;
+
+			if constexpr (Traits::bIsSupported)
+			{
+				if (InStride == sizeof(T))
+				{
+					T* Data = reinterpret_cast<T*>(InBase);
+					for (; i + Traits::Width <= InNum; i += Traits::Width)
+						Traits::Store(Data + i, InOp.template Vector<Traits>(Traits::Load(Data + i)));
+				}
+			}
+
+			for (; i < InNum; ++i)
+			{
+				T& Value = StridedAt<T>(InBase, InStride, i);
+				Value = InOp.Scalar(Value);
+			}
+		}
+
+		template<class T>
+		struct TScaleOp
+		{
+			T Factor;
+			T Scalar(T InValue) const { return static_cast<T>(InValue * Factor); }
+			template<class traits_t>
+			typename traits_t::RegisterType Vector(typename traits_t::RegisterType InValue) const { return traits_t::Mul(InValue, traits_t::Set1(Factor)); }
+		};
+
+		template<class T>
+		struct TAddOp
+		{
+			T Value;
+			T Scalar(T InValue) const { return static_cast<T>(InValue + Value); }
+			template<class traits_t>
+			typename traits_t::RegisterType Vector(typename traits_t::RegisterType InValue) const { return traits_t::Add(InValue, traits_t::Set1(Value)); }
+		};
+
+		template<class T>
+		struct TClampOp
+		{
+			T Min;
+			T Max;
+			T Scalar(T InValue) const { return InValue < Min ? Min : (InValue > Max ? Max : InValue); }
+			// Bounds first, so that NaN lanes are kept, as in Scalar()
+			template<class traits_t>
+			typename traits_t::RegisterType Vector(typename traits_t::RegisterType InValue) const { return traits_t::Min(traits_t::Set1(Max), traits_t::Max(traits_t::Set1(Min), InValue)); }
+		};
+
+		template<class U>
+		constexpr void CheckBatchFieldType()
+		{
+			static_assert(std::is_arithmetic_v<U> && !std::is_same_v<U, bool>, "Batch operations expect a numeric field");
+		}
+	}
+
+	/**
+	 * Sum a field over many objects
+	 * @param InObjects Objects
+	 * @param InField Field of T
+	 * @return Sum of the field values
+	 */
+	template<class T, class U, int32 offset, int32 n, class tags_t>
+	TBatchSumType<U> Sum(std::span<T> InObjects, const TLayoutField<U, offset, n, tags_t>&)
+	{
+		Details::CheckBatchFieldType<U>();
+		return Details::SumStrided<U>(reinterpret_cast<const uint8*>(InObjects.data()) + offset, sizeof(T), InObjects.size());
+	}
+
+	/**
+	 * Sum contiguous values (e.g a TLayoutSoA column)
+	 * @param InValues Values
+	 * @return Sum of the values
+	 */
+	template<class U>
+	TBatchSumType<std::remove_const_t<U>> Sum(std::span<U> InValues)
+	{
+		Details::CheckBatchFieldType<std::remove_const_t<U>>();
+		return Details::SumStrided<std::remove_const_t<U>>(reinterpret_cast<const uint8*>(InValues.data()), sizeof(U), InValues.size());
+	}
+
+	/**
+	 * Compute the min & max of a field over many objects
+	 * NaN values are skipped
+	 * @param InObjects Objects
+	 * @param InField Field of T
+	 * @return Min & max, {max(), lowest()} if InObjects is empty (or only holds NaN values)
+	 */
+	template<class T, class U, int32 offset, int32 n, class tags_t>
+	TMinMax<U> MinMax(std::span<T> InObjects, const TLayoutField<U, offset, n, tags_t>&)
+	{
+		Details::CheckBatchFieldType<U>();
+		return Details::MinMaxStrided<U>(reinterpret_cast<const uint8*>(InObjects.data()) + offset, sizeof(T), InObjects.size());
+	}
+
+	/**
+	 * Compute the min & max of contiguous values
+	 * NaN values are skipped
+	 * @param InValues Values
+	 * @return Min & max, {max(), lowest()} if InValues is empty (or only holds NaN values)
+	 */
+	template<class U>
+	TMinMax<std::remove_const_t<U>> MinMax(std::span<U> InValues)
+	{
+		Details::CheckBatchFieldType<std::remove_const_t<U>>();
+		return Details::MinMaxStrided<std::remove_const_t<U>>(reinterpret_cast<const uint8*>(InValues.data()), sizeof(U), InValues.size());
+	}
+
+	/**
+	 * Multiply a field of many objects by a factor
+	 * @param InObjects Objects
+	 * @param InField Field of T
+	 * @param InFactor Factor
+	 */
+	template<class T, class U, int32 offset, int32 n, class tags_t>
+	void Scale(std::span<T> InObjects, const TLayoutField<U, offset, n, tags_t>&, U InFactor)
+	{
+		Details::CheckBatchFieldType<U>();
+		Details::MapStrided<U>(reinterpret_cast<uint8*>(InObjects.data()) + offset, sizeof(T), InObjects.size(), Details::TScaleOp<U>{ InFactor });
+	}
+
+	template<class U>
+	void Scale(std::span<U> InValues, U InFactor)
+	{
+		Details::CheckBatchFieldType<U>();
+		Details::MapStrided<U>(reinterpret_cast<uint8*>(InValues.data()), sizeof(U), InValues.size(), Details::TScaleOp<U>{ InFactor });
+	}
+
+	/**
+	 * Add a constant to a field of many objects
+	 * @param InObjects Objects
+	 * @param InField Field of T
+	 * @param InValue Value to add
+	 */
+	template<class T, class U, int32 offset, int32 n, class tags_t>
+	void AddConstant(std::span<T> InObjects, const TLayoutField<U, offset, n, tags_t>&, U InValue)
+	{
+		Details::CheckBatchFieldType<U>();
+		Details::MapStrided<U>(reinterpret_cast<uint8*>(InObjects.data()) + offset, sizeof(T), InObjects.size(), Details::TAddOp<U>{ InValue });
+	}
+
+	template<class U>
+	void AddConstant(std::span<U> InValues, U InValue)
+	{
+		Details::CheckBatchFieldType<U>();
+		Details::MapStrided<U>(reinterpret_cast<uint8*>(InValues.data()), sizeof(U), InValues.size(), Details::TAddOp<U>{ InValue });
+	}
+
+	/**
+	 * Clamp a field of many objects
+	 * NaN values are left as is
+	 * @param InObjects Objects
+	 * @param InField Field of T
+	 * @param InMin Lower bound
+	 * @param InMax Upper bound
+	 */
+	template<class T, class U, int32 offset, int32 n, class tags_t>
+	void Clamp(std::span<T> InObjects, const TLayoutField<U, offset, n, tags_t>&, U InMin, U InMax)
+	{
+		Details::CheckBatchFieldType<U>();
+		Details::MapStrided<U>(reinterpret_cast<uint8*>(InObjects.data()) + offset, sizeof(T), InObjects.size(), Details::TClampOp<U>{ InMin, InMax });
+	}
+
+	template<class U>
+	void Clamp(std::span<U> InValues, U InMin, U InMax)
+	{
+		Details::CheckBatchFieldType<U>();
+		Details::MapStrided<U>(reinterpret_cast<uint8*>(InValues.data()), sizeof(U), InValues.size(), Details::TClampOp<U>{ InMin, InMax });
+	}
+}
@@ -0,0 +1,542 @@
+/*!
+ *  @file LayoutBitSerializer.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a bit-packed serializer driven by layouts, for network packets.
+ *  Leaves tagged with FQuantize are stored on their number of bits: floating point values are mapped on their range,
+ *  integers are stored as offsets from the range minimum. Other numeric leaves keep their full width, bools take 1 bit.
+ *  The packing of a type is a compile-time list of steps unrolled into straight-line code, without per-field dispatch.
+ *  Streams are little-endian, whatever the platform. Fields tagged Transient (and their nested fields) are skipped.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <span>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ContainerTraits.h"
+#include "FieldTags.h"
+#include "Layout.h"
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using int64 = std::int64_t;
+using uint8 = std::uint8_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	namespace Details
+	{
+		constexpr uint64 GetBitMask(int32 InBits)
+		{
+			return InBits >= 64 ? ~uint64(0) : (uint64(1) << InBits) - 1;
+		}
+	}
+
+	/**
+	 * Appends bits to a growable buffer, least significant bits first
+	 * Bits are accumulated in a 64 bits word, stored once full. The buffer grows ahead of the written bytes;
+	 * Flush() stores the last partial word & trims the buffer.
+	 */
+	class FBitWriter
+	{
+	public:
+		explicit FBitWriter(std::vector<uint8>& OutBuffer)
+			: Buffer(&OutBuffer)
+			, Start(OutBuffer.size())
+		{
+		}
+
+		/**
+		 * Append bits
+		 * @param InValue Value, bits above InBits are ignored
+		 * @param InBits Number of bits, in [1, 64]
+		 */
+		void WriteBits(uint64 InValue, int32 InBits)
+		{
+			InValue &= Details::GetBitMask(InBits);
+			Scratch |= InValue << NumScratchBits;
+			NumScratchBits += InBits;
+			if (NumScratchBits >= 64)
+			{
+				StoreBytes(Scratch, 8);
+				NumScratchBits -= 64;
+				// Bits of the value that didn't fit in the stored word
+				Scratch = NumScratchBits > 0 ? InValue >> (InBits - NumScratchBits) : 0;
+			}
+		}
+
+		/**
+		 * Store the pending bits, padding the stream to a whole byte
+		 * Must be called once done writing
+		 */
+		void Flush()
+		{
+			StoreBytes(Scratch, (NumScratchBits + 7) / 8);
+			Scratch = 0;
+			NumScratchBits = 0;
+			Buffer->resize(Start + WrittenBytes);
+		}
+
+		/**
+		 * Reserve space for upcoming writes
+		 * @param InBits Number of bits about to be written
+		 */
+		void Reserve(std::size_t InBits) { Grow((NumScratchBits + InBits + 7) / 8 + 8); }
+
+		/** Number of bits written, including pending ones */
+		std::size_t GetNumBits() const { return WrittenBytes * 8 + NumScratchBits; }
+
+		std::vector<uint8>& GetBuffer() const { return *Buffer; }
+
+	private:
+		void Grow(std::size_t InNum)
+		{
+			const std::size_t Required = Start + WrittenBytes + InNum;
+			if (Buffer->size() < Required)
+				Buffer->resize(std::max(Required, Buffer->size() * 2));
+		}
+
+		void StoreBytes(uint64 InWord, int32 InNum)
+		{
+			if (Buffer->size() < Start + WrittenBytes + 8)
+				Grow(64);
+			const std::size_t Offset = Start + WrittenBytes;
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				std::memcpy(Buffer->data() + Offset, &InWord, InNum);
+			}
+			else
+			{
+				for (int32 i = 0; i < InNum; ++i)
+					(*Buffer)[Offset + i] = static_cast<uint8>(InWord >> (i * 8));
+			}
+			WrittenBytes += InNum;
+		}
+
+		std::vector<uint8>* Buffer;
+		/** Size of the buffer before writing */
+		std::size_t Start = 0;
+		uint64 Scratch = 0;
+		int32 NumScratchBits = 0;
+		std::size_t WrittenBytes = 0;
+	};
+
+	/**
+	 * Reads bits written by FBitWriter
+	 * Reading past the end sets the error flag & returns zeros
+	 */
+	class FBitReader
+	{
+	public:
+		explicit FBitReader(std::span<const uint8> InBuffer)
+			: Buffer(InBuffer)
+		{
+		}
+
+		/**
+		 * Read bits
+		 * @param InBits Number of bits, in [1, 64]
+		 * @return Value
+		 */
+		uint64 ReadBits(int32 InBits)
+		{
+			// Refills keep at least 56 bits, wider reads are split
+			if (InBits > 32)
+			{
+				const uint64 Low = ReadBits(32);
+				return Low | (ReadBits(InBits - 32) << 32);
+			}
+
+			if (NumScratchBits < InBits)
+			{
+				Refill();
+				if (NumScratchBits < InBits)
+				{
+					bError = true;
+					return 0;
+				}
+			}
+			const uint64 Value = Scratch & Details::GetBitMask(InBits);
+			Scratch >>= InBits;
+			NumScratchBits -= InBits;
+			return Value;
+		}
+
+		bool HasError() const { return bError; }
+
+		/** Number of bits left to read */
+		std::size_t GetRemainingBits() const { return (Buffer.size() - Cursor) * 8 + NumScratchBits; }
+
+	private:
+		void Refill()
+		{
+			// Cursor never passes the end of the buffer, so that the remaining size doesn't wrap
+			const std::size_t NumRemaining = Cursor < Buffer.size() ? Buffer.size() - Cursor : 0;
+			if (NumRemaining >= 8)
+			{
+				// Loads a whole word, consumes the bytes fitting in the scratch; the others are loaded again next time
+				const std::span<const uint8, 8> Bytes = Buffer.subspan(Cursor).first<8>();
+				uint64 Word = 0;
+				if constexpr (std::endian::native == std::endian::little)
+				{
+					std::memcpy(&Word, Bytes.data(), Bytes.size());
+				}
+				else
+				{
+					for (int32 i = 0; i < 8; ++i)
+						Word |= uint64(Bytes[i]) << (i * 8);
+				}
+				Scratch |= Word << NumScratchBits;
+				Cursor += (63 - NumScratchBits) >> 3;
+				NumScratchBits |= 56;
+			}
+			else
+			{
+				// Tail, a byte at a time
+				for (std::size_t i = 0; i < NumRemaining && NumScratchBits <= 56; ++i)
+				{
+					Scratch |= uint64(Buffer[Cursor++]) << NumScratchBits;
+					NumScratchBits += 8;
+				}
+			}
+		}
+
+		std::span<const uint8> Buffer;
+		std::size_t Cursor = 0;
+		uint64 Scratch = 0;
+		int32 NumScratchBits = 0;
+		bool bError = false;
+	};
+
+	/**
+	 * Encoding of a bit-packed leaf
+	 */
+	enum class EBitPackKind : uint8
+	{
+		/** Bytes of the value, e.g full width integers & floating point values */
+		Raw,
+		QuantizedFloat,
+		QuantizedDouble,
+		QuantizedSigned,
+		QuantizedUnsigned
+	};
+
+	/**
+	 * Bit packing step: one leaf (or fixed array element)
+	 */
+	struct FBitPackStep
+	{
+		/** Offset from the root object */
+		int32 Offset = 0;
+		/** Size of the value, in bytes */
+		int32 Size = 0;
+		int32 Bits = 0;
+		EBitPackKind Kind = EBitPackKind::Raw;
+		/** Quantization range, see FQuantize */
+		double Min = 0.0;
+		double Max = 0.0;
+	};
+
+	namespace Details
+	{
+		template<int32 max_steps>
+		struct TBitPackPlanBuilder
+		{
+			std::array<FBitPackStep, max_steps> Steps = {};
+			int32 NumSteps = 0;
+			int32 NumBits = 0;
+
+			constexpr void Add(const FBitPackStep& InStep)
+			{
+				Steps[NumSteps++] = InStep;
+				NumBits += InStep.Bits;
+			}
+		};
+
+		template<class U>
+		constexpr bool IsBitPackable()
+		{
+			return std::is_arithmetic_v<U> || std::is_enum_v<U>;
+		}
+
+		/**
+		 * Append the step of a value, recursing into nested layouts & fixed arrays
+		 * @tparam flags Flags of the field, inherited from its parents
+		 * @param InQuantize Quantization range, if flags has Quantized
+		 */
+		template<class U, EFieldFlags included, EFieldFlags flags, class builder_t>
+		constexpr void AppendBitPackValue(builder_t& InBuilder, int32 InOffset, const FQuantize& InQuantize);
+
+		template<class T, EFieldFlags included, EFieldFlags parent_flags, class builder_t>
+		constexpr void AppendBitPackSteps(builder_t& InBuilder, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				using FieldType = typename field_t::Type;
+				const int32 Offset = InBaseOffset + static_cast<int32>(field_t::MemberOffset);
+				constexpr EFieldFlags Flags = field_t::Flags | (parent_flags & ~EFieldFlags::Quantized);
+
+				if constexpr (HasAnyFlags(field_t::Flags, EFieldFlags::Transient))
+					return;
+				else if constexpr (HasTag<FQuantize, typename field_t::TagsType>())
+					AppendBitPackValue<FieldType, included, Flags>(InBuilder, Offset, GetTag<FQuantize>(InField.Tags));
+				else
+					AppendBitPackValue<FieldType, included, Flags>(InBuilder, Offset, FQuantize{});
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class U, EFieldFlags included, EFieldFlags flags, class builder_t>
+		constexpr void AppendBitPackValue(builder_t& InBuilder, int32 InOffset, const FQuantize& InQuantize)
+		{
+			if constexpr (HasLayout<U>::Value)
+			{
+				AppendBitPackSteps<U, included, flags>(InBuilder, InOffset);
+			}
+			else if constexpr (GetFieldKind<U>() == EFieldKind::FixedArray)
+			{
+				using ElementType = TContainerElementType<U>;
+				for (int32 i = 0; i < static_cast<int32>(TContainerTraits<U>::FixedNum); ++i)
+					AppendBitPackValue<ElementType, included, flags>(InBuilder, InOffset + i * static_cast<int32>(sizeof(ElementType)), InQuantize);
+			}
+			else if constexpr (included == EFieldFlags::None || HasAnyFlags(flags, included))
+			{
+				static_assert(IsBitPackable<U>(), "Bit packing supports numeric, bool & enum leaves, nested layouts and fixed arrays of them");
+				static_assert(sizeof(U) <= sizeof(uint64), "Bit packing supports leaves up to 64 bits, e.g not long double");
+
+				FBitPackStep Step{ InOffset, static_cast<int32>(sizeof(U)), static_cast<int32>(sizeof(U) * 8), EBitPackKind::Raw };
+				if constexpr (std::is_same_v<U, bool>)
+				{
+					Step.Bits = 1;
+				}
+				else if constexpr (std::is_arithmetic_v<U>)
+				{
+					if (HasAnyFlags(flags, EFieldFlags::Quantized) && InQuantize.Bits < Step.Bits)
+					{
+						Step.Bits = InQuantize.Bits;
+						Step.Min = InQuantize.Min;
+						Step.Max = InQuantize.Max;
+						if constexpr (std::is_same_v<U, float>)
+							Step.Kind = EBitPackKind::QuantizedFloat;
+						else if constexpr (std::is_floating_point_v<U>)
+							Step.Kind = EBitPackKind::QuantizedDouble;
+						else if constexpr (std::is_signed_v<U>)
+							Step.Kind = EBitPackKind::QuantizedSigned;
+						else
+							Step.Kind = EBitPackKind::QuantizedUnsigned;
+					}
+				}
+				InBuilder.Add(Step);
+			}
+		}
+
+		template<class T, EFieldFlags included>
+		constexpr TBitPackPlanBuilder<static_cast<int32>(sizeof(T))> BuildBitPackPlan()
+		{
+			TBitPackPlanBuilder<static_cast<int32>(sizeof(T))> Builder;
+			AppendBitPackSteps<T, included, EFieldFlags::None>(Builder, 0);
+			return Builder;
+		}
+
+		template<int32 size>
+		using TBitPackWord = std::conditional_t<size == 1, uint8, std::conditional_t<size == 2, std::uint16_t, std::conditional_t<size == 4, std::uint32_t, uint64>>>;
+
+		/**
+		 * Leaves are loaded & stored through their bytes, e.g floats as words
+		 */
+		template<class U>
+		U LoadBitPackValue(const uint8* InData)
+		{
+			U Value;
+			std::memcpy(&Value, InData, sizeof(U));
+			return Value;
+		}
+
+		template<class U>
+		void StoreBitPackValue(uint8* OutData, U InValue)
+		{
+			std::memcpy(OutData, &InValue, sizeof(U));
+		}
+
+		/**
+		 * Encode a leaf
+		 */
+		template<FBitPackStep step>
+		void WriteBitPackStep(FBitWriter& InWriter, const uint8* InObject)
+		{
+			const uint8* Data = InObject + step.Offset;
+			if constexpr (step.Kind == EBitPackKind::Raw)
+			{
+				InWriter.WriteBits(LoadBitPackValue<TBitPackWord<step.Size>>(Data), step.Bits);
+			}
+			else if constexpr (step.Kind == EBitPackKind::QuantizedFloat || step.Kind == EBitPackKind::QuantizedDouble)
+			{
+				using ValueType = std::conditional_t<step.Kind == EBitPackKind::QuantizedFloat, float, double>;
+				constexpr double Scale = static_cast<double>(GetBitMask(step.Bits)) / (step.Max - step.Min);
+				// NaN is mapped to Min
+				const double Value = std::min(step.Max, std::max(step.Min, static_cast<double>(LoadBitPackValue<ValueType>(Data))));
+				// Converted through a signed integer, cheaper than unsigned conversions without AVX-512
+				InWriter.WriteBits(static_cast<uint64>(static_cast<int64>((Value - step.Min) * Scale + 0.5)), step.Bits);
+			}
+			else
+			{
+				using ValueType = std::conditional_t<step.Kind == EBitPackKind::QuantizedSigned, int64, uint64>;
+				using WordType = TBitPackWord<step.Size>;
+				using StoredType = std::conditional_t<step.Kind == EBitPackKind::QuantizedSigned, std::make_signed_t<WordType>, WordType>;
+				constexpr ValueType Min = static_cast<ValueType>(step.Min);
+				constexpr ValueType Max = static_cast<ValueType>(step.Max);
+				const ValueType Value = std::clamp(static_cast<ValueType>(LoadBitPackValue<StoredType>(Data)), Min, Max);
+				InWriter.WriteBits(static_cast<uint64>(Value - Min), step.Bits);
+			}
+		}
+
+		/**
+		 * Decode a leaf
+		 */
+		template<FBitPackStep step>
+		void ReadBitPackStep(FBitReader& InReader, uint8* OutObject)
+		{
+			uint8* Data = OutObject + step.Offset;
+			const uint64 Bits = InReader.ReadBits(step.Bits);
+			if constexpr (step.Kind == EBitPackKind::Raw)
+			{
+				StoreBitPackValue(Data, static_cast<TBitPackWord<step.Size>>(Bits));
+			}
+			else if constexpr (step.Kind == EBitPackKind::QuantizedFloat || step.Kind == EBitPackKind::QuantizedDouble)
+			{
+				using ValueType = std::conditional_t<step.Kind == EBitPackKind::QuantizedFloat, float, double>;
+				constexpr double Scale = (step.Max - step.Min) / static_cast<double>(GetBitMask(step.Bits));
+				StoreBitPackValue(Data, static_cast<ValueType>(step.Min + static_cast<double>(static_cast<int64>(Bits)) * Scale));
+			}
+			else
+			{
+				using ValueType = std::conditional_t<step.Kind == EBitPackKind::QuantizedSigned, int64, uint64>;
+				using WordType = TBitPackWord<step.Size>;
+				using StoredType = std::conditional_t<step.Kind == EBitPackKind::QuantizedSigned, std::make_signed_t<WordType>, WordType>;
+				StoreBitPackValue(Data, static_cast<StoredType>(static_cast<ValueType>(step.Min) + static_cast<ValueType>(Bits)));
+			}
+		}
+	}
+
+	/**
+	 * Bit packing plan of a type
+	 * @tparam T Reflected type
+	 * @tparam included Only leaves with any of these flags (inherited from parent fields) are packed, every leaf if None
+	 */
+	template<class T, EFieldFlags included = EFieldFlags::None>
+	struct TBitPackPlan
+	{
+	private:
+		static constexpr auto Builder = Details::BuildBitPackPlan<T, included>();
+
+		static constexpr std::array<FBitPackStep, Builder.NumSteps> BuildSteps()
+		{
+			std::array<FBitPackStep, Builder.NumSteps> Result = {};
+			for (int32 i = 0; i < Builder.NumSteps; ++i)
+				Result[i] = Builder.Steps[i];
+			return Result;
+		}
+
+	public:
+		/** Steps to execute, in order */
+		static constexpr std::array<FBitPackStep, Builder.NumSteps> Steps = BuildSteps();
+
+		/** Bits per object */
+		static constexpr int32 NumBits = Builder.NumBits;
+
+		/**
+		 * Pack an object
+		 */
+		static void Write(const T& InObject, FBitWriter& InWriter)
+		{
+			const uint8* Data = reinterpret_cast<const uint8*>(&InObject);
+			[&]<std::size_t... steps>(std::index_sequence<steps...>)
+			{
+				(Details::WriteBitPackStep<Steps[steps]>(InWriter, Data), ...);
+			}(std::make_index_sequence<Steps.size()>());
+		}
+
+		/**
+		 * Unpack an object
+		 */
+		static void Read(T& OutObject, FBitReader& InReader)
+		{
+			uint8* Data = reinterpret_cast<uint8*>(&OutObject);
+			[&]<std::size_t... steps>(std::index_sequence<steps...>)
+			{
+				(Details::ReadBitPackStep<Steps[steps]>(InReader, Data), ...);
+			}(std::make_index_sequence<Steps.size()>());
+		}
+	};
+
+	/**
+	 * Serialize an object, bit-packed
+	 * @tparam included Only leaves with any of these flags are serialized (e.g Replicated), every leaf if None
+	 * @param InObject Object to serialize
+	 * @param InWriter Writer to append to, to be flushed once done
+	 */
+	template<EFieldFlags included = EFieldFlags::None, class T>
+	void SerializeBits(const T& InObject, FBitWriter& InWriter)
+	{
+		TBitPackPlan<T, included>::Write(InObject, InWriter);
+	}
+
+	/**
+	 * Deserialize a bit-packed object
+	 * @tparam included Flags the object was serialized with
+	 * @param OutObject Object to deserialize into; leaves not serialized are left untouched
+	 * @param InReader Reader to consume
+	 * @return False if the input is truncated, OutObject is then left untouched
+	 */
+	template<EFieldFlags included = EFieldFlags::None, class T>
+	bool DeserializeBits(T& OutObject, FBitReader& InReader)
+	{
+		using PlanType = TBitPackPlan<T, included>;
+		if (InReader.HasError() || InReader.GetRemainingBits() < static_cast<std::size_t>(PlanType::NumBits))
+			return false;
+		PlanType::Read(OutObject, InReader);
+		return true;
+	}
+
+	/**
+	 * Serialize an array of objects, bit-packed
+	 * @param InObjects Objects to serialize
+	 * @param InWriter Writer to append to, to be flushed once done
+	 */
+	template<EFieldFlags included = EFieldFlags::None, class T>
+	void SerializeBitsArray(std::span<const T> InObjects, FBitWriter& InWriter)
+	{
+		using PlanType = TBitPackPlan<T, included>;
+		InWriter.Reserve(static_cast<std::size_t>(PlanType::NumBits) * InObjects.size());
+		for (const T& Object : InObjects)
+			PlanType::Write(Object, InWriter);
+	}
+
+	/**
+	 * Deserialize an array of bit-packed objects
+	 * @param OutObjects Objects to deserialize into
+	 * @param InReader Reader to consume
+	 * @return False if the input is truncated, OutObjects are then left untouched
+	 */
+	template<EFieldFlags included = EFieldFlags::None, class T>
+	bool DeserializeBitsArray(std::span<T> OutObjects, FBitReader& InReader)
+	{
+		using PlanType = TBitPackPlan<T, included>;
+		if (InReader.HasError() || InReader.GetRemainingBits() < static_cast<std::size_t>(PlanType::NumBits) * OutObjects.size())
+			return false;
+		for (T& Object : OutObjects)
+			PlanType::Read(Object, InReader);
+		return true;
+	}
+}
@@ -0,0 +1,487 @@
+/*!
+ *  @file LayoutBlend.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares interpolation & blending of reflected objects, field by field.
+ *  Floating point leaves are blended as weighted sums, integers follow an EBlendIntegerPolicy, other leaves (bools,
+ *  enums, strings, containers...) take the value of the state of largest weight. Fields tagged NoBlend keep the value
+ *  of the first state.
+ *  Batch variants process runs of contiguous float/double leaves with SIMD; objects made only of blendable leaves of a
+ *  single floating point type are processed as one flat array. Results may differ from single object blending in the
+ *  last bits when the compiler contracts multiplications & additions differently.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+#include "ContainerTraits.h"
+#include "FieldTags.h"
+#include "Layout.h"
+#include "LayoutTable.h"
+#include <Core/Simd.h>
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+
+namespace Reflection
+{
+	/**
+	 * Blending of integer leaves
+	 */
+	enum class EBlendIntegerPolicy : uint8
+	{
+		/** Weighted sum, rounded to the nearest integer & clamped to the type range */
+		Round,
+		/** Value of the state of largest weight, e.g for identifiers */
+		Step,
+		/** Value of the first state */
+		Keep
+	};
+
+	namespace Details
+	{
+		/**
+		 * Floating point leaves blended as weighted sums, batched with SIMD
+		 */
+		template<class U>
+		constexpr bool IsBlendedFloat()
+		{
+			return std::is_same_v<U, float> || std::is_same_v<U, double>;
+		}
+
+		template<class U>
+		U RoundToInteger(double InValue)
+		{
+			const double Rounded = std::round(InValue);
+			if (!(Rounded > static_cast<double>(std::numeric_limits<U>::lowest())))
+				return std::numeric_limits<U>::lowest();
+			if (Rounded >= static_cast<double>(std::numeric_limits<U>::max()))
+				return std::numeric_limits<U>::max();
+			return static_cast<U>(Rounded);
+		}
+
+		/**
+		 * Index of the state of largest weight (the first one on ties), -1 without states
+		 */
+		inline int32 GetDominantState(std::span<const double> InWeights)
+		{
+			if (InWeights.empty())
+				return -1;
+			return static_cast<int32>(std::max_element(InWeights.begin(), InWeights.end()) - InWeights.begin());
+		}
+
+		/**
+		 * States being blended
+		 * @tparam num_states Number of states if known at compile time (e.g 2 for Lerp), 0 otherwise
+		 */
+		template<int32 num_states>
+		struct TBlendStates
+		{
+			/** Object of each state */
+			const uint8* const* Objects = nullptr;
+			const double* Weights = nullptr;
+			int32 Num = 0;
+			int32 Dominant = 0;
+
+			int32 GetNum() const { return num_states > 0 ? num_states : Num; }
+
+			template<class U>
+			const U& Get(int32 InState, int32 InOffset) const { return *reinterpret_cast<const U*>(Objects[InState] + InOffset); }
+		};
+
+		template<class T, EBlendIntegerPolicy policy, bool skip_floats, class states_t>
+		void BlendFields(uint8* OutObject, const states_t& InStates, int32 InBaseOffset);
+
+		/**
+		 * Blend a value
+		 * @tparam skip_floats Skip floating point leaves (blended by batch runs)
+		 * @param OutObject Root object receiving the value
+		 * @param InStates Root objects of the states
+		 * @param InOffset Offset of the value from the root objects
+		 */
+		template<class U, EBlendIntegerPolicy policy, bool skip_floats, class states_t>
+		void BlendValue(uint8* OutObject, const states_t& InStates, int32 InOffset)
+		{
+			U& Out = *reinterpret_cast<U*>(OutObject + InOffset);
+			if constexpr (HasLayout<U>::Value)
+			{
+				BlendFields<U, policy, skip_floats, states_t>(OutObject, InStates, InOffset);
+			}
+			else if constexpr (IsBlendedFloat<U>())
+			{
+				if constexpr (!skip_floats)
+				{
+					U Acc = InStates.template Get<U>(0, InOffset) * static_cast<U>(InStates.Weights[0]);
+					for (int32 i = 1; i < InStates.GetNum(); ++i)
+						Acc += InStates.template Get<U>(i, InOffset) * static_cast<U>(InStates.Weights[i]);
+					Out = Acc;
+				}
+			}
+			else if constexpr (std::is_integral_v<U> && !std::is_same_v<U, bool>)
+			{
+				if constexpr (policy == EBlendIntegerPolicy::Round)
+				{
+					double Acc = 0.0;
+					for (int32 i = 0; i < InStates.GetNum(); ++i)
+						Acc += static_cast<double>(InStates.template Get<U>(i, InOffset)) * InStates.Weights[i];
+					Out = RoundToInteger<U>(Acc);
+				}
+				else if constexpr (policy == EBlendIntegerPolicy::Step)
+					Out = InStates.template Get<U>(InStates.Dominant, InOffset);
+				else
+					Out = InStates.template Get<U>(0, InOffset);
+			}
+			else if constexpr (GetFieldKind<U>() == EFieldKind::FixedArray)
+			{
+				using ElementType = TContainerElementType<U>;
+				for (int32 i = 0; i < static_cast<int32>(TContainerTraits<U>::FixedNum); ++i)
+					BlendValue<ElementType, policy, skip_floats, states_t>(OutObject, InStates, InOffset + i * static_cast<int32>(sizeof(ElementType)));
+			}
+			else
+			{
+				// Discrete values
+				Out = InStates.template Get<U>(InStates.Dominant, InOffset);
+			}
+		}
+
+		template<class T, EBlendIntegerPolicy policy, bool skip_floats, class states_t>
+		void BlendFields(uint8* OutObject, const states_t& InStates, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				using FieldType = typename field_t::Type;
+				const int32 Offset = InBaseOffset + static_cast<int32>(field_t::MemberOffset);
+
+				if constexpr (HasAnyFlags(field_t::Flags, EFieldFlags::NoBlend))
+					*reinterpret_cast<FieldType*>(OutObject + Offset) = InStates.template Get<FieldType>(0, Offset);
+				else
+					BlendValue<FieldType, policy, skip_floats, states_t>(OutObject, InStates, Offset);
+			}, MakeNamedLayout<T>());
+		}
+
+		/**
+		 * Run of contiguous floating point leaves of the same type
+		 */
+		struct FBlendRun
+		{
+			int32 Offset = 0;
+			int32 Num = 0;
+			bool bDouble = false;
+		};
+
+		template<int32 max_runs>
+		struct TBlendPlanBuilder
+		{
+			std::array<FBlendRun, max_runs> Runs = {};
+			int32 NumRuns = 0;
+			bool bHasOtherLeaves = false;
+
+			constexpr void AddFloats(int32 InOffset, int32 InNum, bool bInDouble)
+			{
+				if (NumRuns > 0)
+				{
+					FBlendRun& Last = Runs[NumRuns - 1];
+					if (Last.bDouble == bInDouble && Last.Offset + Last.Num * (bInDouble ? 8 : 4) == InOffset)
+					{
+						Last.Num += InNum;
+						return;
+					}
+				}
+				Runs[NumRuns++] = FBlendRun{ InOffset, InNum, bInDouble };
+			}
+		};
+
+		template<class U, class builder_t>
+		constexpr void AppendBlendValue(builder_t& InBuilder, int32 InOffset);
+
+		/**
+		 * Append the blended floating point leaves of a layout, mirroring BlendFields
+		 */
+		template<class T, class builder_t>
+		constexpr void AppendBlendFields(builder_t& InBuilder, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				const int32 Offset = InBaseOffset + static_cast<int32>(field_t::MemberOffset);
+				if constexpr (HasAnyFlags(field_t::Flags, EFieldFlags::NoBlend))
+					InBuilder.bHasOtherLeaves = true;
+				else
+					AppendBlendValue<typename field_t::Type>(InBuilder, Offset);
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class U, class builder_t>
+		constexpr void AppendBlendValue(builder_t& InBuilder, int32 InOffset)
+		{
+			if constexpr (HasLayout<U>::Value)
+				AppendBlendFields<U>(InBuilder, InOffset);
+			else if constexpr (IsBlendedFloat<U>())
+				InBuilder.AddFloats(InOffset, 1, std::is_same_v<U, double>);
+			else if constexpr (GetFieldKind<U>() == EFieldKind::FixedArray)
+			{
+				using ElementType = TContainerElementType<U>;
+				for (int32 i = 0; i < static_cast<int32>(TContainerTraits<U>::FixedNum); ++i)
+					AppendBlendValue<ElementType>(InBuilder, InOffset + i * static_cast<int32>(sizeof(ElementType)));
+			}
+			else
+				InBuilder.bHasOtherLeaves = true;
+		}
+
+		/**
+		 * Upper bound of the number of floating point values of a type
+		 */
+		template<class T>
+		constexpr int32 GetMaxBlendRuns()
+		{
+			return static_cast<int32>(sizeof(T) / sizeof(float)) + 1;
+		}
+
+		template<class T>
+		constexpr TBlendPlanBuilder<GetMaxBlendRuns<T>()> BuildBlendPlan()
+		{
+			TBlendPlanBuilder<GetMaxBlendRuns<T>()> Builder;
+			AppendBlendFields<T>(Builder, 0);
+			return Builder;
+		}
+
+		/**
+		 * Blend a run of floating point values of many objects
+		 * @param OutBase First output object
+		 * @param InBases First object of each state
+		 * @param InOffset Offset of the run within objects
+		 * @param InStride Distance between two objects
+		 * @param InNumObjects Number of objects
+		 * @param InNum Number of values per run
+		 */
+		template<class U, int32 num_states>
+		void BlendRun(uint8* OutBase, const uint8* const* InBases, int32 InOffset, const double* InWeights, int32 InNumStates, std::size_t InStride, std::size_t InNumObjects, std::size_t InNum)
+		{
+			using Traits = TSimdTraits<U>;
+			if constexpr (num_states > 0)
+				InNumStates = num_states;
+			for (std::size_t Object = 0; Object < InNumObjects; ++Object)
+			{
+				U* Out = reinterpret_cast<U*>(OutBase + Object * InStride + InOffset);
+				auto GetState = [&](int32 InState) { return reinterpret_cast<const U*>(InBases[InState] + Object * InStride + InOffset); };
+				std::size_t i = 0;
+
+				if constexpr (Traits::bIsSupported)
+				{
+					for (; i + Traits::Width <= InNum; i += Traits::Width)
+					{
+						typename Traits::RegisterType Acc = Traits::Mul(Traits::Load(GetState(0) + i), Traits::Set1(static_cast<U>(InWeights[0])));
+						for (int32 State = 1; State < InNumStates; ++State)
+							Acc = Traits::Add(Acc, Traits::Mul(Traits::Load(GetState(State) + i), Traits::Set1(static_cast<U>(InWeights[State]))));
+						Traits::Store(Out + i, Acc);
+					}
+				}
+
+				for (; i < InNum; ++i)
+				{
+					U Acc = GetState(0)[i] * static_cast<U>(InWeights[0]);
+					for (int32 State = 1; State < InNumStates; ++State)
+						Acc += GetState(State)[i] * static_cast<U>(InWeights[State]);
+					Out[i] = Acc;
+				}
+			}
+		}
+	}
+
+	/**
+	 * Blend plan of a type: runs of contiguous floating point leaves, batched with SIMD
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TBlendPlan
+	{
+	private:
+		static constexpr auto Builder = Details::BuildBlendPlan<T>();
+
+		static constexpr std::array<Details::FBlendRun, Builder.NumRuns> BuildRuns()
+		{
+			std::array<Details::FBlendRun, Builder.NumRuns> Result = {};
+			for (int32 i = 0; i < Builder.NumRuns; ++i)
+				Result[i] = Builder.Runs[i];
+			return Result;
+		}
+
+	public:
+		/** Runs of floating point leaves, by offset */
+		static constexpr std::array<Details::FBlendRun, Builder.NumRuns> Runs = BuildRuns();
+
+		/** Whether some leaves aren't blended by runs (integers, discrete values, NoBlend fields) */
+		static constexpr bool bHasOtherLeaves = Builder.bHasOtherLeaves;
+
+		/** Whether some runs are long enough to be worth processing with SIMD, across objects */
+		static constexpr bool bHasLongRuns = []()
+		{
+			for (const Details::FBlendRun& Run : Runs)
+			{
+				if (Run.Num >= (Run.bDouble ? 4 : 8))
+					return true;
+			}
+			return false;
+		}();
+
+		/** Whether T is a single run covering the whole object, so that arrays of T blend as one flat array */
+		static constexpr bool bIsFlat = !bHasOtherLeaves && Runs.size() == 1 && Runs[0].Offset == 0
+			&& Runs[0].Num * (Runs[0].bDouble ? sizeof(double) : sizeof(float)) == sizeof(T);
+	};
+
+	/**
+	 * Blend many states of an object
+	 * @tparam policy Blending of integer leaves
+	 * @param InStates States
+	 * @param InWeights Weight of each state, usually summing to 1
+	 * @param OutResult Blended object, may be one of the states
+	 * @return False if there are no states or not one weight per state, OutResult being left untouched
+	 */
+	template<EBlendIntegerPolicy policy = EBlendIntegerPolicy::Round, class T, std::size_t num_states = std::dynamic_extent>
+	bool Blend(std::span<const T* const, num_states> InStates, std::span<const double, num_states> InWeights, T& OutResult)
+	{
+		if (InStates.empty() || InWeights.size() != InStates.size())
+			return false;
+
+		using StatesType = Details::TBlendStates<num_states == std::dynamic_extent ? 0 : static_cast<int32>(num_states)>;
+		using ObjectsType = std::conditional_t<num_states == std::dynamic_extent, std::vector<const uint8*>, std::array<const uint8*, num_states == std::dynamic_extent ? 1 : num_states>>;
+
+		// Copy the pointers rather than reading T* objects through uint8* (strict aliasing)
+		ObjectsType Objects = {};
+		if constexpr (num_states == std::dynamic_extent)
+			Objects.resize(InStates.size());
+		for (std::size_t i = 0; i < InStates.size(); ++i)
+			Objects[i] = reinterpret_cast<const uint8*>(InStates[i]);
+		const StatesType States{ Objects.data(), InWeights.data(), static_cast<int32>(InStates.size()), Details::GetDominantState(InWeights) };
+		Details::BlendFields<T, policy, false>(reinterpret_cast<uint8*>(&OutResult), States, 0);
+		return true;
+	}
+
+	/**
+	 * Interpolate between two states of an object
+	 * @tparam policy Blending of integer leaves
+	 * @param InA State at alpha 0
+	 * @param InB State at alpha 1
+	 * @param InAlpha Interpolation factor
+	 * @param OutResult Interpolated object, may be InA or InB
+	 */
+	template<EBlendIntegerPolicy policy = EBlendIntegerPolicy::Round, class T>
+	void Lerp(const T& InA, const T& InB, double InAlpha, T& OutResult)
+	{
+		const T* States[2] = { &InA, &InB };
+		const double Weights[2] = { 1.0 - InAlpha, InAlpha };
+		Blend<policy, T, 2>(States, Weights, OutResult);
+	}
+
+	template<EBlendIntegerPolicy policy = EBlendIntegerPolicy::Round, class T>
+	T Lerp(const T& InA, const T& InB, double InAlpha)
+	{
+		T Result = InA;
+		Lerp<policy>(InA, InB, InAlpha, Result);
+		return Result;
+	}
+
+	/**
+	 * Blend many states of many objects
+	 * @tparam policy Blending of integer leaves
+	 * @param InStates States, each holding as many objects as OutResults
+	 * @param InWeights Weight of each state, usually summing to 1
+	 * @param OutResults Blended objects, may be one of the states
+	 * @return False if there are no states, not one weight per state or a state doesn't hold as many objects as OutResults,
+	 * OutResults being left untouched
+	 */
+	template<EBlendIntegerPolicy policy = EBlendIntegerPolicy::Round, class T, std::size_t num_states = std::dynamic_extent>
+	bool BlendBatch(std::span<const std::span<const T>, num_states> InStates, std::span<const double, num_states> InWeights, std::span<T> OutResults)
+	{
+		if (InStates.empty() || InWeights.size() != InStates.size())
+			return false;
+		for (const std::span<const T>& State : InStates)
+		{
+			if (State.size() != OutResults.size())
+				return false;
+		}
+
+		using PlanType = TBlendPlan<T>;
+		constexpr int32 NumStaticStates = num_states == std::dynamic_extent ? 0 : static_cast<int32>(num_states);
+		const int32 NumStates = static_cast<int32>(InStates.size());
+		const std::size_t NumObjects = OutResults.size();
+		uint8* OutBase = reinterpret_cast<uint8*>(OutResults.data());
+
+		std::vector<const uint8*> Bases(InStates.size());
+		for (std::size_t i = 0; i < InStates.size(); ++i)
+			Bases[i] = reinterpret_cast<const uint8*>(InStates[i].data());
+
+		if constexpr (PlanType::bIsFlat)
+		{
+			constexpr Details::FBlendRun Run = PlanType::Runs[0];
+			if constexpr (Run.bDouble)
+				Details::BlendRun<double, NumStaticStates>(OutBase, Bases.data(), 0, InWeights.data(), NumStates, 0, 1, NumObjects * Run.Num);
+			else
+				Details::BlendRun<float, NumStaticStates>(OutBase, Bases.data(), 0, InWeights.data(), NumStates, 0, 1, NumObjects * Run.Num);
+			return true;
+		}
+
+		if constexpr (!PlanType::bHasLongRuns)
+		{
+			// Too short for SIMD to pay off, blend field by field
+			std::vector<const uint8*> ObjectBases(InStates.size());
+			const Details::TBlendStates<NumStaticStates> States{ ObjectBases.data(), InWeights.data(), NumStates, Details::GetDominantState(InWeights) };
+			for (std::size_t Object = 0; Object < NumObjects; ++Object)
+			{
+				for (std::size_t i = 0; i < Bases.size(); ++i)
+					ObjectBases[i] = Bases[i] + Object * sizeof(T);
+				Details::BlendFields<T, policy, false>(OutBase + Object * sizeof(T), States, 0);
+			}
+			return true;
+		}
+
+		for (const Details::FBlendRun& Run : PlanType::Runs)
+		{
+			if (Run.bDouble)
+				Details::BlendRun<double, NumStaticStates>(OutBase, Bases.data(), Run.Offset, InWeights.data(), NumStates, sizeof(T), NumObjects, Run.Num);
+			else
+				Details::BlendRun<float, NumStaticStates>(OutBase, Bases.data(), Run.Offset, InWeights.data(), NumStates, sizeof(T), NumObjects, Run.Num);
+		}
+
+		if constexpr (PlanType::bHasOtherLeaves)
+		{
+			std::vector<const uint8*> ObjectBases(InStates.size());
+			const Details::TBlendStates<NumStaticStates> States{ ObjectBases.data(), InWeights.data(), NumStates, Details::GetDominantState(InWeights) };
+			for (std::size_t Object = 0; Object < NumObjects; ++Object)
+			{
+				for (std::size_t i = 0; i < Bases.size(); ++i)
+					ObjectBases[i] = Bases[i] + Object * sizeof(T);
+				Details::BlendFields<T, policy, true>(OutBase + Object * sizeof(T), States, 0);
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Interpolate between two states of many objects
+	 * @tparam policy Blending of integer leaves
+	 * @param InA States at alpha 0
+	 * @param InB States at alpha 1, as many as InA
+	 * @param InAlpha Interpolation factor
+	 * @param OutResults Interpolated objects, as many as InA, may be InA or InB
+	 * @return False if InA, InB & OutResults don't hold as many objects, OutResults being left untouched
+	 */
+	template<EBlendIntegerPolicy policy = EBlendIntegerPolicy::Round, class T>
+	bool LerpBatch(std::span<const T> InA, std::span<const T> InB, double InAlpha, std::span<T> OutResults)
+	{
+		const std::span<const T> States[2] = { InA, InB };
+		const double Weights[2] = { 1.0 - InAlpha, InAlpha };
+		return BlendBatch<policy, T, 2>(States, Weights, OutResults);
+	}
+}
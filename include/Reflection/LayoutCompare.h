@@ -0,0 +1,362 @@
+/*!
+ *  @file LayoutCompare.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares equality & ordering of reflected objects, generated from their layout.
+ *  Bytewise comparable types (see TIsBytewiseComparable) are compared for equality with a single memcmp. Other types
+ *  follow a compile-time plan: runs of adjacent bytewise comparable leaves are merged into memcmp ranges, runs of
+ *  contiguous float/double leaves are compared with SIMD and remaining leaves with their operator==.
+ *  Ordering compares fields in layout order, as a defaulted operator<=> would; byte order doesn't match the order of
+ *  multi-byte integers, so only arrays of unsigned bytes are ordered with memcmp.
+ *  Floating point leaves follow operator== & operator<=>: NaN is unordered, -0 equals +0.
+ *  See LayoutHash.h for hashing consistent with this equality.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "LayoutPadding.h"
+#include <Core/Simd.h>
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+
+namespace Reflection
+{
+	template<class T>
+	bool EqualsLayout(const T& InA, const T& InB);
+
+	template<class T>
+	std::partial_ordering CompareLayout(const T& InA, const T& InB);
+
+	namespace Details
+	{
+		/**
+		 * Compare two arrays of floating point values, Width values at a time
+		 */
+		template<class U>
+		bool EqualFloats(const U* InA, const U* InB, std::size_t InNum)
+		{
+			using Traits = TSimdTraits<U>;
+			std::size_t i = 0;
+			if constexpr (Traits::bIsSupported)
+			{
+				for (; i + Traits::Width <= InNum; i += Traits::Width)
+				{
+					if (!Traits::AllEqual(Traits::Load(InA + i), Traits::Load(InB + i)))
+						return false;
+				}
+			}
+			for (; i < InNum; ++i)
+			{
+				if (!(InA[i] == InB[i]))
+					return false;
+			}
+			return true;
+		}
+
+		template<class U>
+		constexpr bool IsComparedFloat()
+		{
+			return std::is_same_v<U, float> || std::is_same_v<U, double>;
+		}
+
+		/**
+		 * Check whether a value of a leaf type is equal to another, for leaves not covered by memcmp or SIMD runs
+		 */
+		template<class U>
+		bool EqualsValue(const U& InA, const U& InB)
+		{
+			if constexpr (HasLayout<U>::Value)
+			{
+				return EqualsLayout(InA, InB);
+			}
+			else if constexpr (IsContainer<U>::Value)
+			{
+				using ElementType = std::remove_const_t<TContainerElementType<U>>;
+				const auto A = GetElements(InA);
+				const auto B = GetElements(InB);
+				if (A.size() != B.size())
+					return false;
+
+				if constexpr (TIsBytewiseComparable<ElementType>::Value)
+					return A.empty() || std::memcmp(A.data(), B.data(), A.size_bytes()) == 0;
+				else if constexpr (IsComparedFloat<ElementType>())
+					return EqualFloats<ElementType>(A.data(), B.data(), A.size());
+				else
+					return std::equal(A.begin(), A.end(), B.begin(), [](const ElementType& InElementA, const ElementType& InElementB) { return EqualsValue(InElementA, InElementB); });
+			}
+			else if constexpr (std::equality_comparable<U>)
+			{
+				return InA == InB;
+			}
+			else
+			{
+				static_assert(sizeof(U) == 0, "Unable to compare this field type, declare operator==");
+				return false;
+			}
+		}
+
+		template<class U>
+		bool EqualsLeaf(const uint8* InA, const uint8* InB)
+		{
+			return EqualsValue(*reinterpret_cast<const U*>(InA), *reinterpret_cast<const U*>(InB));
+		}
+
+		enum class ECompareStepKind : uint8
+		{
+			/** memcmp of a range of bytewise comparable leaves */
+			Bytes,
+			Floats,
+			Doubles,
+			/** Single leaf compared with EqualsValue */
+			Value
+		};
+
+		/**
+		 * Step of an equality plan
+		 */
+		struct FCompareStep
+		{
+			int32 Offset = 0;
+			/** Bytes for Bytes steps, number of values for Floats/Doubles steps */
+			int32 Size = 0;
+			ECompareStepKind Kind = ECompareStepKind::Bytes;
+			bool (*Equals)(const uint8*, const uint8*) = nullptr;
+		};
+
+		template<int32 max_steps>
+		struct TComparePlanBuilder
+		{
+			std::array<FCompareStep, max_steps> Steps = {};
+			int32 NumSteps = 0;
+
+			/**
+			 * Append a step, extending the last one when contiguous & of the same kind
+			 * @param InElementSize Bytes per unit of Size
+			 */
+			constexpr void Add(ECompareStepKind InKind, int32 InOffset, int32 InSize, int32 InElementSize)
+			{
+				if (NumSteps > 0)
+				{
+					FCompareStep& Last = Steps[NumSteps - 1];
+					if (Last.Kind == InKind && Last.Offset + Last.Size * InElementSize == InOffset)
+					{
+						Last.Size += InSize;
+						return;
+					}
+				}
+				Steps[NumSteps++] = FCompareStep{ InOffset, InSize, InKind, nullptr };
+			}
+
+			constexpr void AddValue(int32 InOffset, int32 InSize, bool (*InEquals)(const uint8*, const uint8*))
+			{
+				Steps[NumSteps++] = FCompareStep{ InOffset, InSize, ECompareStepKind::Value, InEquals };
+			}
+		};
+
+		template<class U, class builder_t>
+		constexpr void AppendCompareValue(builder_t& InBuilder, int32 InOffset);
+
+		template<class T, class builder_t>
+		constexpr void AppendCompareFields(builder_t& InBuilder, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				AppendCompareValue<typename field_t::Type>(InBuilder, InBaseOffset + static_cast<int32>(field_t::MemberOffset));
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class U, class builder_t>
+		constexpr void AppendCompareValue(builder_t& InBuilder, int32 InOffset)
+		{
+			if constexpr (TIsBytewiseComparable<U>::Value)
+				InBuilder.Add(ECompareStepKind::Bytes, InOffset, static_cast<int32>(sizeof(U)), 1);
+			else if constexpr (HasLayout<U>::Value)
+				AppendCompareFields<U>(InBuilder, InOffset);
+			else if constexpr (std::is_same_v<U, float>)
+				InBuilder.Add(ECompareStepKind::Floats, InOffset, 1, 4);
+			else if constexpr (std::is_same_v<U, double>)
+				InBuilder.Add(ECompareStepKind::Doubles, InOffset, 1, 8);
+			else if constexpr (GetFieldKind<U>() == EFieldKind::FixedArray)
+			{
+				using ElementType = std::remove_const_t<TContainerElementType<U>>;
+				for (int32 i = 0; i < static_cast<int32>(TContainerTraits<U>::FixedNum); ++i)
+					AppendCompareValue<ElementType>(InBuilder, InOffset + i * static_cast<int32>(sizeof(ElementType)));
+			}
+			else
+				InBuilder.AddValue(InOffset, static_cast<int32>(sizeof(U)), &EqualsLeaf<U>);
+		}
+
+		template<class T>
+		constexpr auto BuildComparePlan()
+		{
+			TComparePlanBuilder<static_cast<int32>(sizeof(T))> Builder;
+			AppendCompareFields<T>(Builder, 0);
+			return Builder;
+		}
+
+		/**
+		 * Check whether T has a byte order matching its value order, i.e memcmp orders arrays of T
+		 */
+		template<class T>
+		constexpr bool IsByteOrdered()
+		{
+			return std::is_same_v<T, unsigned char> || std::is_same_v<T, std::byte> || std::is_same_v<T, char8_t>;
+		}
+
+		/**
+		 * Order two values of a field type
+		 */
+		template<class U>
+		std::partial_ordering CompareValue(const U& InA, const U& InB)
+		{
+			if constexpr (HasLayout<U>::Value)
+			{
+				return CompareLayout(InA, InB);
+			}
+			else if constexpr (IsContainer<U>::Value)
+			{
+				using ElementType = std::remove_const_t<TContainerElementType<U>>;
+				const auto A = GetElements(InA);
+				const auto B = GetElements(InB);
+				if constexpr (IsByteOrdered<ElementType>())
+				{
+					const int Result = A.empty() || B.empty() ? 0 : std::memcmp(A.data(), B.data(), std::min(A.size(), B.size()));
+					return Result != 0 ? Result <=> 0 : A.size() <=> B.size();
+				}
+				else
+				{
+					return std::lexicographical_compare_three_way(A.begin(), A.end(), B.begin(), B.end(),
+						[](const ElementType& InElementA, const ElementType& InElementB) { return CompareValue(InElementA, InElementB); });
+				}
+			}
+			else if constexpr (std::three_way_comparable<U, std::partial_ordering>)
+			{
+				return InA <=> InB;
+			}
+			else
+			{
+				static_assert(sizeof(U) == 0, "Unable to order this field type, declare operator<=>");
+				return std::partial_ordering::unordered;
+			}
+		}
+	}
+
+	/**
+	 * Equality plan of a type, runs of leaves compared with memcmp or SIMD
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TComparePlan
+	{
+	private:
+		static constexpr auto Builder = Details::BuildComparePlan<T>();
+
+		static constexpr std::array<Details::FCompareStep, Builder.NumSteps> BuildSteps()
+		{
+			std::array<Details::FCompareStep, Builder.NumSteps> Result = {};
+			for (int32 i = 0; i < Builder.NumSteps; ++i)
+				Result[i] = Builder.Steps[i];
+			return Result;
+		}
+
+	public:
+		/** Steps, in layout order */
+		static constexpr std::array<Details::FCompareStep, Builder.NumSteps> Steps = BuildSteps();
+
+		/**
+		 * Check whether two objects are equal, stopping at the first different step
+		 */
+		static bool Equals(const uint8* InA, const uint8* InB)
+		{
+			return [&]<std::size_t... i>(std::index_sequence<i...>)
+			{
+				return (EqualsStep<i>(InA, InB) && ...);
+			}(std::make_index_sequence<Steps.size()>{});
+		}
+
+	private:
+		/**
+		 * Compare a run of floating point values, unrolled when shorter than two vectors
+		 */
+		template<class U, int32 num>
+		static bool EqualsRun(const uint8* InA, const uint8* InB)
+		{
+			const U* A = reinterpret_cast<const U*>(InA);
+			const U* B = reinterpret_cast<const U*>(InB);
+			if constexpr (TSimdTraits<U>::bIsSupported && num >= 2 * TSimdTraits<U>::Width)
+				return Details::EqualFloats(A, B, num);
+			else
+			{
+				return [&]<std::size_t... i>(std::index_sequence<i...>)
+				{
+					return ((A[i] == B[i]) && ...);
+				}(std::make_index_sequence<num>{});
+			}
+		}
+
+		template<std::size_t index>
+		static bool EqualsStep(const uint8* InA, const uint8* InB)
+		{
+			constexpr Details::FCompareStep Step = Steps[index];
+			const uint8* A = InA + Step.Offset;
+			const uint8* B = InB + Step.Offset;
+			if constexpr (Step.Kind == Details::ECompareStepKind::Bytes)
+				return std::memcmp(A, B, Step.Size) == 0;
+			else if constexpr (Step.Kind == Details::ECompareStepKind::Floats)
+				return EqualsRun<float, Step.Size>(A, B);
+			else if constexpr (Step.Kind == Details::ECompareStepKind::Doubles)
+				return EqualsRun<double, Step.Size>(A, B);
+			else
+				return Step.Equals(A, B);
+		}
+	};
+
+	/**
+	 * Check whether two objects are equal, field by field
+	 * Bytewise comparable objects are compared with a single memcmp
+	 * @return Whether every reflected field of InA compares equal to the same field of InB
+	 */
+	template<class T>
+	bool EqualsLayout(const T& InA, const T& InB)
+	{
+		if constexpr (TIsBytewiseComparable<T>::Value)
+			return std::memcmp(&InA, &InB, sizeof(T)) == 0;
+		else
+			return TComparePlan<T>::Equals(reinterpret_cast<const uint8*>(&InA), reinterpret_cast<const uint8*>(&InB));
+	}
+
+	/**
+	 * Order two objects, field by field in layout order (lexicographically)
+	 * Containers are ordered lexicographically by element, then by size
+	 * @return Order of the first field not equivalent, equivalent if none
+	 */
+	template<class T>
+	std::partial_ordering CompareLayout(const T& InA, const T& InB)
+	{
+		const uint8* A = reinterpret_cast<const uint8*>(&InA);
+		const uint8* B = reinterpret_cast<const uint8*>(&InB);
+		std::partial_ordering Result = std::partial_ordering::equivalent;
+		VisitTupleElements([&](const auto& InField)
+		{
+			using field_t = std::decay_t<decltype(InField)>;
+			using FieldType = typename field_t::Type;
+			if (Result == std::partial_ordering::equivalent)
+				Result = Details::CompareValue(*reinterpret_cast<const FieldType*>(A + field_t::MemberOffset), *reinterpret_cast<const FieldType*>(B + field_t::MemberOffset));
+		}, MakeNamedLayout<T>());
+		return Result;
+	}
+}
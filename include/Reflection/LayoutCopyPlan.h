@@ -0,0 +1,289 @@
+/*!
+ *  @file LayoutCopyPlan.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares copy plans: precomputed copies of a subset of the fields of a type.
+ *  Leaves are selected by tag flags, by name or by a compile-time field pack; selected blittable leaves adjacent in
+ *  memory are merged into a single byte range. Short ranges are split into 8 & 4 byte words when the plan is built, so
+ *  that copying runs constant size moves over precomputed offsets, without branching on range sizes. Other leaves are
+ *  copied with their copy assignment operator.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <initializer_list>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "ContainerTraits.h"
+#include "FieldTags.h"
+#include "Layout.h"
+#include "LayoutDescriptor.h"
+#include "LayoutTable.h"
+#include "LayoutView.h"
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+
+namespace Reflection
+{
+	/**
+	 * Range of bytes copied by a plan
+	 */
+	struct FCopyRange
+	{
+		int32 Offset = 0;
+		int32 Size = 0;
+		/** Copy of a non-blittable leaf, null for byte ranges */
+		void (*Copy)(void* OutObject, const void* InObject) = nullptr;
+	};
+
+	/**
+	 * Precomputed copy of a subset of the fields of a type, see MakeCopyPlan()
+	 */
+	class FLayoutCopyPlan
+	{
+	public:
+		FLayoutCopyPlan() = default;
+
+		/**
+		 * Build a plan from the leaves of a type
+		 * @param InLeaves Leaves, by rank; byte ranges for blittable leaves, copy operations otherwise
+		 * @param InSelected Whether each leaf is copied, by rank
+		 */
+		FLayoutCopyPlan(std::span<const FCopyRange> InLeaves, std::span<const bool> InSelected)
+		{
+			std::vector<int32> Order(InLeaves.size());
+			std::iota(Order.begin(), Order.end(), 0);
+			std::stable_sort(Order.begin(), Order.end(), [&InLeaves](int32 InA, int32 InB) { return InLeaves[InA].Offset < InLeaves[InB].Offset; });
+
+			bool bCanExtend = false;
+			for (int32 Rank : Order)
+			{
+				const FCopyRange& Leaf = InLeaves[Rank];
+				if (!InSelected[Rank] || Leaf.Size == 0)
+				{
+					bCanExtend = false;
+					continue;
+				}
+
+				NumSelectedBytes += Leaf.Size;
+				FCopyRange* Last = Ranges.empty() ? nullptr : &Ranges.back();
+				if (bCanExtend && Leaf.Copy == nullptr && Last->Offset + Last->Size == Leaf.Offset)
+					Last->Size += Leaf.Size;
+				else
+					Ranges.push_back(Leaf);
+				bCanExtend = Leaf.Copy == nullptr;
+			}
+
+			for (const FCopyRange& Range : Ranges)
+			{
+				if (Range.Copy != nullptr || Range.Size > MaxSplitRangeSize)
+				{
+					Others.push_back(Range);
+					continue;
+				}
+				int32 Offset = Range.Offset;
+				const int32 End = Range.Offset + Range.Size;
+				for (; Offset + 8 <= End; Offset += 8)
+					WordOffsets.push_back(Offset);
+				if (Offset + 4 <= End)
+				{
+					HalfWordOffsets.push_back(Offset);
+					Offset += 4;
+				}
+				if (Offset < End)
+					Others.push_back(FCopyRange{ Offset, End - Offset, nullptr });
+			}
+		}
+
+		/**
+		 * Copy the selected fields between two objects
+		 * @param OutObject Object to copy to
+		 * @param InObject Object to copy from
+		 */
+		void Copy(uint8* OutObject, const uint8* InObject) const
+		{
+			for (const int32 Offset : WordOffsets)
+				std::memcpy(OutObject + Offset, InObject + Offset, 8);
+			for (const int32 Offset : HalfWordOffsets)
+				std::memcpy(OutObject + Offset, InObject + Offset, 4);
+			for (const FCopyRange& Range : Others)
+			{
+				if (Range.Copy == nullptr)
+					std::memcpy(OutObject + Range.Offset, InObject + Range.Offset, Range.Size);
+				else
+					Range.Copy(OutObject + Range.Offset, InObject + Range.Offset);
+			}
+		}
+
+		/** Copied ranges, by offset */
+		std::span<const FCopyRange> GetRanges() const { return Ranges; }
+
+		/** Bytes of the selected fields */
+		int32 GetNumBytes() const { return NumSelectedBytes; }
+
+		bool IsEmpty() const { return Ranges.empty(); }
+
+	private:
+		/** Larger ranges are copied with a single memcpy */
+		static constexpr int32 MaxSplitRangeSize = 64;
+
+		std::vector<FCopyRange> Ranges;
+		/** Offsets of the 8 & 4 byte words of ranges up to MaxSplitRangeSize */
+		std::vector<int32> WordOffsets;
+		std::vector<int32> HalfWordOffsets;
+		/** Larger ranges, remainders under 4 bytes & non-blittable leaves */
+		std::vector<FCopyRange> Others;
+		int32 NumSelectedBytes = 0;
+	};
+
+	namespace Details
+	{
+		template<class T, std::size_t num_leaves>
+		constexpr void AppendCopyLeaves(std::array<FCopyRange, num_leaves>& OutLeaves, int32& InOutRank, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				using FieldType = typename field_t::Type;
+				const int32 Offset = InBaseOffset + static_cast<int32>(field_t::MemberOffset);
+
+				if constexpr (HasLayout<FieldType>::Value)
+					AppendCopyLeaves<FieldType>(OutLeaves, InOutRank, Offset);
+				else if constexpr (IsBlittable<FieldType>() || GetFieldKind<FieldType>() == EFieldKind::ArrayView)
+					OutLeaves[InOutRank++] = FCopyRange{ Offset, static_cast<int32>(sizeof(FieldType)), nullptr };
+				else if constexpr (TypeOps<FieldType>.Copy != nullptr)
+					OutLeaves[InOutRank++] = FCopyRange{ Offset, static_cast<int32>(sizeof(FieldType)), TypeOps<FieldType>.Copy };
+				else
+					OutLeaves[InOutRank++] = FCopyRange{ Offset, 0, nullptr };	// Not copyable, never copied
+			}, MakeNamedLayout<T>());
+		}
+
+		/**
+		 * Leaves of a type, by rank, as copy ranges
+		 */
+		template<class T>
+		struct TCopyLeaves
+		{
+			static constexpr int32 NumLeaves = TLayoutTable<T>::NumLeaves;
+
+			static constexpr std::array<FCopyRange, NumLeaves> Build()
+			{
+				std::array<FCopyRange, NumLeaves> Result = {};
+				int32 Rank = 0;
+				AppendCopyLeaves<T>(Result, Rank, 0);
+				return Result;
+			}
+
+			static constexpr std::array<FCopyRange, NumLeaves> Leaves = Build();
+		};
+
+		/**
+		 * Select the leaves of a field and of its nested fields
+		 * @param InIndex Index of the field within the table of T
+		 * @param OutSelected Selection, by leaf rank
+		 */
+		template<class T>
+		void SelectFieldLeaves(int32 InIndex, std::span<bool> OutSelected)
+		{
+			using TableType = TLayoutTable<T>;
+			const int32 End = InIndex + TableType::Fields[InIndex].NumDescendants;
+			for (int32 Rank = 0; Rank < TableType::NumLeaves; ++Rank)
+			{
+				const int32 Index = TableType::LeafIndices[Rank];
+				if (Index >= InIndex && Index <= End)
+					OutSelected[Rank] = true;
+			}
+		}
+	}
+
+	/**
+	 * Make a plan copying the leaves of a type selected by tag flags (inherited from parent fields)
+	 * Leaves neither blittable nor copy assignable are never copied
+	 * @param InIncluded Leaves with any of these flags are copied, every leaf if None
+	 * @param InExcluded Leaves with any of these flags aren't copied, e.g Transient
+	 * @return Plan
+	 */
+	template<class T>
+	FLayoutCopyPlan MakeCopyPlan(EFieldFlags InIncluded, EFieldFlags InExcluded = EFieldFlags::None)
+	{
+		using TableType = TLayoutTable<T>;
+		std::array<bool, TableType::NumLeaves> Selected = {};
+		for (int32 Rank = 0; Rank < TableType::NumLeaves; ++Rank)
+		{
+			const EFieldFlags Flags = TableType::Fields[TableType::LeafIndices[Rank]].Flags;
+			Selected[Rank] = (InIncluded == EFieldFlags::None || HasAnyFlags(Flags, InIncluded)) && !HasAnyFlags(Flags, InExcluded);
+		}
+		return FLayoutCopyPlan(Details::TCopyLeaves<T>::Leaves, Selected);
+	}
+
+	/**
+	 * Make a plan copying fields of a type selected by name
+	 * Naming a nested layout copies all its fields; unknown names are ignored
+	 * @param InNames Full dotted names, e.g "Position" or "Position.X"
+	 * @return Plan
+	 */
+	template<class T>
+	FLayoutCopyPlan MakeCopyPlan(std::span<const std::wstring_view> InNames)
+	{
+		using TableType = TLayoutTable<T>;
+		std::array<bool, TableType::NumLeaves> Selected = {};
+		for (std::wstring_view Name : InNames)
+		{
+			for (int32 Index = 0; Index < TableType::Num; ++Index)
+			{
+				if (TableType::Fields[Index].Name == Name)
+					Details::SelectFieldLeaves<T>(Index, Selected);
+			}
+		}
+		return FLayoutCopyPlan(Details::TCopyLeaves<T>::Leaves, Selected);
+	}
+
+	template<class T>
+	FLayoutCopyPlan MakeCopyPlan(std::initializer_list<std::wstring_view> InNames)
+	{
+		return MakeCopyPlan<T>(std::span<const std::wstring_view>(InNames.begin(), InNames.size()));
+	}
+
+	/**
+	 * Make a plan copying a pack of fields of a type, resolved at compile time
+	 * Copying a nested layout field copies all its fields
+	 * @param InFields Fields, with offsets relative to T (as produced by IterateLayoutNamed)
+	 * @return Plan
+	 */
+	template<class T, class... field_ts> requires (requires { field_ts::MemberOffset; } && ...)
+	FLayoutCopyPlan MakeCopyPlan(const field_ts&... InFields)
+	{
+		using TableType = TLayoutTable<T>;
+		std::array<bool, TableType::NumLeaves> Selected = {};
+		([&Selected](const auto& InField)
+		{
+			using field_t = std::decay_t<decltype(InField)>;
+			constexpr int32 Index = TableType::FindIndex(static_cast<int32>(field_t::MemberOffset), GetTypeId<typename field_t::Type>());
+			static_assert(Index >= 0, "Field doesn't belong to this layout");
+			Details::SelectFieldLeaves<T>(Index, Selected);
+		}(InFields), ...);
+		return FLayoutCopyPlan(Details::TCopyLeaves<T>::Leaves, Selected);
+	}
+}
+
+namespace Rf
+{
+	template<bool is_const>
+	void TLayoutFieldView<is_const>::CopyTo(TLayoutFieldView<false> OutState, const Reflection::FLayoutCopyPlan& InPlan) const
+	{
+#if CHECK_STATE_TYPE
+		check(Type == OutState.Type && Size >= OutState.Size);
+#endif
+		InPlan.Copy(OutState.Data, Data);
+	}
+}
@@ -0,0 +1,343 @@
+/*!
+ *  @file LayoutDelta.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares field-level delta encoding between two states of the same type.
+ *  A delta is a bitmask of changed leaf fields (one bit per leaf, in layout order) followed by the new value of each changed leaf.
+ *  Leaves are compared bitwise; contiguous leaves are first compared as a single block.
+ *  Dynamic arrays & views of blittable elements are leaves compared by size and then as one block of elements; a changed
+ *  container is written as its serialized form (count & elements). Views are patched in place and keep their size.
+ *  Fields tagged Transient are never compared, and a delta setting their bit (or any bit Diff can't emit) is rejected.
+ *  A delta is checked whole before any field is patched, so that a rejected delta leaves the state untouched.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <vector>
+
+#include "LayoutTable.h"
+#include "LayoutSerializer.h"
+#include "LayoutView.h"
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+
+namespace Reflection
+{
+	/**
+	 * Block of contiguous leaf fields, compared with a single memcmp
+	 */
+	struct FDeltaRun
+	{
+		/** Offset from the root object */
+		int32 Offset = 0;
+		/** Size in bytes */
+		int32 Size = 0;
+		/** Rank of the first leaf of the run, see TLayoutTable::LeafIndices */
+		int32 FirstLeaf = 0;
+		/** Number of leaves in the run */
+		int32 NumLeaves = 0;
+		/** Compares the elements of a container leaf (single leaf runs only), null for memcmp runs */
+		bool(*Changed)(const uint8* InOld, const uint8* InNew) = nullptr;
+	};
+
+	/**
+	 * Encoding of a leaf value in a delta
+	 * Raw bytes if Write/Read/Check are null, TBinaryTraits otherwise
+	 */
+	struct FDeltaLeafOps
+	{
+		using CheckFunc = bool(*)(FBinaryReader& InDelta, const uint8* InState);
+
+		FSerializeStep::WriteFunc Write = nullptr;
+		FSerializeStep::ReadFunc Read = nullptr;
+		/** Skips an encoded value, checking that Read would accept it for the current leaf value */
+		CheckFunc Check = nullptr;
+	};
+
+	namespace Details
+	{
+		template<class T>
+		bool ContainerElementsChanged(const uint8* InOld, const uint8* InNew)
+		{
+			const auto Old = GetElements(*reinterpret_cast<const T*>(InOld));
+			const auto New = GetElements(*reinterpret_cast<const T*>(InNew));
+			return Old.size() != New.size() || (!Old.empty() && std::memcmp(Old.data(), New.data(), Old.size_bytes()) != 0);
+		}
+
+		/**
+		 * Skip a container written by TBinaryTraits, checking it fits the container: views keep their number of elements
+		 */
+		template<class T>
+		bool CheckContainerElements(FBinaryReader& InDelta, const uint8* InState)
+		{
+			using TraitsType = TContainerTraits<T>;
+			using ElementType = typename TraitsType::ElementType;
+			static_assert(TBinaryTraits<T>::bBulk, "Delta containers are read as a single block of elements");
+
+			std::size_t Num = TraitsType::FixedNum;
+			if constexpr (TBinaryTraits<T>::bHasNum)
+			{
+				uint32 SerializedNum = 0;
+				if (!InDelta.ReadValue(SerializedNum))
+					return false;
+				Num = SerializedNum;
+			}
+
+			if constexpr (std::is_const_v<ElementType>)
+				return false;
+			else if constexpr (TraitsType::Kind == EFieldKind::ArrayView)
+				return TraitsType::Num(*reinterpret_cast<const T*>(InState)) == Num && InDelta.Skip(Num * sizeof(ElementType));
+			else
+				return InDelta.Skip(Num * sizeof(ElementType));
+		}
+
+		template<int32 num_leaves>
+		struct TDeltaPlanBuilder
+		{
+			std::array<FDeltaRun, num_leaves> Runs = {};
+			std::array<FDeltaLeafOps, num_leaves> LeafOps = {};
+			int32 NumRuns = 0;
+			int32 NumLeaves = 0;
+
+			/**
+			 * Add a blittable leaf, merging it with the previous run if contiguous
+			 */
+			constexpr void AddLeaf(int32 InOffset, int32 InSize)
+			{
+				const int32 Rank = NumLeaves++;
+				if (NumRuns > 0)
+				{
+					FDeltaRun& Last = Runs[NumRuns - 1];
+					if (Last.Changed == nullptr && Last.Offset + Last.Size == InOffset)
+					{
+						Last.Size += InSize;
+						Last.NumLeaves += 1;
+						return;
+					}
+				}
+				Runs[NumRuns++] = FDeltaRun{ InOffset, InSize, Rank, 1, nullptr };
+			}
+
+			/**
+			 * Skip transient leaves: they keep their rank, but are never compared
+			 */
+			constexpr void SkipLeaves(int32 InNum) { NumLeaves += InNum; }
+
+			template<class T>
+			constexpr void AddContainer(int32 InOffset)
+			{
+				const int32 Rank = NumLeaves++;
+				LeafOps[Rank] = FDeltaLeafOps{ &WriteCustomField<T>, &ReadCustomField<T>, &CheckContainerElements<T> };
+				Runs[NumRuns++] = FDeltaRun{ InOffset, static_cast<int32>(sizeof(T)), Rank, 1, &ContainerElementsChanged<T> };
+			}
+		};
+
+		/**
+		 * Append the leaves of a layout, in table order
+		 * @param InBaseOffset Offset of the parent field
+		 */
+		template<class T, class builder_t>
+		constexpr void AppendDeltaLeaves(builder_t& InBuilder, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				using FieldType = typename field_t::Type;
+				const int32 Offset = InBaseOffset + static_cast<int32>(field_t::MemberOffset);
+
+				if constexpr (HasAnyFlags(field_t::Flags, EFieldFlags::Transient))
+				{
+					if constexpr (HasLayout<FieldType>::Value)
+						InBuilder.SkipLeaves(TLayoutTable<FieldType>::NumLeaves);
+					else
+						InBuilder.SkipLeaves(1);
+				}
+				else if constexpr (HasLayout<FieldType>::Value)
+					AppendDeltaLeaves<FieldType>(InBuilder, Offset);
+				else if constexpr (IsBlittable<FieldType>())
+					InBuilder.AddLeaf(Offset, static_cast<int32>(sizeof(FieldType)));
+				else if constexpr (IsContainer<FieldType>::Value && IsBlittable<TContainerElementType<FieldType>>())
+					InBuilder.template AddContainer<FieldType>(Offset);
+				else
+					static_assert(sizeof(FieldType) == 0, "Delta encoding requires blittable leaf fields, or containers of blittable elements");
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class T>
+		constexpr TDeltaPlanBuilder<TLayoutTable<T>::NumLeaves> BuildDeltaPlan()
+		{
+			TDeltaPlanBuilder<TLayoutTable<T>::NumLeaves> Builder;
+			AppendDeltaLeaves<T>(Builder, 0);
+			return Builder;
+		}
+	}
+
+	/**
+	 * Delta encoding plan of a type
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TDeltaPlan
+	{
+		using TableType = TLayoutTable<T>;
+
+		/** Size of the changed fields bitmask, in bytes */
+		static constexpr int32 MaskSize = (TableType::NumLeaves + 7) / 8;
+
+	private:
+		static constexpr auto Builder = Details::BuildDeltaPlan<T>();
+
+		static constexpr std::array<FDeltaRun, Builder.NumRuns> BuildRuns()
+		{
+			std::array<FDeltaRun, Builder.NumRuns> Result = {};
+			for (int32 i = 0; i < Builder.NumRuns; ++i)
+				Result[i] = Builder.Runs[i];
+			return Result;
+		}
+
+		static constexpr std::array<uint8, MaskSize> BuildDiffableMask()
+		{
+			std::array<uint8, MaskSize> Result = {};
+			for (int32 i = 0; i < Builder.NumRuns; ++i)
+			{
+				for (int32 Rank = Builder.Runs[i].FirstLeaf; Rank < Builder.Runs[i].FirstLeaf + Builder.Runs[i].NumLeaves; ++Rank)
+					Result[Rank / 8] |= static_cast<uint8>(1u << (Rank % 8));
+			}
+			return Result;
+		}
+
+	public:
+		/** Runs of contiguous leaves, and container leaves */
+		static constexpr std::array<FDeltaRun, Builder.NumRuns> Runs = BuildRuns();
+
+		/** Encoding of each leaf, by rank */
+		static constexpr std::array<FDeltaLeafOps, TableType::NumLeaves> LeafOps = Builder.LeafOps;
+
+		/** Bits Diff() may set in a delta mask: every compared leaf, excluding Transient leaves & bits past the last leaf */
+		static constexpr std::array<uint8, MaskSize> DiffableMask = BuildDiffableMask();
+
+		/**
+		 * Get the descriptor of a leaf
+		 * @param InRank Leaf rank
+		 */
+		static constexpr const FLayoutFieldDesc& GetLeaf(int32 InRank)
+		{
+			return TableType::Fields[TableType::LeafIndices[InRank]];
+		}
+	};
+
+	/**
+	 * Encode the changes between two states
+	 * @param InOld Previous state
+	 * @param InNew Current state
+	 * @param OutDelta Writer receiving the delta (bitmask + changed values)
+	 * @return True if any field changed, false (and nothing written) if either view is smaller than T
+	 */
+	template<class T>
+	bool Diff(const Rf::FLayoutFieldConstView& InOld, const Rf::FLayoutFieldConstView& InNew, FBinaryWriter& OutDelta)
+	{
+		using PlanType = TDeltaPlan<T>;
+		if (InOld.GetData().size() < sizeof(T) || InNew.GetData().size() < sizeof(T))
+			return false;
+
+		const uint8* Old = InOld.GetData().data();
+		const uint8* New = InNew.GetData().data();
+
+		std::vector<uint8>& Buffer = OutDelta.GetBuffer();
+		const std::size_t MaskOffset = Buffer.size();
+		Buffer.resize(MaskOffset + PlanType::MaskSize, 0);
+
+		bool bChanged = false;
+		for (const FDeltaRun& Run : PlanType::Runs)
+		{
+			if (Run.Changed != nullptr)
+			{
+				if (!Run.Changed(Old + Run.Offset, New + Run.Offset))
+					continue;
+				OutDelta.GetBuffer()[MaskOffset + Run.FirstLeaf / 8] |= static_cast<uint8>(1u << (Run.FirstLeaf % 8));
+				PlanType::LeafOps[Run.FirstLeaf].Write(OutDelta, New + Run.Offset);
+				bChanged = true;
+				continue;
+			}
+
+			if (std::memcmp(Old + Run.Offset, New + Run.Offset, Run.Size) == 0)
+				continue;
+
+			for (int32 Rank = Run.FirstLeaf; Rank < Run.FirstLeaf + Run.NumLeaves; ++Rank)
+			{
+				const FLayoutFieldDesc& Leaf = PlanType::GetLeaf(Rank);
+				if (std::memcmp(Old + Leaf.Offset, New + Leaf.Offset, Leaf.Size) != 0)
+				{
+					// Re-fetch the buffer, writes may reallocate it
+					OutDelta.GetBuffer()[MaskOffset + Rank / 8] |= static_cast<uint8>(1u << (Rank % 8));
+					OutDelta.Write(New + Leaf.Offset, Leaf.Size);
+					bChanged = true;
+				}
+			}
+		}
+		return bChanged;
+	}
+
+	/**
+	 * Apply a delta produced by Diff()
+	 * The delta is checked whole first: when rejected, neither the state nor the reader are modified
+	 * @param InOutState State to patch (the Old state given to Diff)
+	 * @param InDelta Reader over the delta
+	 * @return False if the state view is smaller than T, or the delta is truncated, sets bits Diff() can't emit or resizes a view
+	 */
+	template<class T>
+	bool ApplyDelta(const Rf::FLayoutFieldView& InOutState, FBinaryReader& InDelta)
+	{
+		using PlanType = TDeltaPlan<T>;
+		if (InOutState.GetData().size() < sizeof(T))
+			return false;
+
+		FBinaryReader Reader = InDelta;
+		std::array<uint8, PlanType::MaskSize> Mask = {};
+		if (!Reader.Read(Mask.data(), Mask.size()))
+			return false;
+		for (int32 Byte = 0; Byte < PlanType::MaskSize; ++Byte)
+		{
+			if ((Mask[Byte] & ~PlanType::DiffableMask[Byte]) != 0)
+				return false;
+		}
+
+		// Visit set bits only
+		auto ForEachChangedLeaf = [&Mask](auto&& InCallable)
+		{
+			for (int32 Byte = 0; Byte < PlanType::MaskSize; ++Byte)
+			{
+				for (uint32 Bits = Mask[Byte]; Bits != 0; Bits &= Bits - 1)
+				{
+					const int32 Rank = Byte * 8 + std::countr_zero(Bits);
+					if (!InCallable(PlanType::GetLeaf(Rank), PlanType::LeafOps[Rank]))
+						return false;
+				}
+			}
+			return true;
+		};
+
+		uint8* Data = InOutState.GetData().data();
+		const bool bValid = ForEachChangedLeaf([&Reader, Data](const FLayoutFieldDesc& InLeaf, const FDeltaLeafOps& InOps)
+		{
+			return InOps.Check == nullptr ? Reader.Skip(InLeaf.Size) : InOps.Check(Reader, Data + InLeaf.Offset);
+		});
+		if (!bValid)
+			return false;
+
+		Reader = InDelta;
+		Reader.Skip(Mask.size());
+		const bool bSuccess = ForEachChangedLeaf([&Reader, Data](const FLayoutFieldDesc& InLeaf, const FDeltaLeafOps& InOps)
+		{
+			return InOps.Read == nullptr ? Reader.Read(Data + InLeaf.Offset, InLeaf.Size) : InOps.Read(Reader, Data + InLeaf.Offset);
+		});
+		InDelta = Reader;
+		return bSuccess;
+	}
+}
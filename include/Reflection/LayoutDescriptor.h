@@ -0,0 +1,416 @@
+/*!
+ *  @file LayoutDescriptor.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares type-erased layout descriptors & their registry.
+ *  A descriptor is built once per reflected type from TLayout<T>; it holds the fields of the type (offsets, sizes,
+ *  nested descriptors) and function pointers to construct, destroy, copy & compare instances.
+ *  Generic code walks any reflected type through descriptors with a single non-template code path, instead of
+ *  instantiating IterateLayoutNamed per callable and per type.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "LayoutPadding.h"
+#include "LayoutTable.h"
+#include "TypeId.h"
+#include <Core/Name.h>
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	class FLayoutDescriptor;
+
+	/**
+	 * Type-erased operations on a type
+	 * Function pointers are null when the type doesn't support the operation
+	 */
+	struct FLayoutTypeOps
+	{
+		int32 Size = 0;
+		int32 Alignment = 0;
+		/** See GetTypeId() */
+		uint64 TypeId = 0;
+		bool bTriviallyCopyable = false;
+		/** Whether Destroy may be skipped */
+		bool bTriviallyDestructible = false;
+		/** Padding bytes within the type, nested layouts included, see TLayoutPadding */
+		int32 Padding = 0;
+
+		/** Default construct an instance in uninitialized memory */
+		void (*Construct)(void* OutObject) = nullptr;
+		/** Destroy an instance */
+		void (*Destroy)(void* InObject) = nullptr;
+		/** Copy assign an instance */
+		void (*Copy)(void* OutObject, const void* InObject) = nullptr;
+		/** Compare two instances for equality */
+		bool (*Equals)(const void* InA, const void* InB) = nullptr;
+	};
+
+	/**
+	 * Field of a layout descriptor
+	 */
+	struct FLayoutDescriptorField
+	{
+		/** Member name, e.g "X" */
+		FName Name;
+		/** Offset from the owning type */
+		int32 Offset = 0;
+		/** Operations on the field type */
+		const FLayoutTypeOps* Type = nullptr;
+		/** Descriptor of the field type, null for leaves */
+		const FLayoutDescriptor* Descriptor = nullptr;
+
+		bool IsLeaf() const { return Descriptor == nullptr; }
+	};
+
+	/**
+	 * Type-erased description of a reflected type
+	 */
+	class FLayoutDescriptor
+	{
+	public:
+		/**
+		 * Walker invoked for each field, with the field, a pointer to its data & its nesting depth
+		 * Returning EFieldIterator::Stop skips the nested fields of a layout field
+		 */
+		using FWalkFunc = EFieldIterator(*)(void* InContext, const FLayoutDescriptorField& InField, void* InData, int32 InDepth);
+
+		/** Layout name, see TLayout<T>::GetFName() */
+		FName Name;
+		/** GetLayoutFingerprint<T>() */
+		uint64 Fingerprint = 0;
+		/** Operations on the type */
+		FLayoutTypeOps Ops;
+		/** Direct members; nested members are reached through FLayoutDescriptorField::Descriptor */
+		std::span<const FLayoutDescriptorField> Fields;
+
+		/**
+		 * Find a direct member
+		 * @param InName Member name
+		 * @return Field, nullptr if not found
+		 */
+		const FLayoutDescriptorField* FindField(FName InName) const
+		{
+			for (const FLayoutDescriptorField& Field : Fields)
+			{
+				if (Field.Name == InName)
+					return &Field;
+			}
+			return nullptr;
+		}
+
+		/**
+		 * Walk the fields of an object, recursively (same order as IterateLayoutNamed)
+		 * @param InObject Object described by this descriptor
+		 * @param InCallable Callable invoked with (const FLayoutDescriptorField&, void* FieldData, int32 Depth),
+		 * may return an EFieldIterator
+		 */
+		template<class callable_t>
+		void Walk(void* InObject, callable_t&& InCallable) const
+		{
+			WalkImpl(static_cast<uint8*>(InObject), &InvokeWalker<std::remove_reference_t<callable_t>, void*>, &InCallable, 0);
+		}
+
+		/**
+		 * Walk the fields of a const object, recursively (same order as IterateLayoutNamed)
+		 * @param InObject Object described by this descriptor
+		 * @param InCallable Callable invoked with (const FLayoutDescriptorField&, const void* FieldData, int32 Depth),
+		 * may return an EFieldIterator
+		 */
+		template<class callable_t>
+		void Walk(const void* InObject, callable_t&& InCallable) const
+		{
+			WalkImpl(static_cast<uint8*>(const_cast<void*>(InObject)), &InvokeWalker<std::remove_reference_t<callable_t>, const void*>, &InCallable, 0);
+		}
+
+		/**
+		 * Walk the fields of an object through a function pointer
+		 * Non-template: the only code generated per walker is the walker itself
+		 * @param InObject Object described by this descriptor
+		 * @param InFunc Walker
+		 * @param InContext Walker context
+		 * @param InDepth Depth of the fields of this descriptor
+		 */
+		void WalkImpl(uint8* InObject, FWalkFunc InFunc, void* InContext, int32 InDepth) const
+		{
+			for (const FLayoutDescriptorField& Field : Fields)
+			{
+				uint8* FieldData = InObject + Field.Offset;
+				if (InFunc(InContext, Field, FieldData, InDepth) == EFieldIterator::Enter && Field.Descriptor != nullptr)
+					Field.Descriptor->WalkImpl(FieldData, InFunc, InContext, InDepth + 1);
+			}
+		}
+
+		/**
+		 * Compare two objects field by field
+		 * @return True if every field compares equal; false if a field has no Equals operation
+		 */
+		bool EqualsFields(const void* InA, const void* InB) const
+		{
+			for (const FLayoutDescriptorField& Field : Fields)
+			{
+				if (Field.Type->Equals == nullptr)
+					return false;
+				if (!Field.Type->Equals(static_cast<const uint8*>(InA) + Field.Offset, static_cast<const uint8*>(InB) + Field.Offset))
+					return false;
+			}
+			return true;
+		}
+
+	private:
+		template<class callable_t, class data_t>
+		static EFieldIterator InvokeWalker(void* InContext, const FLayoutDescriptorField& InField, void* InData, int32 InDepth)
+		{
+			callable_t& Callable = *static_cast<callable_t*>(InContext);
+			if constexpr (std::is_same_v<decltype(Callable(InField, static_cast<data_t>(InData), InDepth)), EFieldIterator>)
+			{
+				return Callable(InField, static_cast<data_t>(InData), InDepth);
+			}
+			else
+			{
+				Callable(InField, static_cast<data_t>(InData), InDepth);
+				return EFieldIterator::Enter;
+			}
+		}
+	};
+
+	/**
+	 * Registry of layout descriptors, by layout name
+	 */
+	class FLayoutDescriptorRegistry
+	{
+	public:
+		static FLayoutDescriptorRegistry& Get()
+		{
+			static FLayoutDescriptorRegistry Instance;
+			return Instance;
+		}
+
+		/**
+		 * Register a descriptor, replacing any descriptor of the same name
+		 * @param InDescriptor Descriptor, must outlive the registry
+		 */
+		void Register(const FLayoutDescriptor& InDescriptor)
+		{
+			std::unique_lock<std::shared_mutex> Lock(Mutex);
+			Descriptors[InDescriptor.Name] = &InDescriptor;
+		}
+
+		/**
+		 * Find a descriptor
+		 * @param InName Layout name, e.g FName(L"FooStruct")
+		 * @return Descriptor, nullptr if no type of this name was registered
+		 */
+		const FLayoutDescriptor* Find(FName InName) const
+		{
+			std::shared_lock<std::shared_mutex> Lock(Mutex);
+			const auto Found = Descriptors.find(InName);
+			return Found != Descriptors.end() ? Found->second : nullptr;
+		}
+
+		/**
+		 * Get every registered descriptor
+		 * @return Descriptors, in no particular order
+		 */
+		std::vector<const FLayoutDescriptor*> GetAll() const
+		{
+			std::shared_lock<std::shared_mutex> Lock(Mutex);
+			std::vector<const FLayoutDescriptor*> Result;
+			Result.reserve(Descriptors.size());
+			for (const auto& Pair : Descriptors)
+				Result.push_back(Pair.second);
+			return Result;
+		}
+
+	private:
+		mutable std::shared_mutex Mutex;
+		std::unordered_map<FName, const FLayoutDescriptor*> Descriptors;
+	};
+
+	template<class T>
+	const FLayoutDescriptor& GetLayoutDescriptor();
+
+	namespace Details
+	{
+		// C arrays are handled as their flattened elements
+		template<class T>
+		using TArrayElementType = std::remove_all_extents_t<T>;
+
+		template<class T>
+		constexpr std::size_t NumArrayElements = sizeof(T) / sizeof(TArrayElementType<T>);
+
+		template<class T>
+		void ConstructObject(void* OutObject)
+		{
+			if constexpr (std::is_array_v<T>)
+				std::uninitialized_value_construct_n(static_cast<TArrayElementType<T>*>(OutObject), NumArrayElements<T>);
+			else
+				::new (OutObject) T();
+		}
+
+		template<class T>
+		void DestroyObject(void* InObject) { std::destroy_at(static_cast<T*>(InObject)); }
+
+		template<class T>
+		void CopyObject(void* OutObject, const void* InObject)
+		{
+			if constexpr (std::is_array_v<T>)
+			{
+				const TArrayElementType<T>* In = static_cast<const TArrayElementType<T>*>(InObject);
+				std::copy(In, In + NumArrayElements<T>, static_cast<TArrayElementType<T>*>(OutObject));
+			}
+			else
+				*static_cast<T*>(OutObject) = *static_cast<const T*>(InObject);
+		}
+
+		template<class T>
+		bool EqualObjects(const void* InA, const void* InB)
+		{
+			if constexpr (std::is_array_v<T>)
+			{
+				const TArrayElementType<T>* A = static_cast<const TArrayElementType<T>*>(InA);
+				return std::equal(A, A + NumArrayElements<T>, static_cast<const TArrayElementType<T>*>(InB));
+			}
+			else
+				return *static_cast<const T*>(InA) == *static_cast<const T*>(InB);
+		}
+
+		/**
+		 * Check whether operator== is usable on a type
+		 * Standard containers declare operator== unconditionally, their elements are checked instead
+		 */
+		template<class T>
+		constexpr bool IsEqualityComparable()
+		{
+			if constexpr (IsContainer<T>::Value && GetFieldKind<T>() != EFieldKind::ArrayView)
+				return IsEqualityComparable<TContainerElementType<T>>();
+			else
+				return std::equality_comparable<T>;
+		}
+
+		template<class T>
+		bool EqualObjectBytes(const void* InA, const void* InB) { return std::memcmp(InA, InB, sizeof(T)) == 0; }
+
+		template<class T>
+		bool EqualLayoutFields(const void* InA, const void* InB) { return GetLayoutDescriptor<T>().EqualsFields(InA, InB); }
+
+		template<class T>
+		constexpr FLayoutTypeOps MakeTypeOps()
+		{
+			FLayoutTypeOps Ops;
+			Ops.Size = static_cast<int32>(sizeof(T));
+			Ops.Alignment = static_cast<int32>(alignof(T));
+			Ops.TypeId = GetTypeId<T>();
+			Ops.bTriviallyCopyable = std::is_trivially_copyable_v<T>;
+			Ops.bTriviallyDestructible = std::is_trivially_destructible_v<T>;
+			Ops.Padding = GetPaddingBytes<T>();
+			if constexpr (std::is_default_constructible_v<T>)
+				Ops.Construct = &ConstructObject<T>;
+			if constexpr (std::is_destructible_v<T>)
+				Ops.Destroy = &DestroyObject<T>;
+			if constexpr (std::is_copy_assignable_v<TArrayElementType<T>>)
+				Ops.Copy = &CopyObject<T>;
+
+			if constexpr (IsEqualityComparable<T>())
+				Ops.Equals = &EqualObjects<T>;
+			else if constexpr (HasLayout<T>::Value)
+				Ops.Equals = &EqualLayoutFields<T>;
+			else if constexpr (std::has_unique_object_representations_v<T>)
+				Ops.Equals = &EqualObjectBytes<T>;
+			return Ops;
+		}
+
+		/** Operations of a type, shared by every field of this type */
+		template<class T>
+		inline constexpr FLayoutTypeOps TypeOps = MakeTypeOps<T>();
+
+		/**
+		 * Storage of the descriptor of a type
+		 */
+		template<class T>
+		struct TLayoutDescriptorStorage
+		{
+			static constexpr int32 NumFields = TTupleArity<std::decay_t<decltype(MakeNamedLayout<T>())>>::Value;
+
+			FLayoutDescriptor Descriptor;
+			std::array<FLayoutDescriptorField, NumFields> Fields;
+
+			TLayoutDescriptorStorage()
+			{
+				int32 Index = 0;
+				VisitTupleElements([this, &Index](const auto& InField)
+				{
+					using FieldType = typename std::decay_t<decltype(InField)>::Type;
+					FLayoutDescriptorField& Field = Fields[Index++];
+					Field.Name = FName(std::wstring_view(InField.GetName().CStr(), InField.GetName().Num()));
+					Field.Offset = static_cast<int32>(std::decay_t<decltype(InField)>::MemberOffset);
+					Field.Type = &TypeOps<FieldType>;
+					if constexpr (HasLayout<FieldType>::Value)
+						Field.Descriptor = &GetLayoutDescriptor<FieldType>();
+				}, MakeNamedLayout<T>());
+
+				Descriptor.Name = TLayout<T>::GetFName();
+				Descriptor.Fingerprint = GetLayoutFingerprint<T>();
+				Descriptor.Ops = TypeOps<T>;
+				Descriptor.Fields = std::span<const FLayoutDescriptorField>(Fields);
+			}
+		};
+	}
+
+	/**
+	 * Get the descriptor of a reflected type, building & registering it on first use
+	 * Descriptors of nested layouts are registered along
+	 * @tparam T Reflected type
+	 * @return Descriptor, valid for the whole program
+	 */
+	template<class T>
+	const FLayoutDescriptor& GetLayoutDescriptor()
+	{
+		static const Details::TLayoutDescriptorStorage<T> Storage;
+		static const bool bRegistered = (FLayoutDescriptorRegistry::Get().Register(Storage.Descriptor), true);
+		(void)bRegistered;
+		return Storage.Descriptor;
+	}
+
+	/**
+	 * Find the descriptor of a registered type
+	 * @param InName Layout name
+	 * @return Descriptor, nullptr if not registered
+	 */
+	inline const FLayoutDescriptor* FindLayoutDescriptor(FName InName)
+	{
+		return FLayoutDescriptorRegistry::Get().Find(InName);
+	}
+}
+
+/**
+ * Register the descriptor of a reflected type at startup, so that it can be found by name before any use of the type
+ * To be used once per type, in a source file
+ */
+#define RF_REGISTER_LAYOUT(T)\
+static const bool RF_REGISTER_LAYOUT_CONCAT(GRegisteredLayout, __LINE__) = (::Reflection::GetLayoutDescriptor<T>(), true);
+
+#define RF_REGISTER_LAYOUT_CONCAT_INNER(A, B) A##B
+#define RF_REGISTER_LAYOUT_CONCAT(A, B) RF_REGISTER_LAYOUT_CONCAT_INNER(A, B)
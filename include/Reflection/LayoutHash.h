@@ -0,0 +1,164 @@
+/*!
+ *  @file LayoutHash.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares hashing of reflected objects, field by field.
+ *  Values equal with operator== hash the same: floating point zeros are normalized and padding bytes are never read.
+ *  Containers hash their number of elements, then their elements; elements of bytewise comparable types are hashed as
+ *  a single block of bytes, as are whole objects of such types (see TIsBytewiseComparable).
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "LayoutPadding.h"
+#include <Core/Hash.h>
+#include <Core/TupleVisitor.h>
+
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	template<class T>
+	uint64 HashLayout(const T& InObject, uint64 InSeed = Fnv1aOffsetBasis);
+
+	namespace Details
+	{
+		/**
+		 * Check whether an array of T can be hashed as a single block of bytes, i.e EqualsValue compares its elements
+		 * with memcmp; other elements are hashed one at a time, as they are compared
+		 */
+		template<class T>
+		constexpr bool IsBulkHashable()
+		{
+			return TIsBytewiseComparable<T>::Value;
+		}
+
+		template<class T>
+		uint64 HashFloat(uint64 InHash, T InValue)
+		{
+			// -0 == +0
+			const T Value = InValue == T(0) ? T(0) : InValue;
+			if constexpr (sizeof(T) == sizeof(uint32))
+				return HashWord(InHash, std::bit_cast<uint32>(Value));
+			else if constexpr (sizeof(T) == sizeof(uint64))
+				return HashWord(InHash, std::bit_cast<uint64>(Value));
+			else
+				return HashBytes(&Value, sizeof(T), InHash);
+		}
+
+		/**
+		 * Hash the bytes of an object, as HashBytes does, with the word loop unrolled for the size of T
+		 */
+		template<class T>
+		uint64 HashObjectBytes(const T& InObject, uint64 InHash)
+		{
+			constexpr std::size_t NumWords = sizeof(T) / sizeof(uint64);
+			const uint8* Data = reinterpret_cast<const uint8*>(&InObject);
+			const auto LoadWord = [Data](std::size_t InIndex)
+			{
+				uint64 Word;
+				std::memcpy(&Word, Data + InIndex * sizeof(uint64), sizeof(uint64));
+				return Word;
+			};
+
+			uint64 Hash = InHash;
+			[&]<std::size_t... i>(std::index_sequence<i...>)
+			{
+				((Hash = HashWord(Hash, LoadWord(i))), ...);
+			}(std::make_index_sequence<NumWords>{});
+			if constexpr (sizeof(T) % sizeof(uint64) != 0)
+				Hash = HashFnv1a(Data + NumWords * sizeof(uint64), sizeof(T) % sizeof(uint64), Hash);
+			return Hash;
+		}
+
+		/**
+		 * Hash a single value into an existing hash
+		 */
+		template<class T>
+		uint64 HashValue(uint64 InHash, const T& InValue)
+		{
+			if constexpr (HasLayout<T>::Value)
+			{
+				return HashLayout(InValue, InHash);
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				return HashFloat(InHash, InValue);
+			}
+			else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+			{
+				return HashWord(InHash, static_cast<uint64>(InValue));
+			}
+			else if constexpr (IsContainer<T>::Value)
+			{
+				using TraitsType = TContainerTraits<std::remove_cv_t<T>>;
+				using ElementType = std::remove_const_t<typename TraitsType::ElementType>;
+
+				const auto Elements = GetElements(InValue);
+				uint64 Hash = InHash;
+				if constexpr (TraitsType::Kind != EFieldKind::FixedArray)
+					Hash = HashWord(Hash, Elements.size());
+
+				if constexpr (IsBulkHashable<ElementType>())
+				{
+					return HashBytes(Elements.data(), Elements.size_bytes(), Hash);
+				}
+				else
+				{
+					for (const ElementType& Element : Elements)
+						Hash = HashValue(Hash, Element);
+					return Hash;
+				}
+			}
+			else if constexpr (requires { typename T::traits_type; typename T::value_type; InValue.data(); InValue.size(); })
+			{
+				// Strings
+				return HashBytes(InValue.data(), InValue.size() * sizeof(typename T::value_type), HashWord(InHash, InValue.size()));
+			}
+			else if constexpr (requires { std::hash<T>{}(InValue); })
+			{
+				return HashWord(InHash, static_cast<uint64>(std::hash<T>{}(InValue)));
+			}
+			else
+			{
+				static_assert(sizeof(T) == 0, "Unable to hash this field type, specialize std::hash");
+				return InHash;
+			}
+		}
+	}
+
+	/**
+	 * Hash an object, field by field
+	 * Bytewise comparable objects are hashed as a single block of bytes, a word at a time
+	 * @param InObject Object to hash
+	 * @param InSeed Initial hash value
+	 * @return Hash
+	 */
+	template<class T>
+	uint64 HashLayout(const T& InObject, uint64 InSeed)
+	{
+		if constexpr (TIsBytewiseComparable<T>::Value)
+			return Details::HashObjectBytes(InObject, InSeed);
+
+		const uint8* Data = reinterpret_cast<const uint8*>(&InObject);
+		uint64 Hash = InSeed;
+		VisitTupleElements([&](const auto& InField)
+		{
+			using field_t = std::decay_t<decltype(InField)>;
+			Hash = Details::HashValue(Hash, *reinterpret_cast<const typename field_t::Type*>(Data + field_t::MemberOffset));
+		}, MakeNamedLayout<T>());
+		return Hash;
+	}
+}
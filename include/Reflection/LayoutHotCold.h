@@ -0,0 +1,380 @@
+/*!
+ *  @file LayoutHotCold.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a container splitting the leaf fields of a layout into hot & cold storage.
+ *  Leaves tagged Hot (directly or through a parent field) are packed into dense hot records, stored contiguously;
+ *  every other leaf goes to a cold record in a side table at the same index. Loops touching hot fields only stream the
+ *  hot records, instead of loading the whole object's cache lines.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "LayoutTable.h"
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+
+namespace Reflection
+{
+	/**
+	 * Location of a leaf in a hot/cold container
+	 */
+	struct FHotColdSlot
+	{
+		/** Offset of the leaf in the object */
+		int32 Offset = 0;
+		/** Size of the leaf */
+		int32 Size = 0;
+		/** Offset of the leaf in its hot or cold record */
+		int32 RecordOffset = 0;
+		/** Whether the leaf is stored in the hot record */
+		bool bHot = false;
+	};
+
+	/**
+	 * Hot/cold split of a layout
+	 * Leaves of each record are ordered by decreasing alignment, so that records hold no inner padding
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct THotColdPlan
+	{
+		using TableType = TLayoutTable<T>;
+		static_assert(TableType::bTriviallyCopyableLeaves, "Hot/cold split requires trivially copyable leaf fields");
+
+		/** Number of leaves, see TLayoutTable::LeafIndices */
+		static constexpr int32 NumLeaves = TableType::NumLeaves;
+
+		static constexpr bool IsHotLeaf(const FLayoutFieldDesc& InLeaf) { return HasAnyFlags(InLeaf.Flags, EFieldFlags::Hot); }
+
+	private:
+		struct FBuilder
+		{
+			std::array<FHotColdSlot, NumLeaves> Slots = {};
+			int32 HotRecordSize = 0;
+			int32 ColdRecordSize = 0;
+			int32 HotAlignment = 1;
+			int32 ColdAlignment = 1;
+		};
+
+		static constexpr FBuilder Build()
+		{
+			FBuilder Builder;
+
+			// Ranks sorted by decreasing alignment, stable
+			std::array<int32, NumLeaves> Order = {};
+			for (int32 i = 0; i < NumLeaves; ++i)
+			{
+				int32 j = i;
+				for (; j > 0 && TableType::Fields[TableType::LeafIndices[Order[j - 1]]].Alignment < TableType::Fields[TableType::LeafIndices[i]].Alignment; --j)
+					Order[j] = Order[j - 1];
+				Order[j] = i;
+			}
+
+			for (int32 Rank : Order)
+			{
+				const FLayoutFieldDesc& Leaf = TableType::Fields[TableType::LeafIndices[Rank]];
+				const bool bHot = IsHotLeaf(Leaf);
+				int32& RecordSize = bHot ? Builder.HotRecordSize : Builder.ColdRecordSize;
+				int32& RecordAlignment = bHot ? Builder.HotAlignment : Builder.ColdAlignment;
+
+				RecordSize = (RecordSize + Leaf.Alignment - 1) / Leaf.Alignment * Leaf.Alignment;
+				Builder.Slots[Rank] = FHotColdSlot{ Leaf.Offset, Leaf.Size, RecordSize, bHot };
+				RecordSize += Leaf.Size;
+				RecordAlignment = std::max(RecordAlignment, Leaf.Alignment);
+			}
+
+			Builder.HotRecordSize = (Builder.HotRecordSize + Builder.HotAlignment - 1) / Builder.HotAlignment * Builder.HotAlignment;
+			Builder.ColdRecordSize = (Builder.ColdRecordSize + Builder.ColdAlignment - 1) / Builder.ColdAlignment * Builder.ColdAlignment;
+			return Builder;
+		}
+
+		static constexpr FBuilder Data = Build();
+
+	public:
+		/** Location of each leaf, by rank */
+		static constexpr std::array<FHotColdSlot, NumLeaves> Slots = Data.Slots;
+
+		/** Size of a hot record (stride of the hot storage) */
+		static constexpr int32 HotRecordSize = Data.HotRecordSize;
+		/** Size of a cold record (stride of the cold storage) */
+		static constexpr int32 ColdRecordSize = Data.ColdRecordSize;
+
+		/**
+		 * Get the leaf rank of a field
+		 * @return Leaf rank, -1 if the field isn't a leaf of T
+		 */
+		template<class field_t>
+		static constexpr int32 GetLeafRank()
+		{
+			return TableType::FindLeafRank(static_cast<int32>(field_t::MemberOffset), GetTypeId<typename field_t::Type>());
+		}
+	};
+}
+
+namespace Rf
+{
+	/**
+	 * Hot/cold split container
+	 * Leaf fields of T must be trivially copyable
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	class TLayoutHotCold
+	{
+	public:
+		using PlanType = Reflection::THotColdPlan<T>;
+
+		/** Alignment of the hot & cold storages (cache line) */
+		static constexpr std::size_t StorageAlignment = 64;
+
+		/**
+		 * Check whether a field is stored in the hot records
+		 * @tparam field_t Leaf field of T (offset relative to T)
+		 */
+		template<class field_t>
+		static constexpr bool IsHot()
+		{
+			constexpr int32 Rank = PlanType::template GetLeafRank<field_t>();
+			static_assert(Rank >= 0, "Field is not a leaf of this layout");
+			return PlanType::Slots[Rank].bHot;
+		}
+
+		/**
+		 * View to an element of the container
+		 * Mimics TLayoutFieldView, fields are fetched from the hot or cold record
+		 */
+		template<bool is_const>
+		class TElementView
+		{
+		public:
+			using OwnerType = typename std::conditional<is_const, const TLayoutHotCold, TLayoutHotCold>::type;
+			using ByteType = typename std::conditional<is_const, const uint8, uint8>::type;
+			template<class U>
+			using RefType = typename std::conditional<is_const, const U&, U&>::type;
+
+			TElementView(OwnerType& InOwner, std::size_t InIndex)
+				: Owner(&InOwner)
+				, Index(InIndex)
+			{
+			}
+
+			/**
+			 * Extract the value of a leaf field (offset relative to T), located from the field type alone
+			 * @return Reference to the member
+			 */
+			template<class U, int32 offset, int32 n, class tags_t>
+			RefType<U> Get(const Reflection::TLayoutField<U, offset, n, tags_t>&) const
+			{
+				constexpr int32 Rank = PlanType::template GetLeafRank<Reflection::TLayoutField<U, offset, n, tags_t>>();
+				static_assert(Rank >= 0, "Field is not a leaf of this layout");
+				constexpr Reflection::FHotColdSlot Slot = PlanType::Slots[Rank];
+				ByteType* Record = Slot.bHot ? Owner->HotData + Index * PlanType::HotRecordSize : Owner->ColdData + Index * PlanType::ColdRecordSize;
+				return *reinterpret_cast<std::conditional_t<is_const, const U*, U*>>(Record + Slot.RecordOffset);
+			}
+
+			/**
+			 * Gather this element into an object
+			 * @return Copy of the element
+			 */
+			T Load() const { return Owner->Load(Index); }
+
+			/**
+			 * Scatter an object into this element
+			 * @param InObject Object to copy from
+			 */
+			void Store(const T& InObject) const requires (!is_const) { Owner->Store(Index, InObject); }
+
+			std::size_t GetIndex() const { return Index; }
+
+		private:
+			OwnerType* Owner;
+			std::size_t Index;
+		};
+
+		using FElementView = TElementView<false>;
+		using FElementConstView = TElementView<true>;
+
+		TLayoutHotCold() = default;
+
+		TLayoutHotCold(const TLayoutHotCold& InOther)
+		{
+			Reserve(InOther.Num);
+			if (InOther.Num > 0)
+			{
+				// A side without leaves has no storage
+				if constexpr (PlanType::HotRecordSize > 0)
+					std::memcpy(HotData, InOther.HotData, InOther.Num * PlanType::HotRecordSize);
+				if constexpr (PlanType::ColdRecordSize > 0)
+					std::memcpy(ColdData, InOther.ColdData, InOther.Num * PlanType::ColdRecordSize);
+			}
+			Num = InOther.Num;
+		}
+
+		TLayoutHotCold(TLayoutHotCold&& InOther) noexcept
+			: HotData(std::exchange(InOther.HotData, nullptr))
+			, ColdData(std::exchange(InOther.ColdData, nullptr))
+			, Num(std::exchange(InOther.Num, 0))
+			, Capacity(std::exchange(InOther.Capacity, 0))
+		{
+		}
+
+		TLayoutHotCold& operator=(const TLayoutHotCold& InOther)
+		{
+			if (this != &InOther)
+			{
+				TLayoutHotCold Copy(InOther);
+				Swap(Copy);
+			}
+			return *this;
+		}
+
+		TLayoutHotCold& operator=(TLayoutHotCold&& InOther) noexcept
+		{
+			TLayoutHotCold Moved(std::move(InOther));
+			Swap(Moved);
+			return *this;
+		}
+
+		~TLayoutHotCold()
+		{
+			::operator delete(HotData, std::align_val_t(StorageAlignment));
+			::operator delete(ColdData, std::align_val_t(StorageAlignment));
+		}
+
+		void Swap(TLayoutHotCold& InOther) noexcept
+		{
+			std::swap(HotData, InOther.HotData);
+			std::swap(ColdData, InOther.ColdData);
+			std::swap(Num, InOther.Num);
+			std::swap(Capacity, InOther.Capacity);
+		}
+
+		std::size_t size() const { return Num; }
+		bool empty() const { return Num == 0; }
+		std::size_t capacity() const { return Capacity; }
+
+		/**
+		 * Reserve storage for both records
+		 * @param InCapacity Minimum number of elements
+		 */
+		void Reserve(std::size_t InCapacity)
+		{
+			if (InCapacity <= Capacity)
+				return;
+
+			HotData = Reallocate(HotData, InCapacity * PlanType::HotRecordSize, Num * PlanType::HotRecordSize);
+			ColdData = Reallocate(ColdData, InCapacity * PlanType::ColdRecordSize, Num * PlanType::ColdRecordSize);
+			Capacity = InCapacity;
+		}
+
+		void reserve(std::size_t InCapacity) { Reserve(InCapacity); }
+
+		/**
+		 * Resize the container, new elements are copied from a default constructed T
+		 * @param InNum New number of elements
+		 */
+		void resize(std::size_t InNum)
+		{
+			if (InNum > Capacity)
+				Reserve(std::max(InNum, Capacity * 2));
+
+			if (InNum > Num)
+			{
+				const T Default{};
+				for (std::size_t i = Num; i < InNum; ++i)
+					Store(i, Default);
+			}
+			Num = InNum;
+		}
+
+		void clear() { Num = 0; }
+
+		/**
+		 * Append an element, splitting its leaf fields into its hot & cold records
+		 * @param InObject Object to append
+		 */
+		void push_back(const T& InObject)
+		{
+			if (Num == Capacity)
+				Reserve(Capacity == 0 ? 16 : Capacity * 2);
+			Store(Num++, InObject);
+		}
+
+		void pop_back() { --Num; }
+
+		FElementView operator[](std::size_t InIndex) { return FElementView(*this, InIndex); }
+		FElementConstView operator[](std::size_t InIndex) const { return FElementConstView(*this, InIndex); }
+
+		/**
+		 * Gather an element into an object
+		 * @param InIndex Element index
+		 * @return Copy of the element
+		 */
+		T Load(std::size_t InIndex) const
+		{
+			T Result{};
+			uint8* Data = reinterpret_cast<uint8*>(&Result);
+			const uint8* Hot = HotData + InIndex * PlanType::HotRecordSize;
+			const uint8* Cold = ColdData + InIndex * PlanType::ColdRecordSize;
+			for (const Reflection::FHotColdSlot& Slot : PlanType::Slots)
+				std::memcpy(Data + Slot.Offset, (Slot.bHot ? Hot : Cold) + Slot.RecordOffset, Slot.Size);
+			return Result;
+		}
+
+		/**
+		 * Scatter an object into an existing element
+		 * @param InIndex Element index
+		 * @param InObject Object to copy from
+		 */
+		void Store(std::size_t InIndex, const T& InObject)
+		{
+			const uint8* Data = reinterpret_cast<const uint8*>(&InObject);
+			uint8* Hot = HotData + InIndex * PlanType::HotRecordSize;
+			uint8* Cold = ColdData + InIndex * PlanType::ColdRecordSize;
+			for (const Reflection::FHotColdSlot& Slot : PlanType::Slots)
+				std::memcpy((Slot.bHot ? Hot : Cold) + Slot.RecordOffset, Data + Slot.Offset, Slot.Size);
+		}
+
+		/**
+		 * Get the raw bytes of the hot records
+		 * @return Num() records of PlanType::HotRecordSize bytes
+		 */
+		std::span<const uint8> GetHotData() const { return std::span<const uint8>(HotData, Num * PlanType::HotRecordSize); }
+
+		/**
+		 * Get the raw bytes of the cold records
+		 * @return Num() records of PlanType::ColdRecordSize bytes
+		 */
+		std::span<const uint8> GetColdData() const { return std::span<const uint8>(ColdData, Num * PlanType::ColdRecordSize); }
+
+	private:
+		static uint8* Reallocate(uint8* InData, std::size_t InSize, std::size_t InUsedSize)
+		{
+			if (InSize == 0)
+				return InData;
+			uint8* NewData = static_cast<uint8*>(::operator new(InSize, std::align_val_t(StorageAlignment)));
+			if (InData != nullptr)
+			{
+				std::memcpy(NewData, InData, InUsedSize);
+				::operator delete(InData, std::align_val_t(StorageAlignment));
+			}
+			return NewData;
+		}
+
+		uint8* HotData = nullptr;
+		uint8* ColdData = nullptr;
+		std::size_t Num = 0;
+		std::size_t Capacity = 0;
+	};
+}
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "Layout.h"
 #include <Core/TupleVisitor.h>
 
@@ -66,6 +68,35 @@ namespace Reflection
 				);
 			}
 		};
+
+		/**
+		 * Visitor of the fields of a layout tuple
+		 * A named class rather than a lambda : a lambda would be a local class of a function taking the whole tuple type,
+		 * embedding it in the symbol of every per-field instantiation
+		 */
+		template<class parent_field_t, class callable_t, class... args_t>
+		struct TIterateLayoutFieldsVisitor
+		{
+			const parent_field_t& ParentField;
+			callable_t&& Callable;
+			std::tuple<args_t&&...> Args;
+
+			template<class field_t>
+			constexpr void operator()(const field_t& InField) const
+			{
+				if constexpr (sizeof...(args_t) == 0)
+				{
+					IterateLayoutNamed(ParentField, InField, std::forward<callable_t>(Callable));
+				}
+				else
+				{
+					std::apply([&](auto&&... InArgs)
+					{
+						IterateLayoutNamed(ParentField, InField, std::forward<callable_t>(Callable), std::forward<args_t>(InArgs)...);
+					}, Args);
+				}
+			}
+		};
 	}
 
 	/**
@@ -75,7 +106,7 @@ namespace Reflection
 	constexpr void IterateLayoutNamed(const parent_field_t& InParentField, const field_t& InField, callable_t&& InCallable, args_t&&... InArgs)
 	{
 		constexpr int32 TotalOffset = static_cast<int32>(parent_field_t::MemberOffset) + static_cast<int32>(field_t::MemberOffset);
-		const auto ChildField = MakeField<typename field_t::Type, TotalOffset>(ConcatFieldName(InParentField.GetName(), InField.GetName()));
+		const auto ChildField = MakeTaggedField<typename field_t::Type, TotalOffset>(ConcatFieldName(InParentField.GetName(), InField.GetName()), InField.Tags);
 
 		Details::IterateNamedLayoutHelper<field_t>{}(InParentField, ChildField, std::forward<callable_t>(InCallable), std::forward<args_t>(InArgs)...);
 	}
@@ -83,8 +114,8 @@ namespace Reflection
 	template<class... Ts, class callable_t, class parent_field_t, class... args_t>
 	constexpr void IterateLayoutNamed(const parent_field_t& InParentField, const RTuple<Ts...>& InFields, callable_t&& InCallable, args_t&&... InArgs)
 	{
-		auto fn = [&](const auto& InField) { IterateLayoutNamed(InParentField, InField, std::forward<callable_t>(InCallable), std::forward<args_t>(InArgs)...); };
-		VisitTupleElements(fn, InFields);
+		const Details::TIterateLayoutFieldsVisitor<parent_field_t, callable_t, args_t...> Visitor{ InParentField, std::forward<callable_t>(InCallable), { std::forward<args_t>(InArgs)... } };
+		VisitTupleElements(Visitor, InFields);
 	}
 
 	/**
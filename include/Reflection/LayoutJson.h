@@ -0,0 +1,511 @@
+/*!
+ *  @file LayoutJson.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a streaming JSON writer driven by layouts.
+ *  The structural text of a layout (braces, commas & quoted keys) is generated once at compile time, as one UTF-8 chunk
+ *  per leaf field; writing an object appends each chunk followed by the leaf value, formatted with std::to_chars.
+ *  Nested layouts are written as nested objects, containers as arrays.
+ */
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "LayoutIterator.h"
+#include "LayoutTable.h"
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+using int64 = std::int64_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	namespace Details
+	{
+		/**
+		 * Append a code point to a sink, encoded as UTF-8
+		 * @param InSink Sink providing Push(char)
+		 * @param InCodePoint Unicode code point
+		 */
+		template<class sink_t>
+		constexpr void AppendUtf8CodePoint(sink_t& InSink, uint32 InCodePoint)
+		{
+			if (InCodePoint < 0x80)
+			{
+				InSink.Push(static_cast<char>(InCodePoint));
+			}
+			else if (InCodePoint < 0x800)
+			{
+				InSink.Push(static_cast<char>(0xc0 | (InCodePoint >> 6)));
+				InSink.Push(static_cast<char>(0x80 | (InCodePoint & 0x3f)));
+			}
+			else if (InCodePoint < 0x10000)
+			{
+				InSink.Push(static_cast<char>(0xe0 | (InCodePoint >> 12)));
+				InSink.Push(static_cast<char>(0x80 | ((InCodePoint >> 6) & 0x3f)));
+				InSink.Push(static_cast<char>(0x80 | (InCodePoint & 0x3f)));
+			}
+			else
+			{
+				InSink.Push(static_cast<char>(0xf0 | (InCodePoint >> 18)));
+				InSink.Push(static_cast<char>(0x80 | ((InCodePoint >> 12) & 0x3f)));
+				InSink.Push(static_cast<char>(0x80 | ((InCodePoint >> 6) & 0x3f)));
+				InSink.Push(static_cast<char>(0x80 | (InCodePoint & 0x3f)));
+			}
+		}
+
+		/**
+		 * Append a code point to a sink as JSON string content (UTF-8, escaped)
+		 * @param InSink Sink providing Push(char)
+		 * @param InCodePoint Unicode code point
+		 */
+		template<class sink_t>
+		constexpr void AppendJsonCodePoint(sink_t& InSink, uint32 InCodePoint)
+		{
+			constexpr char HexDigits[] = "0123456789abcdef";
+			switch (InCodePoint)
+			{
+			case '"': InSink.Push('\\'); InSink.Push('"'); return;
+			case '\\': InSink.Push('\\'); InSink.Push('\\'); return;
+			case '\b': InSink.Push('\\'); InSink.Push('b'); return;
+			case '\f': InSink.Push('\\'); InSink.Push('f'); return;
+			case '\n': InSink.Push('\\'); InSink.Push('n'); return;
+			case '\r': InSink.Push('\\'); InSink.Push('r'); return;
+			case '\t': InSink.Push('\\'); InSink.Push('t'); return;
+			default: break;
+			}
+
+			if (InCodePoint < 0x20)
+			{
+				InSink.Push('\\'); InSink.Push('u'); InSink.Push('0'); InSink.Push('0');
+				InSink.Push(HexDigits[InCodePoint >> 4]);
+				InSink.Push(HexDigits[InCodePoint & 0xf]);
+				return;
+			}
+			AppendUtf8CodePoint(InSink, InCodePoint);
+		}
+
+		/**
+		 * Decode the code point starting at a position of a wide string
+		 * Wide strings are UTF-16 where wchar_t is 16 bits (surrogate pairs are combined), UTF-32 otherwise
+		 * @param InValue Wide string
+		 * @param InOutIndex Position, moved to the last code unit of the code point
+		 * @return Code point, U+FFFD if not encodable (unpaired surrogate, out of range)
+		 */
+		constexpr uint32 DecodeWideCodePoint(std::wstring_view InValue, std::size_t& InOutIndex)
+		{
+			uint32 CodePoint = static_cast<uint32>(InValue[InOutIndex]);
+			if constexpr (sizeof(wchar_t) == 2)
+			{
+				if (CodePoint >= 0xd800 && CodePoint < 0xdc00 && InOutIndex + 1 < InValue.size()
+					&& static_cast<uint32>(InValue[InOutIndex + 1]) >= 0xdc00 && static_cast<uint32>(InValue[InOutIndex + 1]) < 0xe000)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xd800) << 10) + (static_cast<uint32>(InValue[InOutIndex + 1]) - 0xdc00);
+					++InOutIndex;
+				}
+			}
+			if ((CodePoint >= 0xd800 && CodePoint < 0xe000) || CodePoint > 0x10ffff)
+				CodePoint = 0xfffd;
+			return CodePoint;
+		}
+
+		/**
+		 * Append a wide string to a sink as JSON string content (UTF-8, escaped)
+		 * @param InSink Sink providing Push(char)
+		 * @param InValue String to append
+		 */
+		template<class sink_t>
+		constexpr void AppendJsonEscaped(sink_t& InSink, std::wstring_view InValue)
+		{
+			for (std::size_t i = 0; i < InValue.size(); ++i)
+				AppendJsonCodePoint(InSink, DecodeWideCodePoint(InValue, i));
+		}
+
+		/**
+		 * Append a wide string to a sink, converted to UTF-8 (not escaped)
+		 * @param InSink Sink providing Push(char)
+		 * @param InValue String to append
+		 */
+		template<class sink_t>
+		constexpr void AppendUtf8(sink_t& InSink, std::wstring_view InValue)
+		{
+			for (std::size_t i = 0; i < InValue.size(); ++i)
+				AppendUtf8CodePoint(InSink, DecodeWideCodePoint(InValue, i));
+		}
+	}
+
+	/**
+	 * Appends JSON text to a growable buffer
+	 * The buffer is owned by the caller and can be reused across writes to avoid reallocations
+	 */
+	class FJsonWriter
+	{
+	public:
+		explicit FJsonWriter(std::string& OutBuffer)
+			: Buffer(&OutBuffer)
+		{
+		}
+
+		/**
+		 * Append a character
+		 * @param InChar Character to append
+		 */
+		void Push(char InChar) { Buffer->push_back(InChar); }
+
+		/**
+		 * Append text as is
+		 * @param InText Text to append
+		 */
+		void WriteRaw(std::string_view InText) { Buffer->append(InText.data(), InText.size()); }
+
+		void WriteNull() { WriteRaw("null"); }
+
+		void WriteBool(bool bInValue) { WriteRaw(bInValue ? std::string_view("true") : std::string_view("false")); }
+
+		/**
+		 * Append a number
+		 * Floating point values are written in their shortest round trip form; NaN & infinities are written as null
+		 * @param InValue Value to append
+		 */
+		template<class T>
+		void WriteNumber(T InValue)
+		{
+			static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "WriteNumber expects a numeric type");
+
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				if (!std::isfinite(InValue))
+				{
+					WriteNull();
+					return;
+				}
+			}
+
+			char Digits[32];
+			std::to_chars_result Result;
+			if constexpr (std::is_floating_point_v<T>)
+				Result = std::to_chars(Digits, Digits + sizeof(Digits), InValue);
+			else if constexpr (std::is_signed_v<T>)
+				Result = std::to_chars(Digits, Digits + sizeof(Digits), static_cast<int64>(InValue));
+			else
+				Result = std::to_chars(Digits, Digits + sizeof(Digits), static_cast<uint64>(InValue));
+			Buffer->append(Digits, Result.ptr);
+		}
+
+		/**
+		 * Append a quoted & escaped string
+		 * @param InValue UTF-8 string
+		 */
+		void WriteString(std::string_view InValue)
+		{
+			Push('"');
+			// Append runs of characters that need no escaping at once
+			std::size_t RunStart = 0;
+			for (std::size_t i = 0; i < InValue.size(); ++i)
+			{
+				const unsigned char Char = static_cast<unsigned char>(InValue[i]);
+				if (Char >= 0x20 && Char != '"' && Char != '\\')
+					continue;
+				Buffer->append(InValue.data() + RunStart, i - RunStart);
+				Details::AppendJsonCodePoint(*this, Char);
+				RunStart = i + 1;
+			}
+			Buffer->append(InValue.data() + RunStart, InValue.size() - RunStart);
+			Push('"');
+		}
+
+		/**
+		 * Append a quoted & escaped string, converted to UTF-8
+		 * @param InValue Wide string
+		 */
+		void WriteString(std::wstring_view InValue)
+		{
+			Push('"');
+			Details::AppendJsonEscaped(*this, InValue);
+			Push('"');
+		}
+
+		/**
+		 * Reserve space for upcoming writes
+		 * @param InSize Number of characters about to be written
+		 */
+		void Reserve(std::size_t InSize) { Buffer->reserve(Buffer->size() + InSize); }
+
+		std::string& GetBuffer() const { return *Buffer; }
+
+	private:
+		std::string* Buffer;
+	};
+
+	/**
+	 * JSON traits of leaf types which are neither numbers, enums nor strings
+	 * Specialize with static Write(FJsonWriter&, const T&), writing exactly one JSON value,
+	 * and static bool Read(FJsonReader&, T&) to be read back (see LayoutJsonReader.h)
+	 */
+	template<class T>
+	class TJsonTraits
+	{
+		TJsonTraits() = delete;
+	};
+
+	template<class char_t, class traits_t, class allocator_t>
+	class TJsonTraits<std::basic_string<char_t, traits_t, allocator_t>>
+	{
+	public:
+		static void Write(FJsonWriter& InWriter, const std::basic_string<char_t, traits_t, allocator_t>& InValue)
+		{
+			InWriter.WriteString(std::basic_string_view<char_t>(InValue.data(), InValue.size()));
+		}
+
+		template<class reader_t>
+		static bool Read(reader_t& InReader, std::basic_string<char_t, traits_t, allocator_t>& OutValue)
+		{
+			return InReader.ReadString(OutValue);
+		}
+	};
+
+	namespace Details
+	{
+		/**
+		 * Counts the structural text of a layout
+		 */
+		struct FJsonLayoutTextCounter
+		{
+			int32 NumChars = 0;
+			int32 NumLeaves = 0;
+
+			constexpr void Push(char) { ++NumChars; }
+			constexpr void EndLeaf() { ++NumLeaves; }
+		};
+
+		/**
+		 * Stores the structural text of a layout
+		 * Chunk i spans [Offsets[i], Offsets[i + 1]) and ends with the key of leaf i; the last chunk closes the object
+		 */
+		template<int32 num_chars, int32 num_leaves>
+		struct TJsonLayoutTextBuilder
+		{
+			std::array<char, num_chars> Chars = {};
+			std::array<int32, num_leaves + 1> Offsets = {};
+			int32 NumChars = 0;
+			int32 NumLeaves = 0;
+
+			constexpr void Push(char InChar) { Chars[NumChars++] = InChar; }
+			constexpr void EndLeaf() { Offsets[++NumLeaves] = NumChars; }
+		};
+
+		/**
+		 * Generate the structural text of a layout from its flattened table
+		 * Keys are the field names (last part of the dotted name); nested layouts open a nested object
+		 */
+		template<class T, class builder_t>
+		constexpr void BuildJsonLayoutText(builder_t& InBuilder)
+		{
+			InBuilder.Push('{');
+			int32 OpenDepth = 0;
+			bool bFirstMember = true;
+			for (const FLayoutFieldDesc& Field : TLayoutTable<T>::Fields)
+			{
+				for (; OpenDepth > Field.Depth; --OpenDepth)
+				{
+					InBuilder.Push('}');
+					bFirstMember = false;
+				}
+				if (!bFirstMember)
+					InBuilder.Push(',');
+
+				const std::size_t Separator = Field.Name.rfind(L'.');
+				InBuilder.Push('"');
+				AppendJsonEscaped(InBuilder, Separator == std::wstring_view::npos ? Field.Name : Field.Name.substr(Separator + 1));
+				InBuilder.Push('"');
+				InBuilder.Push(':');
+
+				if (Field.bHasLayout)
+				{
+					InBuilder.Push('{');
+					++OpenDepth;
+					bFirstMember = true;
+				}
+				else
+				{
+					InBuilder.EndLeaf();
+					bFirstMember = false;
+				}
+			}
+			for (; OpenDepth > 0; --OpenDepth)
+				InBuilder.Push('}');
+			InBuilder.Push('}');
+		}
+
+		template<class T>
+		constexpr FJsonLayoutTextCounter CountJsonLayoutText()
+		{
+			FJsonLayoutTextCounter Counter;
+			BuildJsonLayoutText<T>(Counter);
+			return Counter;
+		}
+	}
+
+	/**
+	 * Compile-time JSON text of a layout
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TJsonLayoutText
+	{
+	private:
+		static constexpr Details::FJsonLayoutTextCounter Size = Details::CountJsonLayoutText<T>();
+		using BuilderType = Details::TJsonLayoutTextBuilder<Size.NumChars, Size.NumLeaves>;
+
+		static constexpr BuilderType Build()
+		{
+			BuilderType Builder;
+			Details::BuildJsonLayoutText<T>(Builder);
+			return Builder;
+		}
+
+		static constexpr BuilderType Data = Build();
+
+	public:
+		/** Number of leaf fields, i.e values to write */
+		static constexpr int32 NumLeaves = Size.NumLeaves;
+		/** Total length of the structural text */
+		static constexpr int32 NumChars = Size.NumChars;
+
+		/**
+		 * Get the text to write before a leaf value: closing & opening braces, comma and quoted key
+		 * @param InLeafRank Rank of the leaf, in iteration order
+		 */
+		static constexpr std::string_view GetLeafPrefix(int32 InLeafRank)
+		{
+			return std::string_view(Data.Chars.data() + Data.Offsets[InLeafRank], static_cast<std::size_t>(Data.Offsets[InLeafRank + 1] - Data.Offsets[InLeafRank]));
+		}
+
+		/**
+		 * Get the text to write after the last leaf value
+		 */
+		static constexpr std::string_view GetSuffix()
+		{
+			return std::string_view(Data.Chars.data() + Data.Offsets[NumLeaves], static_cast<std::size_t>(NumChars - Data.Offsets[NumLeaves]));
+		}
+	};
+
+	template<class T>
+	void WriteJson(const T& InObject, FJsonWriter& InWriter);
+
+	namespace Details
+	{
+		/**
+		 * Write a single JSON value
+		 */
+		template<class T>
+		void WriteJsonValue(FJsonWriter& InWriter, const T& InValue)
+		{
+			if constexpr (HasLayout<T>::Value)
+				WriteJson(InValue, InWriter);
+			else if constexpr (std::is_same_v<T, bool>)
+				InWriter.WriteBool(InValue);
+			else if constexpr (std::is_arithmetic_v<T>)
+				InWriter.WriteNumber(InValue);
+			else if constexpr (std::is_enum_v<T>)
+				InWriter.WriteNumber(static_cast<std::underlying_type_t<T>>(InValue));
+			else if constexpr (IsContainer<T>::Value)
+			{
+				InWriter.Push('[');
+				ForEachElement(InValue, [&InWriter](std::size_t InIndex, const auto& InElement)
+				{
+					if (InIndex > 0)
+						InWriter.Push(',');
+					WriteJsonValue(InWriter, InElement);
+				});
+				InWriter.Push(']');
+			}
+			else
+				TJsonTraits<T>::Write(InWriter, InValue);
+		}
+
+		/**
+		 * IterateLayoutNamed callable writing the leaves of an object
+		 * Leaves are visited in table order, so a running rank selects their compile-time prefix
+		 */
+		template<class T>
+		struct TJsonLeafWriter
+		{
+			FJsonWriter& Writer;
+			const uint8* Data;
+			int32 LeafRank = 0;
+
+			template<class parent_field_t, class field_t>
+			EFieldIterator operator()(const parent_field_t&, const field_t&)
+			{
+				using FieldType = typename field_t::Type;
+				if constexpr (!HasLayout<FieldType>::Value)
+				{
+					Writer.WriteRaw(TJsonLayoutText<T>::GetLeafPrefix(LeafRank++));
+					WriteJsonValue(Writer, *reinterpret_cast<const FieldType*>(Data + field_t::MemberOffset));
+				}
+				return EFieldIterator::Enter;
+			}
+		};
+	}
+
+	/**
+	 * Write an object as a JSON object
+	 * @param InObject Object to write
+	 * @param InWriter Writer to append to
+	 */
+	template<class T>
+	void WriteJson(const T& InObject, FJsonWriter& InWriter)
+	{
+		Details::TJsonLeafWriter<T> LeafWriter{ InWriter, reinterpret_cast<const uint8*>(&InObject) };
+		IterateLayoutNamed<T>(LeafWriter);
+		InWriter.WriteRaw(TJsonLayoutText<T>::GetSuffix());
+	}
+
+	/**
+	 * Write objects as a JSON array
+	 * @param InObjects Objects to write
+	 * @param InWriter Writer to append to
+	 */
+	template<class T>
+	void WriteJsonArray(std::span<const T> InObjects, FJsonWriter& InWriter)
+	{
+		// Structural text plus a rough estimate of the values
+		InWriter.Reserve(InObjects.size() * (static_cast<std::size_t>(TJsonLayoutText<T>::NumChars) + 1 + 8 * static_cast<std::size_t>(TJsonLayoutText<T>::NumLeaves)) + 2);
+		InWriter.Push('[');
+		for (std::size_t i = 0; i < InObjects.size(); ++i)
+		{
+			if (i > 0)
+				InWriter.Push(',');
+			WriteJson(InObjects[i], InWriter);
+		}
+		InWriter.Push(']');
+	}
+
+	/**
+	 * Convert an object to a JSON string
+	 * Allocates a new string; prefer WriteJson with a reused buffer on hot paths
+	 * @param InObject Object to convert
+	 * @return JSON text
+	 */
+	template<class T>
+	std::string ToJson(const T& InObject)
+	{
+		std::string Result;
+		FJsonWriter Writer(Result);
+		WriteJson(InObject, Writer);
+		return Result;
+	}
+}
@@ -0,0 +1,780 @@
+/*!
+ *  @file LayoutJsonReader.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a JSON reader driven by layouts, the counterpart of LayoutJson.h.
+ *  Each layout gets a compile-time member table: UTF-8 keys, offsets & typed read functions, indexed by a perfect hash of
+ *  the keys. Reading an object hashes each key straight from the input text and jumps to the member read function;
+ *  nested objects recurse into nested layouts. Neither keys nor values allocate (string members reuse their capacity).
+ */
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "LayoutJson.h"
+#include <Core/Hash.h>
+#include <Core/PerfectHash.h>
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+using int64 = std::int64_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	namespace Details
+	{
+		/**
+		 * Decode the UTF-8 code point starting at a position
+		 * @param InData UTF-8 bytes
+		 * @param InSize Number of bytes
+		 * @param InOutIndex Position, moved past the code point
+		 * @return Code point, U+FFFD for invalid sequences
+		 */
+		inline uint32 DecodeUtf8CodePoint(const char* InData, std::size_t InSize, std::size_t& InOutIndex)
+		{
+			const uint32 Lead = static_cast<unsigned char>(InData[InOutIndex++]);
+			if (Lead < 0x80)
+				return Lead;
+
+			int32 NumContinuations = 0;
+			uint32 CodePoint = 0;
+			uint32 MinCodePoint = 0;
+			if ((Lead & 0xe0) == 0xc0) { NumContinuations = 1; CodePoint = Lead & 0x1f; MinCodePoint = 0x80; }
+			else if ((Lead & 0xf0) == 0xe0) { NumContinuations = 2; CodePoint = Lead & 0x0f; MinCodePoint = 0x800; }
+			else if ((Lead & 0xf8) == 0xf0) { NumContinuations = 3; CodePoint = Lead & 0x07; MinCodePoint = 0x10000; }
+			else return 0xfffd;
+
+			for (int32 i = 0; i < NumContinuations; ++i)
+			{
+				if (InOutIndex >= InSize || (static_cast<unsigned char>(InData[InOutIndex]) & 0xc0) != 0x80)
+					return 0xfffd;
+				CodePoint = (CodePoint << 6) | (static_cast<unsigned char>(InData[InOutIndex++]) & 0x3f);
+			}
+
+			if (CodePoint < MinCodePoint || CodePoint > 0x10ffff || (CodePoint >= 0xd800 && CodePoint < 0xe000))
+				return 0xfffd;
+			return CodePoint;
+		}
+
+		/**
+		 * String sink appending to a narrow string (UTF-8)
+		 */
+		struct FJsonNarrowStringSink
+		{
+			std::string& Value;
+
+			void Push(char InChar) { Value.push_back(InChar); }
+			void AppendRun(const char* InData, std::size_t InSize) { Value.append(InData, InSize); }
+			void AppendCodePoint(uint32 InCodePoint) { AppendUtf8CodePoint(*this, InCodePoint); }
+		};
+
+		/**
+		 * String sink appending to a wide string (UTF-16 or UTF-32, see DecodeWideCodePoint)
+		 */
+		struct FJsonWideStringSink
+		{
+			std::wstring& Value;
+
+			void AppendRun(const char* InData, std::size_t InSize)
+			{
+				for (std::size_t i = 0; i < InSize;)
+					AppendCodePoint(DecodeUtf8CodePoint(InData, InSize, i));
+			}
+
+			void AppendCodePoint(uint32 InCodePoint)
+			{
+				if constexpr (sizeof(wchar_t) == 2)
+				{
+					if (InCodePoint >= 0x10000)
+					{
+						InCodePoint -= 0x10000;
+						Value.push_back(static_cast<wchar_t>(0xd800 + (InCodePoint >> 10)));
+						Value.push_back(static_cast<wchar_t>(0xdc00 + (InCodePoint & 0x3ff)));
+						return;
+					}
+				}
+				Value.push_back(static_cast<wchar_t>(InCodePoint));
+			}
+		};
+
+		/**
+		 * String sink writing to a fixed buffer, flagging overflows
+		 */
+		template<std::size_t max_size>
+		struct TJsonFixedStringSink
+		{
+			std::array<char, max_size>& Buffer;
+			std::size_t Num = 0;
+			bool bOverflow = false;
+
+			void Push(char InChar)
+			{
+				if (Num < max_size)
+					Buffer[Num++] = InChar;
+				else
+					bOverflow = true;
+			}
+
+			void AppendRun(const char* InData, std::size_t InSize)
+			{
+				for (std::size_t i = 0; i < InSize; ++i)
+					Push(InData[i]);
+			}
+
+			void AppendCodePoint(uint32 InCodePoint) { AppendUtf8CodePoint(*this, InCodePoint); }
+		};
+	}
+
+	/**
+	 * Reads JSON text
+	 * Any malformed input sets the error flag; further reads are no-ops returning false
+	 */
+	class FJsonReader
+	{
+	public:
+		/** Longest escaped key that can be unescaped; longer keys match no member */
+		static constexpr std::size_t MaxEscapedKeyLength = 256;
+
+		explicit FJsonReader(std::string_view InText)
+			: Text(InText)
+		{
+		}
+
+		/**
+		 * Skip whitespace characters
+		 */
+		void SkipWhitespace()
+		{
+			while (Cursor < Text.size() && (Text[Cursor] == ' ' || Text[Cursor] == '\n' || Text[Cursor] == '\r' || Text[Cursor] == '\t'))
+				++Cursor;
+		}
+
+		/**
+		 * Consume a structural character if it comes next
+		 * @param InChar Character
+		 * @return True if consumed
+		 */
+		bool TryConsume(char InChar)
+		{
+			SkipWhitespace();
+			if (bError || Cursor >= Text.size() || Text[Cursor] != InChar)
+				return false;
+			++Cursor;
+			return true;
+		}
+
+		/**
+		 * Consume an expected structural character
+		 * @param InChar Character
+		 * @return False if something else comes next
+		 */
+		bool Consume(char InChar)
+		{
+			return TryConsume(InChar) || SetError();
+		}
+
+		/**
+		 * Read null
+		 * @return False if the next value is not null
+		 */
+		bool ReadNull()
+		{
+			SkipWhitespace();
+			return ConsumeLiteral("null") || SetError();
+		}
+
+		/**
+		 * Read a boolean
+		 * @param OutValue Value
+		 * @return False if the next value is not a boolean
+		 */
+		bool ReadBool(bool& OutValue)
+		{
+			SkipWhitespace();
+			if (ConsumeLiteral("true"))
+				OutValue = true;
+			else if (ConsumeLiteral("false"))
+				OutValue = false;
+			else
+				return SetError();
+			return true;
+		}
+
+		/**
+		 * Read a number
+		 * Integers must be in range of T & have no fractional part or exponent; null reads as NaN into floating point values
+		 * @param OutValue Value
+		 * @return False if the next value is not a number representable by T
+		 */
+		template<class T>
+		bool ReadNumber(T& OutValue)
+		{
+			static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "ReadNumber expects a numeric type");
+
+			SkipWhitespace();
+			if (bError)
+				return false;
+
+			const char* First = Text.data() + Cursor;
+			const char* Last = Text.data() + Text.size();
+			std::from_chars_result Result;
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				if (ConsumeLiteral("null"))
+				{
+					OutValue = std::numeric_limits<T>::quiet_NaN();
+					return true;
+				}
+				Result = std::from_chars(First, Last, OutValue);
+			}
+			else
+			{
+				using ParseType = std::conditional_t<std::is_signed_v<T>, int64, uint64>;
+				ParseType Value = 0;
+				Result = std::from_chars(First, Last, Value);
+				if (Result.ec == std::errc{} && (Value < static_cast<ParseType>(std::numeric_limits<T>::min()) || Value > static_cast<ParseType>(std::numeric_limits<T>::max())))
+					return SetError();
+				OutValue = static_cast<T>(Value);
+
+				if (Result.ptr != Last && (*Result.ptr == '.' || *Result.ptr == 'e' || *Result.ptr == 'E'))
+					return SetError();
+			}
+
+			if (Result.ec != std::errc{})
+				return SetError();
+			Cursor = static_cast<std::size_t>(Result.ptr - Text.data());
+			return true;
+		}
+
+		/**
+		 * Read a string, replacing the content of the output (its capacity is reused)
+		 * @param OutValue UTF-8 string
+		 * @return False if the next value is not a string
+		 */
+		bool ReadString(std::string& OutValue)
+		{
+			OutValue.clear();
+			Details::FJsonNarrowStringSink Sink{ OutValue };
+			return ParseString(Sink);
+		}
+
+		/**
+		 * Read a string, replacing the content of the output (its capacity is reused)
+		 * @param OutValue Wide string
+		 * @return False if the next value is not a string
+		 */
+		bool ReadString(std::wstring& OutValue)
+		{
+			OutValue.clear();
+			Details::FJsonWideStringSink Sink{ OutValue };
+			return ParseString(Sink);
+		}
+
+		/**
+		 * Read an object key and the following colon
+		 * @param OutKey Unescaped key (UTF-8); points into the input text, or into the reader if the key had escapes
+		 * @return False if the next value is not a key
+		 */
+		bool ReadKey(std::string_view& OutKey)
+		{
+			SkipWhitespace();
+			if (bError || Cursor >= Text.size() || Text[Cursor] != '"')
+				return SetError();
+
+			// Keys without escapes are used in place
+			std::size_t End = Cursor + 1;
+			while (End < Text.size() && Text[End] != '"' && Text[End] != '\\')
+				++End;
+			if (End < Text.size() && Text[End] == '"')
+			{
+				OutKey = Text.substr(Cursor + 1, End - Cursor - 1);
+				Cursor = End + 1;
+			}
+			else
+			{
+				Details::TJsonFixedStringSink<MaxEscapedKeyLength> Sink{ KeyBuffer };
+				if (!ParseString(Sink))
+					return false;
+				// Field names are never empty, an overflowing key matches nothing
+				OutKey = Sink.bOverflow ? std::string_view() : std::string_view(KeyBuffer.data(), Sink.Num);
+			}
+			return Consume(':');
+		}
+
+		/**
+		 * Skip the next value, including nested objects & arrays
+		 * Skipped values are only checked for structure (balanced brackets, terminated strings)
+		 * @return False if the input is malformed
+		 */
+		bool SkipValue()
+		{
+			int32 Depth = 0;
+			do
+			{
+				SkipWhitespace();
+				if (bError || Cursor >= Text.size())
+					return SetError();
+
+				const char Char = Text[Cursor];
+				if (Char == '{' || Char == '[')
+				{
+					++Depth;
+					++Cursor;
+				}
+				else if (Char == '}' || Char == ']')
+				{
+					if (Depth == 0)
+						return SetError();
+					--Depth;
+					++Cursor;
+				}
+				else if (Char == ',' || Char == ':')
+				{
+					if (Depth == 0)
+						return SetError();
+					++Cursor;
+				}
+				else if (Char == '"')
+				{
+					for (++Cursor; Cursor < Text.size() && Text[Cursor] != '"'; ++Cursor)
+					{
+						if (Text[Cursor] == '\\')
+							++Cursor;
+					}
+					if (Cursor >= Text.size())
+						return SetError();
+					++Cursor;
+				}
+				else
+				{
+					// Number or literal
+					const std::size_t Start = Cursor;
+					while (Cursor < Text.size() && IsScalarChar(Text[Cursor]))
+						++Cursor;
+					if (Cursor == Start)
+						return SetError();
+				}
+			} while (Depth > 0);
+			return true;
+		}
+
+		/**
+		 * Check whether only whitespace remains
+		 */
+		bool IsAtEnd()
+		{
+			SkipWhitespace();
+			return Cursor >= Text.size();
+		}
+
+		/**
+		 * Flag the input as malformed
+		 * @return False
+		 */
+		bool SetError()
+		{
+			bError = true;
+			return false;
+		}
+
+		bool HasError() const { return bError; }
+		std::size_t Tell() const { return Cursor; }
+
+	private:
+		static constexpr bool IsScalarChar(char InChar)
+		{
+			return (InChar >= '0' && InChar <= '9') || (InChar >= 'a' && InChar <= 'z') || (InChar >= 'A' && InChar <= 'Z') || InChar == '-' || InChar == '+' || InChar == '.';
+		}
+
+		bool ConsumeLiteral(std::string_view InLiteral)
+		{
+			if (bError || Text.compare(Cursor, InLiteral.size(), InLiteral) != 0)
+				return false;
+			if (Cursor + InLiteral.size() < Text.size() && IsScalarChar(Text[Cursor + InLiteral.size()]))
+				return false;
+			Cursor += InLiteral.size();
+			return true;
+		}
+
+		bool ReadHex4(uint32& OutValue)
+		{
+			if (Text.size() - Cursor < 4)
+				return false;
+			OutValue = 0;
+			for (int32 i = 0; i < 4; ++i)
+			{
+				const char Char = Text[Cursor++];
+				const uint32 Digit = Char >= '0' && Char <= '9' ? Char - '0' : Char >= 'a' && Char <= 'f' ? Char - 'a' + 10 : Char >= 'A' && Char <= 'F' ? Char - 'A' + 10 : 16;
+				if (Digit > 15)
+					return false;
+				OutValue = (OutValue << 4) | Digit;
+			}
+			return true;
+		}
+
+		/**
+		 * Parse a string, appending unescaped runs & escaped code points to a sink
+		 */
+		template<class sink_t>
+		bool ParseString(sink_t& InSink)
+		{
+			SkipWhitespace();
+			if (bError || Cursor >= Text.size() || Text[Cursor] != '"')
+				return SetError();
+
+			std::size_t RunStart = ++Cursor;
+			for (;;)
+			{
+				if (Cursor >= Text.size())
+					return SetError();
+
+				const unsigned char Char = static_cast<unsigned char>(Text[Cursor]);
+				if (Char == '"')
+				{
+					InSink.AppendRun(Text.data() + RunStart, Cursor - RunStart);
+					++Cursor;
+					return true;
+				}
+				if (Char < 0x20)
+					return SetError();
+				if (Char != '\\')
+				{
+					++Cursor;
+					continue;
+				}
+
+				InSink.AppendRun(Text.data() + RunStart, Cursor - RunStart);
+				if (++Cursor >= Text.size())
+					return SetError();
+
+				uint32 CodePoint = 0;
+				switch (Text[Cursor++])
+				{
+				case '"': CodePoint = '"'; break;
+				case '\\': CodePoint = '\\'; break;
+				case '/': CodePoint = '/'; break;
+				case 'b': CodePoint = '\b'; break;
+				case 'f': CodePoint = '\f'; break;
+				case 'n': CodePoint = '\n'; break;
+				case 'r': CodePoint = '\r'; break;
+				case 't': CodePoint = '\t'; break;
+				case 'u':
+					if (!ReadHex4(CodePoint))
+						return SetError();
+					if (CodePoint >= 0xd800 && CodePoint < 0xdc00)
+					{
+						uint32 Low = 0;
+						if (Text.compare(Cursor, 2, "\\u") == 0 && (Cursor += 2, ReadHex4(Low)) && Low >= 0xdc00 && Low < 0xe000)
+							CodePoint = 0x10000 + ((CodePoint - 0xd800) << 10) + (Low - 0xdc00);
+						else
+							return SetError();
+					}
+					else if (CodePoint >= 0xdc00 && CodePoint < 0xe000)
+					{
+						return SetError();
+					}
+					break;
+				default:
+					return SetError();
+				}
+				InSink.AppendCodePoint(CodePoint);
+				RunStart = Cursor;
+			}
+		}
+
+		std::string_view Text;
+		std::size_t Cursor = 0;
+		bool bError = false;
+		std::array<char, MaxEscapedKeyLength> KeyBuffer = {};
+	};
+
+	template<class T>
+	bool ReadJson(T& OutObject, FJsonReader& InReader);
+
+	/**
+	 * Member of a layout, as read from JSON
+	 */
+	struct FJsonMemberDesc
+	{
+		using ReadFunc = bool(*)(FJsonReader&, uint8*);
+
+		/** Key, within the key characters of the member table */
+		int32 KeyOffset = 0;
+		int32 KeyLength = 0;
+		/** Offset of the member within its parent */
+		int32 Offset = 0;
+		/** Read the member value */
+		ReadFunc Read = nullptr;
+	};
+
+	namespace Details
+	{
+		template<class T>
+		bool ReadJsonValue(FJsonReader& InReader, T& OutValue);
+
+		/**
+		 * Read a JSON array into a container
+		 * Dynamic arrays are resized to the number of values; fixed arrays & views must receive exactly their number of elements
+		 */
+		template<class T>
+		bool ReadJsonArray(FJsonReader& InReader, T& OutValue)
+		{
+			using TraitsType = TContainerTraits<T>;
+			if constexpr (std::is_const_v<typename TraitsType::ElementType>)
+			{
+				// Views over const elements can't be read into
+				return InReader.SetError();
+			}
+			else
+			{
+				if (!InReader.Consume('['))
+					return false;
+
+				if constexpr (TraitsType::Kind == EFieldKind::DynamicArray)
+				{
+					// Elements are overwritten in place, so that nested strings & arrays reuse their capacity
+					std::size_t Num = 0;
+					if (!InReader.TryConsume(']'))
+					{
+						do
+						{
+							if (Num == OutValue.size())
+								OutValue.emplace_back();
+							if (!ReadJsonValue(InReader, OutValue[Num++]))
+								return false;
+						} while (InReader.TryConsume(','));
+
+						if (!InReader.Consume(']'))
+							return false;
+					}
+					OutValue.resize(Num);
+					return true;
+				}
+				else
+				{
+					const auto Elements = GetElements(OutValue);
+					if (Elements.empty())
+						return InReader.Consume(']');
+
+					for (std::size_t i = 0; i < Elements.size(); ++i)
+					{
+						if ((i > 0 && !InReader.Consume(',')) || !ReadJsonValue(InReader, Elements[i]))
+							return false;
+					}
+					return InReader.Consume(']');
+				}
+			}
+		}
+
+		/**
+		 * Read a single JSON value
+		 */
+		template<class T>
+		bool ReadJsonValue(FJsonReader& InReader, T& OutValue)
+		{
+			if constexpr (HasLayout<T>::Value)
+				return ReadJson(OutValue, InReader);
+			else if constexpr (std::is_same_v<T, bool>)
+				return InReader.ReadBool(OutValue);
+			else if constexpr (std::is_arithmetic_v<T>)
+				return InReader.ReadNumber(OutValue);
+			else if constexpr (std::is_enum_v<T>)
+			{
+				std::underlying_type_t<T> Value = {};
+				if (!InReader.ReadNumber(Value))
+					return false;
+				OutValue = static_cast<T>(Value);
+				return true;
+			}
+			else if constexpr (IsContainer<T>::Value)
+				return ReadJsonArray(InReader, OutValue);
+			else
+				return TJsonTraits<T>::Read(InReader, OutValue);
+		}
+
+		template<class T>
+		bool ReadJsonMember(FJsonReader& InReader, uint8* OutData)
+		{
+			return ReadJsonValue(InReader, *reinterpret_cast<T*>(OutData));
+		}
+
+		/**
+		 * Counts the members of a layout & the characters of their keys
+		 */
+		struct FJsonMemberTableCounter
+		{
+			int32 NumMembers = 0;
+			int32 NumChars = 0;
+
+			constexpr void Push(char) { ++NumChars; }
+			template<class T>
+			constexpr void AddMember(int32) { ++NumMembers; }
+		};
+
+		/**
+		 * Stores the members of a layout
+		 */
+		template<int32 num_members, int32 num_chars>
+		struct TJsonMemberTableBuilder
+		{
+			std::array<FJsonMemberDesc, num_members> Members = {};
+			std::array<char, num_chars> Chars = {};
+			int32 NumMembers = 0;
+			int32 NumChars = 0;
+			int32 KeyStart = 0;
+
+			constexpr void Push(char InChar) { Chars[NumChars++] = InChar; }
+
+			template<class T>
+			constexpr void AddMember(int32 InOffset)
+			{
+				Members[NumMembers++] = FJsonMemberDesc{ KeyStart, NumChars - KeyStart, InOffset, &ReadJsonMember<T> };
+				KeyStart = NumChars;
+			}
+		};
+
+		/**
+		 * Generate the member table of a layout: direct members only, nested layouts have their own table
+		 */
+		template<class T, class builder_t>
+		constexpr void BuildJsonMemberTable(builder_t& InBuilder)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				AppendUtf8(InBuilder, std::wstring_view(InField.GetName().CStr(), InField.GetName().Num()));
+				InBuilder.template AddMember<typename field_t::Type>(static_cast<int32>(field_t::MemberOffset));
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class T>
+		constexpr FJsonMemberTableCounter CountJsonMemberTable()
+		{
+			FJsonMemberTableCounter Counter;
+			BuildJsonMemberTable<T>(Counter);
+			return Counter;
+		}
+	}
+
+	/**
+	 * Compile-time JSON member table of a layout
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TJsonMemberTable
+	{
+	private:
+		static constexpr Details::FJsonMemberTableCounter Size = Details::CountJsonMemberTable<T>();
+		using BuilderType = Details::TJsonMemberTableBuilder<Size.NumMembers, Size.NumChars>;
+
+		static constexpr BuilderType Build()
+		{
+			BuilderType Builder;
+			Details::BuildJsonMemberTable<T>(Builder);
+			return Builder;
+		}
+
+		static constexpr BuilderType Data = Build();
+
+		static constexpr std::array<uint64, Size.NumMembers> BuildHashes()
+		{
+			std::array<uint64, Size.NumMembers> Result = {};
+			for (int32 i = 0; i < Size.NumMembers; ++i)
+				Result[i] = HashFnv1a(Data.Chars.data() + Data.Members[i].KeyOffset, static_cast<std::size_t>(Data.Members[i].KeyLength));
+			return Result;
+		}
+
+		static constexpr std::array<uint64, Size.NumMembers> Hashes = BuildHashes();
+
+	public:
+		/** Key hash to member index table */
+		static constexpr TPerfectHashTable<Size.NumMembers> HashTable = MakePerfectHashTable(Hashes);
+		static_assert(HashTable.bValid, "Unable to build the JSON member table, two member names share the same hash");
+
+		/** Direct members of the layout */
+		static constexpr std::array<FJsonMemberDesc, Size.NumMembers> Members = Data.Members;
+
+		/**
+		 * Get the key of a member
+		 * @param InIndex Member index
+		 * @return UTF-8 key
+		 */
+		static constexpr std::string_view GetKey(int32 InIndex)
+		{
+			return std::string_view(Data.Chars.data() + Members[InIndex].KeyOffset, static_cast<std::size_t>(Members[InIndex].KeyLength));
+		}
+
+		/**
+		 * Find a member from its key
+		 * @param InKey UTF-8 key
+		 * @return Member index, -1 if not found
+		 */
+		static constexpr int32 Find(std::string_view InKey)
+		{
+			const uint64 Hash = HashFnv1a(InKey.data(), InKey.size());
+			const int32 Index = HashTable.Find(Hash);
+			if (Index < 0 || Hashes[Index] != Hash || GetKey(Index) != InKey)
+				return -1;
+			return Index;
+		}
+	};
+
+	/**
+	 * Read a JSON object into an object
+	 * Members are matched by key; unknown keys are skipped & missing members keep their value
+	 * @param OutObject Object to read into
+	 * @param InReader Reader to consume
+	 * @return False if the input is malformed or a value doesn't fit its member
+	 */
+	template<class T>
+	bool ReadJson(T& OutObject, FJsonReader& InReader)
+	{
+		using TableType = TJsonMemberTable<T>;
+
+		uint8* Data = reinterpret_cast<uint8*>(&OutObject);
+		if (!InReader.Consume('{'))
+			return false;
+		if (InReader.TryConsume('}'))
+			return true;
+
+		do
+		{
+			std::string_view Key;
+			if (!InReader.ReadKey(Key))
+				return false;
+
+			const int32 Index = TableType::Find(Key);
+			const bool bSuccess = Index < 0 ? InReader.SkipValue() : TableType::Members[Index].Read(InReader, Data + TableType::Members[Index].Offset);
+			if (!bSuccess)
+				return false;
+		} while (InReader.TryConsume(','));
+
+		return InReader.Consume('}');
+	}
+
+	/**
+	 * Read an object from a JSON text
+	 * @param InText JSON text, holding a single object
+	 * @param OutObject Object to read into
+	 * @return False if the text is malformed or has trailing content
+	 */
+	template<class T>
+	bool FromJson(std::string_view InText, T& OutObject)
+	{
+		FJsonReader Reader(InText);
+		return ReadJson(OutObject, Reader) && Reader.IsAtEnd();
+	}
+}
@@ -0,0 +1,95 @@
+/*!
+ *  @file LayoutLookup.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares runtime field lookup by full dotted name ("Pos.X"), through a perfect hash table generated at compile time.
+ */
+
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "LayoutTable.h"
+#include <Core/Hash.h>
+#include <Core/PerfectHash.h>
+
+using int32 = std::int32_t;
+
+namespace Reflection
+{
+	/**
+	 * Field name lookup table of a type
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TLayoutFieldLookup
+	{
+		using TableType = TLayoutTable<T>;
+
+	private:
+		static constexpr std::array<uint64, TableType::Num> BuildHashes()
+		{
+			std::array<uint64, TableType::Num> Result = {};
+			for (int32 i = 0; i < TableType::Num; ++i)
+				Result[i] = HashFnv1a(TableType::Fields[i].Name.data(), TableType::Fields[i].Name.size());
+			return Result;
+		}
+
+		static constexpr std::array<uint64, TableType::Num> Hashes = BuildHashes();
+
+	public:
+		/** Name hash to field index table */
+		static constexpr TPerfectHashTable<TableType::Num> HashTable = MakePerfectHashTable(Hashes);
+		static_assert(HashTable.bValid, "Unable to build the field lookup table, two field names share the same hash");
+
+		/**
+		 * Find the index of a field
+		 * @param InName Full dotted name; narrow names are compared per code unit (ASCII)
+		 * @return Index within TLayoutTable<T>::Fields, -1 if not found
+		 */
+		template<class char_t>
+		static constexpr int32 FindIndex(std::basic_string_view<char_t> InName)
+		{
+			const uint64 Hash = HashFnv1a(InName.data(), InName.size());
+			const int32 Index = HashTable.Find(Hash);
+			if (Index < 0 || Hashes[Index] != Hash)
+				return -1;
+
+			const std::wstring_view Name = TableType::Fields[Index].Name;
+			if (Name.size() != InName.size())
+				return -1;
+			for (std::size_t i = 0; i < Name.size(); ++i)
+			{
+				if (static_cast<wchar_t>(InName[i]) != Name[i])
+					return -1;
+			}
+			return Index;
+		}
+	};
+
+	/**
+	 * Find a field of a type by its full dotted name
+	 * @param InName Name, e.g L"Pos.X"
+	 * @return Field descriptor (offset, size, type id...), nullptr if not found
+	 */
+	template<class T>
+	constexpr const FLayoutFieldDesc* FindField(std::wstring_view InName)
+	{
+		const int32 Index = TLayoutFieldLookup<T>::FindIndex(InName);
+		return Index >= 0 ? &TLayoutTable<T>::Fields[Index] : nullptr;
+	}
+
+	/**
+	 * Find a field of a type by its full dotted name
+	 * @param InName Name (ASCII), e.g "Pos.X"
+	 * @return Field descriptor (offset, size, type id...), nullptr if not found
+	 */
+	template<class T>
+	constexpr const FLayoutFieldDesc* FindField(std::string_view InName)
+	{
+		const int32 Index = TLayoutFieldLookup<T>::FindIndex(InName);
+		return Index >= 0 ? &TLayoutTable<T>::Fields[Index] : nullptr;
+	}
+}
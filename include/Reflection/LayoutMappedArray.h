@@ -0,0 +1,292 @@
+/*!
+ *  @file LayoutMappedArray.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares persisted arrays of reflected records, read in place through a memory mapping.
+ *  The file is a header followed by the raw records; the header carries the layout fingerprint of the record type,
+ *  validated once when the file is opened so that accessing records afterwards involves no check nor copy.
+ *  Records are stored in native endianness & layout, files are only portable between identical ABIs.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <type_traits>
+
+#include "LayoutTable.h"
+#include "LayoutView.h"
+#include <Core/MappedFile.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	/**
+	 * Header of a layout array file
+	 */
+	struct FLayoutArrayFileHeader
+	{
+		/** "RFLA"; a byte swapped value means the file was written with another endianness */
+		static constexpr uint32 MagicValue = 0x414c4652u;
+		static constexpr uint32 CurrentVersion = 1;
+		/** Records start at a multiple of this alignment */
+		static constexpr uint32 DataAlignment = 64;
+
+		uint32 Magic = MagicValue;
+		uint32 Version = CurrentVersion;
+		/** GetLayoutFingerprint<T>() of the record type */
+		uint64 Fingerprint = 0;
+		/** sizeof(T) */
+		uint32 RecordSize = 0;
+		/** alignof(T) */
+		uint32 RecordAlignment = 0;
+		/** Number of records */
+		uint64 NumRecords = 0;
+		/** Offset of the first record from the start of the file */
+		uint64 DataOffset = 0;
+	};
+
+	/**
+	 * Result of opening a layout array file
+	 */
+	enum class ELayoutArrayFileError
+	{
+		None,
+		/** The file could not be opened or mapped */
+		OpenFailed,
+		/** The file is smaller than its header or its records */
+		Truncated,
+		/** Not a layout array file, or written with another endianness */
+		BadMagic,
+		/** Written by an unsupported version */
+		BadVersion,
+		/** Written for another layout of the record type */
+		FingerprintMismatch,
+		/** Record size or alignment differ (e.g another ABI) */
+		RecordMismatch
+	};
+
+	namespace Details
+	{
+		template<class T>
+		constexpr void CheckLayoutArrayRecordType()
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Layout array records are read in place and must be trivially copyable");
+			static_assert(alignof(T) <= FLayoutArrayFileHeader::DataAlignment, "Layout array records are over-aligned");
+		}
+
+		template<class T>
+		constexpr FLayoutArrayFileHeader MakeLayoutArrayFileHeader(uint64 InNumRecords)
+		{
+			FLayoutArrayFileHeader Header;
+			Header.Fingerprint = GetLayoutFingerprint<T>();
+			Header.RecordSize = static_cast<uint32>(sizeof(T));
+			Header.RecordAlignment = static_cast<uint32>(alignof(T));
+			Header.NumRecords = InNumRecords;
+			Header.DataOffset = (sizeof(FLayoutArrayFileHeader) + FLayoutArrayFileHeader::DataAlignment - 1) / FLayoutArrayFileHeader::DataAlignment * FLayoutArrayFileHeader::DataAlignment;
+			return Header;
+		}
+	}
+
+	/**
+	 * Writes records to a layout array file, appending them as they come
+	 * The record count is patched in the header on Close()
+	 * @tparam T Record type
+	 */
+	template<class T>
+	class TLayoutArrayFileWriter
+	{
+	public:
+		TLayoutArrayFileWriter() = default;
+
+		~TLayoutArrayFileWriter()
+		{
+			Close();
+		}
+
+		/**
+		 * Create (or truncate) a file
+		 * @param InPath File path
+		 * @return True on success
+		 */
+		bool Open(const std::filesystem::path& InPath)
+		{
+			Details::CheckLayoutArrayRecordType<T>();
+
+			Close();
+			NumRecords = 0;
+			File.open(InPath, std::ios::binary | std::ios::trunc);
+			if (!File)
+				return false;
+
+			const FLayoutArrayFileHeader Header = Details::MakeLayoutArrayFileHeader<T>(0);
+			const uint8 Padding[FLayoutArrayFileHeader::DataAlignment] = {};
+			File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+			File.write(reinterpret_cast<const char*>(Padding), static_cast<std::streamsize>(Header.DataOffset - sizeof(Header)));
+			return static_cast<bool>(File);
+		}
+
+		/**
+		 * Append records
+		 * @param InRecords Records to append
+		 * @return True on success
+		 */
+		bool Append(std::span<const T> InRecords)
+		{
+			File.write(reinterpret_cast<const char*>(InRecords.data()), static_cast<std::streamsize>(InRecords.size_bytes()));
+			NumRecords += InRecords.size();
+			return static_cast<bool>(File);
+		}
+
+		/**
+		 * Write the final header & close the file
+		 * @return True if every write succeeded
+		 */
+		bool Close()
+		{
+			if (!File.is_open())
+				return false;
+
+			const FLayoutArrayFileHeader Header = Details::MakeLayoutArrayFileHeader<T>(NumRecords);
+			File.seekp(0);
+			File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+			const bool bSuccess = static_cast<bool>(File);
+			File.close();
+			return bSuccess;
+		}
+
+	private:
+		std::ofstream File;
+		uint64 NumRecords = 0;
+	};
+
+	/**
+	 * Write records to a layout array file
+	 * @param InPath File path
+	 * @param InRecords Records to write
+	 * @return True on success
+	 */
+	template<class T>
+	bool WriteLayoutArrayFile(const std::filesystem::path& InPath, std::span<const T> InRecords)
+	{
+		TLayoutArrayFileWriter<T> Writer;
+		return Writer.Open(InPath) && Writer.Append(InRecords) && Writer.Close();
+	}
+}
+
+namespace Rf
+{
+	/**
+	 * Read-only array of records mapped from a layout array file
+	 * Validation happens once in Open(); records are then accessed in place
+	 * @tparam T Record type
+	 */
+	template<class T>
+	class TMappedLayoutArray
+	{
+	public:
+		using HeaderType = Reflection::FLayoutArrayFileHeader;
+		using ErrorType = Reflection::ELayoutArrayFileError;
+
+		TMappedLayoutArray() = default;
+
+		/**
+		 * Map & validate a file
+		 * @param InPath File path
+		 * @return None on success
+		 */
+		ErrorType Open(const std::filesystem::path& InPath)
+		{
+			Reflection::Details::CheckLayoutArrayRecordType<T>();
+
+			Close();
+			if (!File.Open(InPath))
+				return ErrorType::OpenFailed;
+
+			const std::span<const uint8> Bytes = File.GetData();
+			const ErrorType Error = Validate(Bytes);
+			if (Error != ErrorType::None)
+			{
+				Close();
+				return Error;
+			}
+
+			HeaderType Header;
+			std::memcpy(&Header, Bytes.data(), sizeof(Header));
+			Records = std::span<const T>(reinterpret_cast<const T*>(Bytes.data() + Header.DataOffset), static_cast<std::size_t>(Header.NumRecords));
+			return ErrorType::None;
+		}
+
+		/**
+		 * Unmap the file
+		 */
+		void Close()
+		{
+			Records = std::span<const T>();
+			File.Close();
+		}
+
+		/**
+		 * Check whether a valid file is mapped
+		 */
+		bool IsValid() const { return File.IsValid(); }
+
+		std::size_t size() const { return Records.size(); }
+		bool empty() const { return Records.empty(); }
+		const T& operator[](std::size_t i) const { return Records[i]; }
+		const T* begin() const { return Records.data(); }
+		const T* end() const { return Records.data() + Records.size(); }
+
+		/**
+		 * Get all records
+		 * @return Records, pointing into the mapping
+		 */
+		std::span<const T> GetRecords() const { return Records; }
+
+		/**
+		 * Get a view over a record
+		 * @param i Record index
+		 * @return View, pointing into the mapping
+		 */
+		FLayoutFieldConstView GetView(std::size_t i) const
+		{
+			return FLayoutFieldConstView(CRef(Records[i]));
+		}
+
+		/**
+		 * Check a file content without mapping it
+		 * @param InBytes File content
+		 * @return None if the content holds records of T
+		 */
+		static ErrorType Validate(std::span<const uint8> InBytes)
+		{
+			if (InBytes.size() < sizeof(HeaderType))
+				return ErrorType::Truncated;
+
+			HeaderType Header;
+			std::memcpy(&Header, InBytes.data(), sizeof(Header));
+			if (Header.Magic != HeaderType::MagicValue)
+				return ErrorType::BadMagic;
+			if (Header.Version != HeaderType::CurrentVersion)
+				return ErrorType::BadVersion;
+			if (Header.Fingerprint != Reflection::GetLayoutFingerprint<T>())
+				return ErrorType::FingerprintMismatch;
+			if (Header.RecordSize != sizeof(T) || Header.RecordAlignment != alignof(T) || Header.DataOffset % alignof(T) != 0)
+				return ErrorType::RecordMismatch;
+			if (Header.DataOffset > InBytes.size() || Header.NumRecords > (InBytes.size() - Header.DataOffset) / sizeof(T))
+				return ErrorType::Truncated;
+			return ErrorType::None;
+		}
+
+	private:
+		FMappedFile File;
+		std::span<const T> Records;
+	};
+}
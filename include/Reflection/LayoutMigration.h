@@ -0,0 +1,525 @@
+/*!
+ *  @file LayoutMigration.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares schema migration of records written with a previous version of a layout.
+ *  A schema is a runtime copy of a layout table, persisted along the data. Migrating to the current layout matches leaf
+ *  fields by full dotted name; matching fields of the same type are copied (merged into memcpy runs where possible),
+ *  numeric fields are widened when the conversion is lossless, any other field keeps its default value.
+ *  Plans are built once per (source fingerprint, target type) pair and cached.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "LayoutSerializer.h"
+#include "LayoutTable.h"
+#include "TypeId.h"
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint16 = std::uint16_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
+using int64 = std::int64_t;
+
+namespace Reflection
+{
+	/**
+	 * Field of a layout schema
+	 */
+	struct FLayoutSchemaField
+	{
+		/** Full dotted name, e.g "Position.X" */
+		std::wstring Name;
+		/** Offset from the root object */
+		int32 Offset = 0;
+		int32 Size = 0;
+		/** See GetTypeId() */
+		uint64 TypeId = 0;
+		/** Whether the field type has a layout (i.e is not a leaf) */
+		bool bHasLayout = false;
+	};
+
+	/**
+	 * Runtime description of a layout, e.g the layout some persisted records were written with
+	 */
+	class FLayoutSchema
+	{
+	public:
+		/** Serialized schema magic, "RFLS" */
+		static constexpr uint32 MagicValue = 0x534c4652u;
+
+		int32 RecordSize = 0;
+		int32 RecordAlignment = 0;
+		/** Fields, in TLayoutTable order */
+		std::vector<FLayoutSchemaField> Fields;
+
+		/**
+		 * Compute the fingerprint of this schema
+		 * @return Fingerprint, equal to GetLayoutFingerprint<T>() for a schema built from T
+		 */
+		uint64 GetFingerprint() const
+		{
+			uint64 Hash = HashCombine(Fnv1aOffsetBasis, static_cast<uint64>(RecordSize));
+			Hash = HashCombine(Hash, static_cast<uint64>(RecordAlignment));
+			for (const FLayoutSchemaField& Field : Fields)
+			{
+				Hash = HashCombine(Hash, static_cast<uint64>(Field.Offset));
+				Hash = HashCombine(Hash, static_cast<uint64>(Field.Size));
+				Hash = HashCombine(Hash, Field.TypeId);
+				Hash = HashCombine(Hash, Field.Name.size());
+				Hash = HashFnv1a(Field.Name.data(), Field.Name.size(), Hash);
+			}
+			return Hash;
+		}
+
+		/**
+		 * Check whether a field lies within the record
+		 * @param InField Field of this schema
+		 */
+		bool IsInRecord(const FLayoutSchemaField& InField) const
+		{
+			return InField.Offset >= 0 && InField.Size >= 0 && static_cast<int64>(InField.Offset) + InField.Size <= RecordSize;
+		}
+
+		/**
+		 * Check the consistency of this schema: positive record size & power of two alignment, every field within the record
+		 * @return True if valid
+		 */
+		bool IsValid() const
+		{
+			if (RecordSize <= 0 || RecordAlignment <= 0 || (RecordAlignment & (RecordAlignment - 1)) != 0)
+				return false;
+			return std::all_of(Fields.begin(), Fields.end(), [this](const FLayoutSchemaField& InField) { return IsInRecord(InField); });
+		}
+
+		/**
+		 * Write this schema
+		 * Names are written as 16 bits code units, so that schemas are portable across wchar_t sizes
+		 */
+		void Serialize(FBinaryWriter& InWriter) const
+		{
+			InWriter.WriteValue(MagicValue);
+			InWriter.WriteValue(RecordSize);
+			InWriter.WriteValue(RecordAlignment);
+			InWriter.WriteValue(static_cast<uint32>(Fields.size()));
+			for (const FLayoutSchemaField& Field : Fields)
+			{
+				InWriter.WriteValue(static_cast<uint32>(Field.Name.size()));
+				for (const wchar_t Char : Field.Name)
+					InWriter.WriteValue(static_cast<uint16>(Char));
+				InWriter.WriteValue(Field.Offset);
+				InWriter.WriteValue(Field.Size);
+				InWriter.WriteValue(Field.TypeId);
+				InWriter.WriteValue(static_cast<uint8>(Field.bHasLayout ? 1 : 0));
+			}
+		}
+
+		/**
+		 * Read a schema written by Serialize()
+		 * @return False if the data is truncated, not a schema or an invalid one (see IsValid())
+		 */
+		bool Deserialize(FBinaryReader& InReader)
+		{
+			uint32 Magic = 0;
+			uint32 NumFields = 0;
+			if (!InReader.ReadValue(Magic) || Magic != MagicValue
+				|| !InReader.ReadValue(RecordSize) || !InReader.ReadValue(RecordAlignment) || !InReader.ReadValue(NumFields))
+			{
+				return false;
+			}
+
+			Fields.clear();
+			for (uint32 i = 0; i < NumFields; ++i)
+			{
+				FLayoutSchemaField Field;
+				uint32 NameLength = 0;
+				if (!InReader.ReadValue(NameLength) || InReader.Remaining() / sizeof(uint16) < NameLength)
+					return false;
+				Field.Name.resize(NameLength);
+				for (wchar_t& Char : Field.Name)
+				{
+					uint16 CodeUnit = 0;
+					InReader.ReadValue(CodeUnit);
+					Char = static_cast<wchar_t>(CodeUnit);
+				}
+
+				uint8 bHasLayout = 0;
+				if (!InReader.ReadValue(Field.Offset) || !InReader.ReadValue(Field.Size) || !InReader.ReadValue(Field.TypeId) || !InReader.ReadValue(bHasLayout))
+					return false;
+				Field.bHasLayout = bHasLayout != 0;
+				Fields.push_back(std::move(Field));
+			}
+			return IsValid();
+		}
+	};
+
+	/**
+	 * Build the schema of a type's current layout
+	 * @tparam T Reflected type
+	 * @return Schema
+	 */
+	template<class T>
+	FLayoutSchema MakeLayoutSchema()
+	{
+		FLayoutSchema Schema;
+		Schema.RecordSize = static_cast<int32>(sizeof(T));
+		Schema.RecordAlignment = static_cast<int32>(alignof(T));
+		Schema.Fields.reserve(TLayoutTable<T>::Num);
+		for (const FLayoutFieldDesc& Field : TLayoutTable<T>::Fields)
+			Schema.Fields.push_back(FLayoutSchemaField{ std::wstring(Field.Name), Field.Offset, Field.Size, Field.TypeId, Field.bHasLayout });
+		return Schema;
+	}
+
+	namespace Details
+	{
+		/**
+		 * Numeric types a migration can convert between
+		 */
+		enum class ENumericKind : uint8
+		{
+			Bool, Int8, Int16, Int32, Int64, UInt8, UInt16, UInt32, UInt64, Float32, Float64,
+			Num,
+			None = Num
+		};
+
+		using FNumericTypes = RTuple<bool, std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t, float, double>;
+
+		template<int32 kind>
+		using TNumericKindType = std::remove_cvref_t<decltype(FNumericTypes{}.Get<kind>())>;
+
+		template<std::size_t... Kinds>
+		constexpr std::array<uint64, sizeof...(Kinds)> MakeNumericTypeIds(std::index_sequence<Kinds...>)
+		{
+			return { GetTypeId<TNumericKindType<Kinds>>()... };
+		}
+
+		inline constexpr std::array<uint64, static_cast<int32>(ENumericKind::Num)> NumericTypeIds = MakeNumericTypeIds(std::make_index_sequence<static_cast<int32>(ENumericKind::Num)>());
+
+		constexpr ENumericKind GetNumericKind(uint64 InTypeId)
+		{
+			for (int32 i = 0; i < static_cast<int32>(ENumericKind::Num); ++i)
+			{
+				if (NumericTypeIds[i] == InTypeId)
+					return static_cast<ENumericKind>(i);
+			}
+			return ENumericKind::None;
+		}
+
+		/**
+		 * Check whether converting between two numeric types is lossless
+		 */
+		template<class src_t, class dst_t>
+		constexpr bool IsWideningConversion()
+		{
+			if constexpr (std::is_same_v<src_t, dst_t> || std::is_same_v<dst_t, bool>)
+				return false;
+			else if constexpr (std::is_same_v<src_t, bool>)
+				return true;
+			else if constexpr (std::is_floating_point_v<src_t>)
+				return std::is_floating_point_v<dst_t> && sizeof(dst_t) > sizeof(src_t);
+			else if constexpr (std::is_floating_point_v<dst_t>)
+				return std::numeric_limits<src_t>::digits <= std::numeric_limits<dst_t>::digits;
+			else if constexpr (std::is_signed_v<src_t>)
+				return std::is_signed_v<dst_t> && sizeof(dst_t) > sizeof(src_t);
+			else
+				return sizeof(dst_t) > sizeof(src_t);
+		}
+
+		using FMigrationConvertFunc = void(*)(const uint8* InSrc, std::size_t InSrcStride, uint8* OutDst, std::size_t InDstStride, std::size_t InNum);
+
+		/**
+		 * Convert a field over a batch of records
+		 * Typed loop over the whole batch, no per-record dispatch
+		 */
+		template<class src_t, class dst_t>
+		void ConvertNumericField(const uint8* InSrc, std::size_t InSrcStride, uint8* OutDst, std::size_t InDstStride, std::size_t InNum)
+		{
+			for (std::size_t i = 0; i < InNum; ++i)
+			{
+				src_t Value;
+				std::memcpy(&Value, InSrc + i * InSrcStride, sizeof(src_t));
+				const dst_t Result = static_cast<dst_t>(Value);
+				std::memcpy(OutDst + i * InDstStride, &Result, sizeof(dst_t));
+			}
+		}
+
+		template<int32 src_kind, int32 dst_kind>
+		constexpr FMigrationConvertFunc GetConvertFunc()
+		{
+			using SrcType = TNumericKindType<src_kind>;
+			using DstType = TNumericKindType<dst_kind>;
+			if constexpr (IsWideningConversion<SrcType, DstType>())
+				return &ConvertNumericField<SrcType, DstType>;
+			else
+				return nullptr;
+		}
+
+		template<std::size_t... Indices>
+		constexpr auto MakeConvertFuncs(std::index_sequence<Indices...>)
+		{
+			constexpr int32 NumKinds = static_cast<int32>(ENumericKind::Num);
+			return std::array<FMigrationConvertFunc, sizeof...(Indices)>{ GetConvertFunc<Indices / NumKinds, Indices % NumKinds>()... };
+		}
+
+		/** Widening conversion per (source kind, target kind), null if not lossless */
+		inline constexpr auto ConvertFuncs = MakeConvertFuncs(std::make_index_sequence<static_cast<int32>(ENumericKind::Num) * static_cast<int32>(ENumericKind::Num)>());
+
+		template<std::size_t... Kinds>
+		constexpr std::array<int32, sizeof...(Kinds)> MakeNumericSizes(std::index_sequence<Kinds...>)
+		{
+			return { static_cast<int32>(sizeof(TNumericKindType<Kinds>))... };
+		}
+
+		inline constexpr std::array<int32, static_cast<int32>(ENumericKind::Num)> NumericSizes = MakeNumericSizes(std::make_index_sequence<static_cast<int32>(ENumericKind::Num)>());
+
+		/**
+		 * Find the widening conversion between two numeric types
+		 * @param InSrcSize Size of the source field, which must match its type (schemas are read from untrusted data)
+		 * @return Conversion function, null if not lossless or not numeric
+		 */
+		constexpr FMigrationConvertFunc FindConvertFunc(uint64 InSrcTypeId, int32 InSrcSize, uint64 InDstTypeId)
+		{
+			const ENumericKind Src = GetNumericKind(InSrcTypeId);
+			const ENumericKind Dst = GetNumericKind(InDstTypeId);
+			if (Src == ENumericKind::None || Dst == ENumericKind::None || NumericSizes[static_cast<int32>(Src)] != InSrcSize)
+				return nullptr;
+			return ConvertFuncs[static_cast<int32>(Src) * static_cast<int32>(ENumericKind::Num) + static_cast<int32>(Dst)];
+		}
+	}
+
+	/**
+	 * Migration step
+	 * Either a memcpy run (Convert is null) or a numeric conversion of a single field
+	 */
+	struct FMigrationStep
+	{
+		int32 SrcOffset = 0;
+		int32 DstOffset = 0;
+		/** Size of the run, in bytes; for conversions, size of the target field */
+		int32 Size = 0;
+		Details::FMigrationConvertFunc Convert = nullptr;
+		/** Size of the source field (conversions only) */
+		int32 SrcSize = 0;
+
+		/**
+		 * Get the number of source bytes read per record
+		 */
+		constexpr int32 GetSrcSize() const { return Convert != nullptr ? SrcSize : Size; }
+	};
+
+	/**
+	 * Plan migrating records from a source schema to a target layout
+	 */
+	class FLayoutMigrationPlan
+	{
+	public:
+		/** Records are processed in batches of this size, each step running over a whole batch */
+		static constexpr std::size_t BatchSize = 256;
+
+		uint64 SourceFingerprint = 0;
+		int32 SourceRecordSize = 0;
+		int32 TargetRecordSize = 0;
+		std::vector<FMigrationStep> Steps;
+		/** Number of target leaves copied as is */
+		int32 NumCopied = 0;
+		/** Number of target leaves widened from another numeric type */
+		int32 NumConverted = 0;
+		/** Number of target leaves left to their default value (new, or with an incompatible type) */
+		int32 NumDefaulted = 0;
+
+		/**
+		 * Check whether a step reads & writes within the source & target records
+		 */
+		constexpr bool IsInRecords(const FMigrationStep& InStep) const
+		{
+			return InStep.SrcOffset >= 0 && InStep.DstOffset >= 0 && InStep.Size >= 0 && InStep.GetSrcSize() >= 0
+				&& static_cast<int64>(InStep.SrcOffset) + InStep.GetSrcSize() <= SourceRecordSize
+				&& static_cast<int64>(InStep.DstOffset) + InStep.Size <= TargetRecordSize;
+		}
+
+		/**
+		 * Migrate records
+		 * @param InSrc Source records, NumRecords * SourceRecordSize bytes
+		 * @param OutDst Target records, NumRecords * TargetRecordSize bytes
+		 * @param InDefault Default target record, copied first when some leaves are defaulted
+		 * @return False if the buffer sizes don't match the same number of records, or a step lies outside of the records
+		 */
+		bool Execute(std::span<const uint8> InSrc, std::span<uint8> OutDst, const uint8* InDefault) const
+		{
+			if (SourceRecordSize <= 0 || TargetRecordSize <= 0)
+				return false;
+			for (const FMigrationStep& Step : Steps)
+			{
+				if (!IsInRecords(Step))
+					return false;
+			}
+			const std::size_t SrcStride = static_cast<std::size_t>(SourceRecordSize);
+			const std::size_t DstStride = static_cast<std::size_t>(TargetRecordSize);
+			const std::size_t NumRecords = InSrc.size() / SrcStride;
+			if (InSrc.size() % SrcStride != 0 || OutDst.size() != NumRecords * DstStride)
+				return false;
+
+			// Same layout, a single run covering whole records
+			if (Steps.size() == 1 && Steps[0].Convert == nullptr && Steps[0].Size == TargetRecordSize && SrcStride == DstStride)
+			{
+				if (!InSrc.empty())
+					std::memcpy(OutDst.data(), InSrc.data(), InSrc.size());
+				return true;
+			}
+
+			for (std::size_t First = 0; First < NumRecords; First += BatchSize)
+			{
+				const std::size_t Num = std::min(BatchSize, NumRecords - First);
+				const uint8* Src = InSrc.data() + First * SrcStride;
+				uint8* Dst = OutDst.data() + First * DstStride;
+
+				if (NumDefaulted > 0)
+				{
+					for (std::size_t i = 0; i < Num; ++i)
+						std::memcpy(Dst + i * DstStride, InDefault, DstStride);
+				}
+
+				for (const FMigrationStep& Step : Steps)
+				{
+					if (Step.Convert != nullptr)
+					{
+						Step.Convert(Src + Step.SrcOffset, SrcStride, Dst + Step.DstOffset, DstStride, Num);
+						continue;
+					}
+					for (std::size_t i = 0; i < Num; ++i)
+						std::memcpy(Dst + i * DstStride + Step.DstOffset, Src + i * SrcStride + Step.SrcOffset, static_cast<std::size_t>(Step.Size));
+				}
+			}
+			return true;
+		}
+	};
+
+	/**
+	 * Build the plan migrating records of a source schema to the current layout of T
+	 * Prefer GetMigrationPlan(), which caches plans
+	 * Source leaves outside of the source record are ignored (their targets keep their default value)
+	 * @param InSource Schema the records were written with
+	 * @return Plan
+	 */
+	template<class T>
+	FLayoutMigrationPlan MakeMigrationPlan(const FLayoutSchema& InSource)
+	{
+		using TableType = TLayoutTable<T>;
+
+		FLayoutMigrationPlan Plan;
+		Plan.SourceFingerprint = InSource.GetFingerprint();
+		Plan.SourceRecordSize = InSource.RecordSize;
+		Plan.TargetRecordSize = static_cast<int32>(sizeof(T));
+
+		if (Plan.SourceFingerprint == GetLayoutFingerprint<T>() && Plan.SourceRecordSize == Plan.TargetRecordSize)
+		{
+			Plan.Steps.push_back(FMigrationStep{ 0, 0, Plan.TargetRecordSize, nullptr });
+			Plan.NumCopied = TableType::NumLeaves;
+			return Plan;
+		}
+
+		std::unordered_map<std::wstring_view, const FLayoutSchemaField*> SourceLeaves;
+		for (const FLayoutSchemaField& Field : InSource.Fields)
+		{
+			if (!Field.bHasLayout && InSource.IsInRecord(Field))
+				SourceLeaves.emplace(Field.Name, &Field);
+		}
+
+		// Leaves by target offset, so that contiguous copies can be merged
+		std::array<int32, TableType::NumLeaves> Leaves = TableType::LeafIndices;
+		std::sort(Leaves.begin(), Leaves.end(), [](int32 A, int32 B) { return TableType::Fields[A].Offset < TableType::Fields[B].Offset; });
+
+		bool bPreviousCopied = false;
+		for (const int32 LeafIndex : Leaves)
+		{
+			const FLayoutFieldDesc& Target = TableType::Fields[LeafIndex];
+			const auto Found = SourceLeaves.find(Target.Name);
+			const FLayoutSchemaField* Source = Found != SourceLeaves.end() ? Found->second : nullptr;
+
+			if (Source != nullptr && Source->TypeId == Target.TypeId && Source->Size == Target.Size)
+			{
+				// Merge with the previous run when both records are contiguous, padding in between included
+				// (only if no defaulted or converted leaf lies in between), runs are kept within both records
+				FMigrationStep* Last = Plan.Steps.empty() ? nullptr : &Plan.Steps.back();
+				const bool bContiguous = bPreviousCopied && Target.Offset - Last->DstOffset == Source->Offset - Last->SrcOffset && Target.Offset >= Last->DstOffset + Last->Size;
+				const int32 MergedSize = bContiguous ? Target.Offset + Target.Size - Last->DstOffset : 0;
+				if (bContiguous && Plan.IsInRecords(FMigrationStep{ Last->SrcOffset, Last->DstOffset, MergedSize, nullptr }))
+					Last->Size = MergedSize;
+				else
+					Plan.Steps.push_back(FMigrationStep{ Source->Offset, Target.Offset, Target.Size, nullptr });
+				++Plan.NumCopied;
+				bPreviousCopied = true;
+				continue;
+			}
+
+			bPreviousCopied = false;
+			if (Source != nullptr)
+			{
+				if (const Details::FMigrationConvertFunc Convert = Details::FindConvertFunc(Source->TypeId, Source->Size, Target.TypeId))
+				{
+					Plan.Steps.push_back(FMigrationStep{ Source->Offset, Target.Offset, Target.Size, Convert, Source->Size });
+					++Plan.NumConverted;
+					continue;
+				}
+			}
+			++Plan.NumDefaulted;
+		}
+		return Plan;
+	}
+
+	/**
+	 * Get the plan migrating records of a source schema to the current layout of T
+	 * Plans are built on first use and cached per source fingerprint; thread-safe
+	 * @param InSource Schema the records were written with
+	 * @return Plan, valid for the whole program
+	 */
+	template<class T>
+	const FLayoutMigrationPlan& GetMigrationPlan(const FLayoutSchema& InSource)
+	{
+		static std::mutex Mutex;
+		static std::unordered_map<uint64, std::unique_ptr<const FLayoutMigrationPlan>> Plans;
+
+		const uint64 Fingerprint = InSource.GetFingerprint();
+		std::lock_guard<std::mutex> Lock(Mutex);
+		std::unique_ptr<const FLayoutMigrationPlan>& Plan = Plans[Fingerprint];
+		if (Plan == nullptr)
+			Plan = std::make_unique<const FLayoutMigrationPlan>(MakeMigrationPlan<T>(InSource));
+		return *Plan;
+	}
+
+	/**
+	 * Migrate records written with a previous layout of T
+	 * @param InSource Schema the records were written with
+	 * @param InRecords Source records, packed (OutRecords.size() * InSource.RecordSize bytes)
+	 * @param OutRecords Migrated records
+	 * @return False if the source size doesn't match the number of records
+	 */
+	template<class T>
+	bool Migrate(const FLayoutSchema& InSource, std::span<const uint8> InRecords, std::span<T> OutRecords)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Migrated records must be trivially copyable");
+
+		if (InSource.RecordSize <= 0 || InRecords.size() != OutRecords.size() * static_cast<std::size_t>(InSource.RecordSize))
+			return false;
+
+		static const T Default{};
+		const FLayoutMigrationPlan& Plan = GetMigrationPlan<T>(InSource);
+		return Plan.Execute(InRecords, std::span<uint8>(reinterpret_cast<uint8*>(OutRecords.data()), OutRecords.size_bytes()), reinterpret_cast<const uint8*>(&Default));
+	}
+}
@@ -0,0 +1,310 @@
+/*!
+ *  @file LayoutPadding.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a compile-time analysis of the padding of reflected types.
+ *  From the offset, size & alignment of each reflected member it computes the bytes lost to padding, per type and per
+ *  nesting level, and the member order minimizing the size of the type.
+ *  Only reflected members are known: unreflected members are counted as padding.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+
+namespace Reflection
+{
+	/**
+	 * Member of a type, as seen by the padding analysis
+	 */
+	struct FPaddingMember
+	{
+		int32 Offset = 0;
+		int32 Size = 0;
+		int32 Alignment = 1;
+	};
+
+	/**
+	 * Compute the bytes of a type covered by none of its members (holes between members & tail padding)
+	 * @param InSize Size of the type
+	 * @param InMembers Members of the type
+	 * @return Padding bytes
+	 */
+	constexpr int32 ComputeDirectPadding(int32 InSize, std::span<const FPaddingMember> InMembers)
+	{
+		int32 Covered = 0;
+		for (const FPaddingMember& Member : InMembers)
+			Covered += Member.Size;
+		return InSize - Covered;
+	}
+
+	/**
+	 * Compute the padding bytes after the last member of a type
+	 * @param InSize Size of the type
+	 * @param InMembers Members of the type
+	 * @return Tail padding bytes
+	 */
+	constexpr int32 ComputeTailPadding(int32 InSize, std::span<const FPaddingMember> InMembers)
+	{
+		int32 End = 0;
+		for (const FPaddingMember& Member : InMembers)
+			End = std::max(End, Member.Offset + Member.Size);
+		return InSize - End;
+	}
+
+	/**
+	 * Compute the member order minimizing the size of a type: by decreasing alignment, declaration order otherwise
+	 * Alignments being powers of two & sizes multiples of their alignment, each member then starts right after the
+	 * previous one, leaving tail padding only
+	 * @param InMembers Members of the type
+	 * @param OutOrder Receives the indices of the members, in optimal order
+	 */
+	constexpr void ComputeOptimalOrder(std::span<const FPaddingMember> InMembers, std::span<int32> OutOrder)
+	{
+		for (int32 i = 0; i < static_cast<int32>(InMembers.size()); ++i)
+		{
+			int32 j = i;
+			for (; j > 0 && InMembers[OutOrder[j - 1]].Alignment < InMembers[i].Alignment; --j)
+				OutOrder[j] = OutOrder[j - 1];
+			OutOrder[j] = i;
+		}
+	}
+
+	/**
+	 * Compute the size of a type whose members would be declared in a given order
+	 * @param InMembers Members of the type
+	 * @param InOrder Indices of the members, in declaration order
+	 * @param InAlignment Alignment of the type
+	 * @return Size
+	 */
+	constexpr int32 ComputeOrderedSize(std::span<const FPaddingMember> InMembers, std::span<const int32> InOrder, int32 InAlignment)
+	{
+		int32 Size = 0;
+		for (int32 Index : InOrder)
+		{
+			const FPaddingMember& Member = InMembers[Index];
+			Size = (Size + Member.Alignment - 1) / Member.Alignment * Member.Alignment + Member.Size;
+		}
+		return std::max((Size + InAlignment - 1) / InAlignment * InAlignment, InAlignment);
+	}
+
+	template<class T>
+	struct TLayoutPadding;
+
+	/**
+	 * Get the padding bytes within a type, nested layouts & fixed arrays of layouts included
+	 * @tparam T Type, 0 for types without layout
+	 */
+	template<class T>
+	constexpr int32 GetPaddingBytes()
+	{
+		if constexpr (HasLayout<T>::Value)
+			return TLayoutPadding<T>::TotalPadding;
+		else if constexpr (GetFieldKind<T>() == EFieldKind::FixedArray)
+			return static_cast<int32>(TContainerTraits<T>::FixedNum) * GetPaddingBytes<TContainerElementType<T>>();
+		else
+			return 0;
+	}
+
+	namespace Details
+	{
+		/**
+		 * Get the number of nesting levels of layouts within a type
+		 */
+		template<class T>
+		constexpr int32 GetPaddingDepth()
+		{
+			if constexpr (HasLayout<T>::Value)
+			{
+				int32 Depth = 0;
+				VisitTupleElements([&Depth](const auto& InField)
+				{
+					Depth = std::max(Depth, GetPaddingDepth<typename std::decay_t<decltype(InField)>::Type>());
+				}, MakeNamedLayout<T>());
+				return Depth + 1;
+			}
+			else if constexpr (GetFieldKind<T>() == EFieldKind::FixedArray)
+				return GetPaddingDepth<TContainerElementType<T>>();
+			else
+				return 0;
+		}
+
+		/**
+		 * Add the padding of a type to each nesting level
+		 * @param OutPadding Padding per level
+		 * @param InDepth Level of T
+		 * @param InMultiplier Number of instances of T
+		 */
+		template<class T>
+		constexpr void AccumulatePaddingPerDepth(int32* OutPadding, int32 InDepth, int32 InMultiplier)
+		{
+			if constexpr (HasLayout<T>::Value)
+			{
+				OutPadding[InDepth] += InMultiplier * TLayoutPadding<T>::DirectPadding;
+				VisitTupleElements([&](const auto& InField)
+				{
+					AccumulatePaddingPerDepth<typename std::decay_t<decltype(InField)>::Type>(OutPadding, InDepth + 1, InMultiplier);
+				}, MakeNamedLayout<T>());
+			}
+			else if constexpr (GetFieldKind<T>() == EFieldKind::FixedArray)
+			{
+				AccumulatePaddingPerDepth<TContainerElementType<T>>(OutPadding, InDepth, InMultiplier * static_cast<int32>(TContainerTraits<T>::FixedNum));
+			}
+		}
+	}
+
+	/**
+	 * Padding analysis of a reflected type
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TLayoutPadding
+	{
+		/** Number of direct members */
+		static constexpr int32 NumMembers = TTupleArity<std::decay_t<decltype(MakeNamedLayout<T>())>>::Value;
+
+		static constexpr int32 Size = static_cast<int32>(sizeof(T));
+		static constexpr int32 Alignment = static_cast<int32>(alignof(T));
+
+	private:
+		static constexpr std::array<FPaddingMember, NumMembers> BuildMembers()
+		{
+			std::array<FPaddingMember, NumMembers> Result = {};
+			int32 Index = 0;
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				using FieldType = typename field_t::Type;
+				Result[Index++] = FPaddingMember{ static_cast<int32>(field_t::MemberOffset), static_cast<int32>(sizeof(FieldType)), static_cast<int32>(alignof(FieldType)) };
+			}, MakeNamedLayout<T>());
+			return Result;
+		}
+
+		static constexpr int32 SumNestedPadding()
+		{
+			int32 Result = 0;
+			VisitTupleElements([&Result](const auto& InField)
+			{
+				Result += GetPaddingBytes<typename std::decay_t<decltype(InField)>::Type>();
+			}, MakeNamedLayout<T>());
+			return Result;
+		}
+
+	public:
+		/** Direct members, in declaration order */
+		static constexpr std::array<FPaddingMember, NumMembers> Members = BuildMembers();
+
+		/** Padding bytes between the direct members of T and at its end */
+		static constexpr int32 DirectPadding = ComputeDirectPadding(Size, Members);
+		/** Padding bytes after the last member of T */
+		static constexpr int32 TailPadding = ComputeTailPadding(Size, Members);
+		/** Padding bytes within the members of T (nested layouts & fixed arrays of layouts) */
+		static constexpr int32 NestedPadding = SumNestedPadding();
+		/** Padding bytes of T, all levels */
+		static constexpr int32 TotalPadding = DirectPadding + NestedPadding;
+
+		/** Number of nesting levels, T being level 0 */
+		static constexpr int32 NumDepths = Details::GetPaddingDepth<T>();
+
+	private:
+		static constexpr std::array<int32, NumDepths> BuildPaddingPerDepth()
+		{
+			std::array<int32, NumDepths> Result = {};
+			Details::AccumulatePaddingPerDepth<T>(Result.data(), 0, 1);
+			return Result;
+		}
+
+		static constexpr std::array<int32, NumMembers> BuildOptimalOrder()
+		{
+			std::array<int32, NumMembers> Result = {};
+			ComputeOptimalOrder(Members, Result);
+			return Result;
+		}
+
+	public:
+		/** Padding bytes per nesting level, summed over every instance of the level (e.g both elements of an array) */
+		static constexpr std::array<int32, NumDepths> PaddingPerDepth = BuildPaddingPerDepth();
+
+		/** Indices of the direct members, in the order minimizing the size of T */
+		static constexpr std::array<int32, NumMembers> OptimalOrder = BuildOptimalOrder();
+		/** Size of T with its direct members in optimal order */
+		static constexpr int32 OptimalSize = ComputeOrderedSize(Members, OptimalOrder, Alignment);
+		/** Bytes saved by reordering the direct members of T */
+		static constexpr int32 SavableBytes = Size - OptimalSize;
+	};
+
+	/**
+	 * Check whether a reflected type holds no padding, nested layouts included
+	 * Provides TIsPaddingFree<T>::Value
+	 */
+	template<class T>
+	struct TIsPaddingFree
+	{
+		static constexpr bool Value = TLayoutPadding<T>::TotalPadding == 0;
+	};
+
+	namespace Details
+	{
+		/**
+		 * Check whether the value of T is its bytes: reflected fields (nested and in fixed arrays) cover the whole
+		 * object and every leaf is an integer, an enum or a pointer (compared by address)
+		 * Floating point values (-0 == +0, NaN), array views (compared by content) and classes with their own
+		 * operator== are not
+		 */
+		template<class T>
+		constexpr bool IsBytewiseComparable()
+		{
+			if constexpr (HasLayout<T>::Value)
+			{
+				bool bResult = TLayoutPadding<T>::TotalPadding == 0;
+				VisitTupleElements([&bResult](const auto& InField)
+				{
+					using field_t = std::decay_t<decltype(InField)>;
+					bResult = bResult && IsBytewiseComparable<typename field_t::Type>();
+				}, MakeNamedLayout<T>());
+				return bResult;
+			}
+			else if constexpr (GetFieldKind<T>() == EFieldKind::FixedArray)
+			{
+				return IsBytewiseComparable<std::remove_const_t<typename TContainerTraits<T>::ElementType>>();
+			}
+			else
+			{
+				return GetFieldKind<T>() != EFieldKind::ArrayView
+					&& (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>)
+					&& std::has_unique_object_representations_v<T>;
+			}
+		}
+	}
+
+	/**
+	 * Check whether two objects of a reflected type are equal exactly when their bytes are, i.e the type is padding free
+	 * and all its leaves are trivially comparable
+	 * Provides TIsBytewiseComparable<T>::Value
+	 */
+	template<class T>
+	struct TIsBytewiseComparable
+	{
+		static constexpr bool Value = Details::IsBytewiseComparable<T>();
+	};
+
+	/**
+	 * Check whether the direct members of a reflected type are declared in an order of minimal size
+	 * Provides TIsOptimallyOrdered<T>::Value
+	 */
+	template<class T>
+	struct TIsOptimallyOrdered
+	{
+		static constexpr bool Value = TLayoutPadding<T>::SavableBytes == 0;
+	};
+}
@@ -0,0 +1,152 @@
+/*!
+ *  @file LayoutPaddingReport.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares the runtime counterpart of TLayoutPadding, over type-erased layout descriptors.
+ *  Used to report the padding of every registered layout (see the LayoutReport tool).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+#include "LayoutDescriptor.h"
+#include "LayoutPadding.h"
+
+using int32 = std::int32_t;
+
+namespace Reflection
+{
+	/**
+	 * Padding analysis of a registered layout
+	 */
+	struct FPaddingReport
+	{
+		/** Analyzed layout */
+		const FLayoutDescriptor* Descriptor = nullptr;
+		/** See TLayoutPadding */
+		int32 DirectPadding = 0;
+		int32 TailPadding = 0;
+		int32 TotalPadding = 0;
+		int32 OptimalSize = 0;
+		/** Padding bytes per nesting level; fixed arrays of layouts have no descriptor, their padding is attributed to the level below them */
+		std::vector<int32> PaddingPerDepth;
+		/** Indices of the fields of the descriptor, in the order minimizing the size of the type */
+		std::vector<int32> OptimalOrder;
+
+		int32 GetSavableBytes() const { return Descriptor->Ops.Size - OptimalSize; }
+	};
+
+	namespace Details
+	{
+		inline std::vector<FPaddingMember> GetPaddingMembers(const FLayoutDescriptor& InDescriptor)
+		{
+			std::vector<FPaddingMember> Members;
+			Members.reserve(InDescriptor.Fields.size());
+			for (const FLayoutDescriptorField& Field : InDescriptor.Fields)
+				Members.push_back(FPaddingMember{ Field.Offset, Field.Type->Size, Field.Type->Alignment });
+			return Members;
+		}
+
+		inline void AccumulatePaddingPerDepth(const FLayoutDescriptor& InDescriptor, int32 InDepth, std::vector<int32>& OutPadding)
+		{
+			if (static_cast<int32>(OutPadding.size()) <= InDepth + 1)
+				OutPadding.resize(InDepth + 2, 0);
+
+			OutPadding[InDepth] += ComputeDirectPadding(InDescriptor.Ops.Size, GetPaddingMembers(InDescriptor));
+			for (const FLayoutDescriptorField& Field : InDescriptor.Fields)
+			{
+				if (Field.Descriptor)
+					AccumulatePaddingPerDepth(*Field.Descriptor, InDepth + 1, OutPadding);
+				else
+					OutPadding[InDepth + 1] += Field.Type->Padding;
+			}
+		}
+	}
+
+	/**
+	 * Analyze the padding of a layout
+	 * @param InDescriptor Layout descriptor
+	 * @return Report
+	 */
+	inline FPaddingReport AnalyzePadding(const FLayoutDescriptor& InDescriptor)
+	{
+		const std::vector<FPaddingMember> Members = Details::GetPaddingMembers(InDescriptor);
+
+		FPaddingReport Report;
+		Report.Descriptor = &InDescriptor;
+		Report.DirectPadding = ComputeDirectPadding(InDescriptor.Ops.Size, Members);
+		Report.TailPadding = ComputeTailPadding(InDescriptor.Ops.Size, Members);
+		Report.TotalPadding = InDescriptor.Ops.Padding;
+
+		Report.OptimalOrder.resize(Members.size());
+		ComputeOptimalOrder(Members, Report.OptimalOrder);
+		Report.OptimalSize = ComputeOrderedSize(Members, Report.OptimalOrder, InDescriptor.Ops.Alignment);
+
+		Details::AccumulatePaddingPerDepth(InDescriptor, 0, Report.PaddingPerDepth);
+		while (Report.PaddingPerDepth.size() > 1 && Report.PaddingPerDepth.back() == 0)
+			Report.PaddingPerDepth.pop_back();
+		return Report;
+	}
+
+	/**
+	 * Analyze the padding of every registered layout
+	 * @return Reports, most padded layouts first
+	 */
+	inline std::vector<FPaddingReport> AnalyzeRegisteredPadding()
+	{
+		std::vector<FPaddingReport> Reports;
+		for (const FLayoutDescriptor* Descriptor : FLayoutDescriptorRegistry::Get().GetAll())
+			Reports.push_back(AnalyzePadding(*Descriptor));
+
+		std::sort(Reports.begin(), Reports.end(), [](const FPaddingReport& InA, const FPaddingReport& InB)
+		{
+			if (InA.TotalPadding != InB.TotalPadding)
+				return InA.TotalPadding > InB.TotalPadding;
+			return InA.Descriptor->Name.ToStringView() < InB.Descriptor->Name.ToStringView();
+		});
+		return Reports;
+	}
+
+	/**
+	 * Write a human readable padding report
+	 * @param OutStream Output stream
+	 * @param InReport Report
+	 */
+	inline void WritePaddingReport(std::wostream& OutStream, const FPaddingReport& InReport)
+	{
+		const FLayoutDescriptor& Descriptor = *InReport.Descriptor;
+		OutStream << Descriptor.Name.ToStringView() << L": " << Descriptor.Ops.Size << L" bytes, align " << Descriptor.Ops.Alignment
+			<< L", " << InReport.TotalPadding << L" padding bytes (" << (Descriptor.Ops.Size ? 100 * InReport.TotalPadding / Descriptor.Ops.Size : 0) << L"%)\n";
+
+		for (std::size_t Depth = 0; Depth < InReport.PaddingPerDepth.size(); ++Depth)
+			OutStream << L"  level " << Depth << L": " << InReport.PaddingPerDepth[Depth] << L" bytes\n";
+
+		// Members are only listed when they leave holes
+		if (InReport.DirectPadding > 0)
+		{
+			int32 End = 0;
+			for (const FLayoutDescriptorField& Field : Descriptor.Fields)
+			{
+				OutStream << L"  +" << Field.Offset << L"\t" << Field.Name.ToStringView() << L" (" << Field.Type->Size << L" bytes)";
+				if (Field.Offset > End)
+					OutStream << L", " << Field.Offset - End << L" padding bytes before";
+				OutStream << L"\n";
+				End = std::max(End, Field.Offset + Field.Type->Size);
+			}
+			if (InReport.TailPadding > 0)
+				OutStream << L"  " << InReport.TailPadding << L" tail padding bytes\n";
+		}
+
+		if (InReport.GetSavableBytes() > 0)
+		{
+			OutStream << L"  reordering saves " << InReport.GetSavableBytes() << L" bytes (" << InReport.OptimalSize << L" bytes):";
+			for (int32 Index : InReport.OptimalOrder)
+				OutStream << L" " << Descriptor.Fields[Index].Name.ToStringView();
+			OutStream << L"\n";
+		}
+	}
+}
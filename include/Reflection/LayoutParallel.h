@@ -0,0 +1,144 @@
+/*!
+ *  @file LayoutParallel.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares parallel iteration over arrays of reflected objects.
+ *  The array is split in chunks spanning whole cache lines, distributed over a work-stealing pool; every object of a chunk
+ *  goes through IterateLayoutNamed with the same field callable protocol as single objects.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Layout.h"
+#include "LayoutIterator.h"
+#include "LayoutView.h"
+#include <Core/ThreadPool.h>
+
+using int32 = std::int32_t;
+using int64 = std::int64_t;
+
+namespace Reflection
+{
+	/** Cache line size assumed to split arrays */
+	constexpr std::size_t CacheLineSize = 64;
+
+	/** Minimum number of bytes per chunk, so that scheduling costs are amortized */
+	constexpr std::size_t MinParallelChunkSize = 16 * 1024;
+
+	/**
+	 * Get the number of objects per chunk when iterating over an array in parallel
+	 * Chunks span whole cache lines: if the array starts on a cache line, two workers never write to the same line
+	 * @tparam T Object type
+	 * @return Number of objects per chunk
+	 */
+	template<class T>
+	constexpr std::size_t GetParallelGrain()
+	{
+		constexpr std::size_t ObjectsPerLine = std::lcm(sizeof(T), CacheLineSize) / sizeof(T);
+		constexpr std::size_t LinesPerChunk = (MinParallelChunkSize + ObjectsPerLine * sizeof(T) - 1) / (ObjectsPerLine * sizeof(T));
+		return ObjectsPerLine * LinesPerChunk;
+	}
+
+	namespace Details
+	{
+		template<class T>
+		using TParallelViewType = std::conditional_t<std::is_const_v<T>, Rf::FLayoutFieldConstView, Rf::FLayoutFieldView>;
+
+		/**
+		 * Per-worker state, on its own cache lines
+		 */
+		template<class state_t>
+		struct alignas(CacheLineSize) TParallelWorkerState
+		{
+			state_t Value;
+		};
+
+		/**
+		 * IterateLayoutNamed callable binding an object view (and a worker state) to the user callable
+		 * Extra arguments are bound here rather than forwarded through IterateLayoutNamed, which would pack them per field
+		 */
+		template<class callable_t, class view_t, class... state_t>
+		struct TParallelFieldVisitor
+		{
+			callable_t& Callable;
+			const view_t& View;
+			std::tuple<state_t&...> State;
+
+			template<class parent_field_t, class field_t>
+			EFieldIterator operator()(const parent_field_t& InParentField, const field_t& InField) const
+			{
+				if constexpr (sizeof...(state_t) == 0)
+					return Callable(InParentField, InField, View);
+				else
+					return Callable(InParentField, InField, View, std::get<0>(State));
+			}
+		};
+	}
+
+	/**
+	 * Iterate over the fields of every object of an array, in parallel
+	 * The callable is invoked concurrently from several threads with (ParentField, Field, View) where View is a
+	 * Rf::FLayoutFieldView (Rf::FLayoutFieldConstView for const objects) to the current object, and returns an EFieldIterator
+	 * @tparam T Object type
+	 * @param InObjects Objects to iterate over
+	 * @param InCallable Field callable
+	 * @param InPool Pool to run on
+	 */
+	template<class T, class callable_t>
+	void ParallelIterateLayout(std::span<T> InObjects, callable_t&& InCallable, FWorkStealingPool& InPool = FWorkStealingPool::Get())
+	{
+		using ViewType = Details::TParallelViewType<T>;
+
+		InPool.ParallelFor(static_cast<int64>(InObjects.size()), static_cast<int64>(GetParallelGrain<T>()), [&](int64 InBegin, int64 InEnd, int32)
+		{
+			for (int64 i = InBegin; i < InEnd; ++i)
+			{
+				const ViewType View{ Rf::TReferenceWrapper<T>(InObjects[i]) };
+				IterateLayoutNamed<std::remove_const_t<T>>(Details::TParallelFieldVisitor<std::remove_reference_t<callable_t>, ViewType>{ InCallable, View, {} });
+			}
+		});
+	}
+
+	/**
+	 * Iterate over the fields of every object of an array in parallel, accumulating into per-worker states
+	 * The callable is invoked with (ParentField, Field, View, State&), State being owned by the current worker;
+	 * worker states are then combined with InReduce, in worker order
+	 * @tparam T Object type
+	 * @param InObjects Objects to iterate over
+	 * @param InInitialState Initial value of each worker state, an identity of InReduce
+	 * @param InCallable Field callable
+	 * @param InReduce Combines two states: state_t(const state_t&, const state_t&)
+	 * @param InPool Pool to run on
+	 * @return Combined state
+	 */
+	template<class T, class state_t, class callable_t, class reduce_t>
+	state_t ParallelIterateLayout(std::span<T> InObjects, const state_t& InInitialState, callable_t&& InCallable, reduce_t&& InReduce, FWorkStealingPool& InPool = FWorkStealingPool::Get())
+	{
+		using ViewType = Details::TParallelViewType<T>;
+
+		std::vector<Details::TParallelWorkerState<state_t>> States(static_cast<std::size_t>(InPool.GetNumWorkers()), Details::TParallelWorkerState<state_t>{ InInitialState });
+		InPool.ParallelFor(static_cast<int64>(InObjects.size()), static_cast<int64>(GetParallelGrain<T>()), [&](int64 InBegin, int64 InEnd, int32 InWorkerIndex)
+		{
+			state_t& State = States[InWorkerIndex].Value;
+			for (int64 i = InBegin; i < InEnd; ++i)
+			{
+				const ViewType View{ Rf::TReferenceWrapper<T>(InObjects[i]) };
+				IterateLayoutNamed<std::remove_const_t<T>>(Details::TParallelFieldVisitor<std::remove_reference_t<callable_t>, ViewType, state_t>{ InCallable, View, { State } });
+			}
+		});
+
+		state_t Result = std::move(States[0].Value);
+		for (std::size_t i = 1; i < States.size(); ++i)
+			Result = InReduce(Result, States[i].Value);
+		return Result;
+	}
+}
@@ -0,0 +1,559 @@
+/*!
+ *  @file LayoutPool.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares pools & arenas allocating reflected objects, by type or by type-erased descriptor.
+ *  Pools hand out generational handles to fixed-size slots carved from large blocks; slots never move, so handles
+ *  stay valid until freed and convert to layout views. Arenas bump-allocate objects of any type and destroy them all
+ *  at once.
+ *  Neither is thread-safe.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LayoutDescriptor.h"
+#include "LayoutView.h"
+#include <Core/Name.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+
+namespace Rf
+{
+	/**
+	 * Handle to an object of a pool
+	 * Handles of freed objects are stale: the pool rejects them, even once their slot is reused
+	 */
+	struct FLayoutPoolHandle
+	{
+		uint32 Index = 0;
+		/** Odd while the object is alive, 0 for null handles */
+		uint32 Generation = 0;
+
+		bool IsNull() const { return Generation == 0; }
+
+		bool operator==(const FLayoutPoolHandle&) const = default;
+	};
+
+	/**
+	 * Size class of a pool, from the size & alignment of the pooled type
+	 */
+	struct FLayoutSizeClass
+	{
+		/** Target size of a block */
+		static constexpr int32 BlockBytes = 64 * 1024;
+		/** Blocks are aligned to cache lines at least */
+		static constexpr int32 MinBlockAlignment = 64;
+		/** Minimum number of slots per block, for large types */
+		static constexpr int32 MinSlotsPerBlock = 16;
+
+		/** Distance between two slots, the size rounded up to the alignment (as in an array) */
+		int32 SlotSize = 0;
+		int32 BlockAlignment = MinBlockAlignment;
+		/** Power of two, so that slot indices split into block & slot with a shift and a mask */
+		int32 SlotsPerBlock = MinSlotsPerBlock;
+
+		/**
+		 * Compute the size class of a type
+		 * @param InSize Size of the type
+		 * @param InAlignment Alignment of the type
+		 * @return Size class
+		 */
+		static constexpr FLayoutSizeClass Make(int32 InSize, int32 InAlignment)
+		{
+			FLayoutSizeClass Result;
+			Result.SlotSize = std::max((InSize + InAlignment - 1) / InAlignment * InAlignment, InAlignment);
+			Result.BlockAlignment = std::max(InAlignment, MinBlockAlignment);
+			Result.SlotsPerBlock = static_cast<int32>(std::bit_floor(static_cast<uint32>(std::max(BlockBytes / Result.SlotSize, MinSlotsPerBlock))));
+			return Result;
+		}
+	};
+
+	/**
+	 * Pool of objects of a reflected type, type-erased
+	 */
+	class FLayoutPool
+	{
+	public:
+		/**
+		 * Construct a pool of the type of a descriptor
+		 * @param InDescriptor Layout descriptor
+		 */
+		explicit FLayoutPool(const Reflection::FLayoutDescriptor& InDescriptor)
+			: FLayoutPool(InDescriptor.Name, InDescriptor.Ops)
+		{
+		}
+
+		/**
+		 * Construct a pool of a type
+		 * @param InType Type name, see TLayout<T>::GetFName()
+		 * @param InOps Operations of the type
+		 */
+		FLayoutPool(FName InType, const Reflection::FLayoutTypeOps& InOps)
+			: Type(InType)
+			, Ops(InOps)
+			, SizeClass(FLayoutSizeClass::Make(InOps.Size, InOps.Alignment))
+			, BlockShift(std::countr_zero(static_cast<uint32>(SizeClass.SlotsPerBlock)))
+		{
+		}
+
+		FLayoutPool(const FLayoutPool&) = delete;
+		FLayoutPool& operator=(const FLayoutPool&) = delete;
+
+		FLayoutPool(FLayoutPool&& InOther) noexcept
+			: Type(InOther.Type)
+			, Ops(InOther.Ops)
+			, SizeClass(InOther.SizeClass)
+			, BlockShift(InOther.BlockShift)
+			, Blocks(std::move(InOther.Blocks))
+			, Generations(std::move(InOther.Generations))
+			, FreeSlots(std::move(InOther.FreeSlots))
+			, NumAlive(std::exchange(InOther.NumAlive, 0))
+		{
+		}
+
+		FLayoutPool& operator=(FLayoutPool&&) = delete;
+
+		~FLayoutPool()
+		{
+			Clear();
+			for (uint8* Block : Blocks)
+				::operator delete(Block, std::align_val_t(SizeClass.BlockAlignment));
+		}
+
+		/**
+		 * Allocate & default construct an object, the type must be default constructible
+		 * The slot is released if the constructor throws
+		 * @return Handle to the object
+		 */
+		FLayoutPoolHandle Allocate()
+		{
+			FLayoutPoolHandle Handle;
+			void* Slot = AllocateSlot(Handle);
+			try
+			{
+				Ops.Construct(Slot);
+			}
+			catch (...)
+			{
+				ReleaseSlot(Handle.Index);
+				throw;
+			}
+			return Handle;
+		}
+
+		/**
+		 * Allocate & default construct objects
+		 * @param InNum Number of objects
+		 * @param OutHandles Receives the handles, appended
+		 */
+		void AllocateBulk(int32 InNum, std::vector<FLayoutPoolHandle>& OutHandles)
+		{
+			Reserve(NumAlive + InNum);
+			OutHandles.reserve(OutHandles.size() + InNum);
+			for (int32 i = 0; i < InNum; ++i)
+				OutHandles.push_back(Allocate());
+		}
+
+		/**
+		 * Destroy an object & release its slot
+		 * @param InHandle Handle to the object, ignored if stale
+		 * @return True if destroyed
+		 */
+		bool Free(FLayoutPoolHandle InHandle)
+		{
+			void* Object = Find(InHandle);
+			if (Object == nullptr)
+				return false;
+			if (!Ops.bTriviallyDestructible)
+				Ops.Destroy(Object);
+			ReleaseSlot(InHandle.Index);
+			return true;
+		}
+
+		/**
+		 * Destroy objects & release their slots
+		 * @param InHandles Handles to the objects, stale ones are ignored
+		 */
+		void FreeBulk(std::span<const FLayoutPoolHandle> InHandles)
+		{
+			for (FLayoutPoolHandle Handle : InHandles)
+				Free(Handle);
+		}
+
+		/**
+		 * Destroy every object, keeping the blocks for reuse
+		 */
+		void Clear()
+		{
+			if (NumAlive == 0)
+				return;
+			for (uint32 Index = 0; Index < Generations.size(); ++Index)
+			{
+				if (Generations[Index] & 1)
+				{
+					if (!Ops.bTriviallyDestructible)
+						Ops.Destroy(GetSlot(Index));
+					ReleaseSlot(Index);
+				}
+			}
+		}
+
+		/**
+		 * Reserve slots, so that allocating up to InNum objects doesn't allocate blocks
+		 * @param InNum Number of objects
+		 */
+		void Reserve(int32 InNum)
+		{
+			while (GetCapacity() < InNum)
+				AddBlock();
+		}
+
+		/**
+		 * Check whether a handle refers to a live object
+		 * @param InHandle Handle
+		 * @return True if valid
+		 */
+		bool IsValid(FLayoutPoolHandle InHandle) const
+		{
+			return InHandle.Index < Generations.size() && Generations[InHandle.Index] == InHandle.Generation && (InHandle.Generation & 1);
+		}
+
+		/**
+		 * Find an object
+		 * @param InHandle Handle to the object
+		 * @return Object, nullptr if the handle is stale
+		 */
+		void* Find(FLayoutPoolHandle InHandle) const
+		{
+			return IsValid(InHandle) ? GetSlot(InHandle.Index) : nullptr;
+		}
+
+		/**
+		 * Get a view to an object
+		 * @param InHandle Handle to the object
+		 * @return View, invalid if the handle is stale
+		 */
+		FLayoutFieldView GetView(FLayoutPoolHandle InHandle) const
+		{
+			void* Object = Find(InHandle);
+			if (Object == nullptr)
+				return FLayoutFieldView();
+			return FLayoutFieldView(Type, std::span<uint8>(static_cast<uint8*>(Object), static_cast<std::size_t>(Ops.Size)));
+		}
+
+		/**
+		 * Invoke a callable on each live object, by increasing slot index
+		 * @param InCallable Callable (FLayoutPoolHandle, void* Object)
+		 */
+		template<class callable_t>
+		void ForEach(callable_t&& InCallable) const
+		{
+			for (uint32 Index = 0; Index < Generations.size(); ++Index)
+			{
+				if (Generations[Index] & 1)
+					InCallable(FLayoutPoolHandle{ Index, Generations[Index] }, GetSlot(Index));
+			}
+		}
+
+		/** Number of live objects */
+		int32 Num() const { return NumAlive; }
+
+		/** Number of slots */
+		int32 GetCapacity() const { return static_cast<int32>(Generations.size()); }
+
+		FName GetType() const { return Type; }
+		const Reflection::FLayoutTypeOps& GetOps() const { return Ops; }
+		const FLayoutSizeClass& GetSizeClass() const { return SizeClass; }
+
+	protected:
+		/**
+		 * Take a free slot, adding a block if none is left
+		 * @param OutHandle Receives the handle of the slot
+		 * @return Uninitialized slot
+		 */
+		void* AllocateSlot(FLayoutPoolHandle& OutHandle)
+		{
+			if (FreeSlots.empty())
+				AddBlock();
+			const uint32 Index = FreeSlots.back();
+			FreeSlots.pop_back();
+			OutHandle = FLayoutPoolHandle{ Index, ++Generations[Index] };
+			++NumAlive;
+			return GetSlot(Index);
+		}
+
+		/**
+		 * Free a slot, its object being destroyed (or never constructed)
+		 * @param InIndex Slot index
+		 */
+		void ReleaseSlot(uint32 InIndex)
+		{
+			++Generations[InIndex];
+			FreeSlots.push_back(InIndex);
+			--NumAlive;
+		}
+
+		uint8* GetSlot(uint32 InIndex) const
+		{
+			return Blocks[InIndex >> BlockShift] + static_cast<std::size_t>(InIndex & (SizeClass.SlotsPerBlock - 1)) * SizeClass.SlotSize;
+		}
+
+	private:
+		void AddBlock()
+		{
+			Blocks.push_back(static_cast<uint8*>(::operator new(static_cast<std::size_t>(SizeClass.SlotSize) * SizeClass.SlotsPerBlock, std::align_val_t(SizeClass.BlockAlignment))));
+			const uint32 First = static_cast<uint32>(Generations.size());
+			Generations.resize(Generations.size() + SizeClass.SlotsPerBlock, 0);
+
+			// Lowest slots on top, so that consecutive allocations are contiguous
+			FreeSlots.reserve(FreeSlots.size() + SizeClass.SlotsPerBlock);
+			for (uint32 Index = First + SizeClass.SlotsPerBlock; Index-- > First;)
+				FreeSlots.push_back(Index);
+		}
+
+		FName Type;
+		Reflection::FLayoutTypeOps Ops;
+		FLayoutSizeClass SizeClass;
+		int32 BlockShift = 0;
+
+		std::vector<uint8*> Blocks;
+		/** Generation of each slot, odd while alive */
+		std::vector<uint32> Generations;
+		std::vector<uint32> FreeSlots;
+		int32 NumAlive = 0;
+	};
+
+	/**
+	 * Pool of objects of a reflected type
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	class TLayoutPool : public FLayoutPool
+	{
+	public:
+		TLayoutPool()
+			: FLayoutPool(Reflection::GetLayoutDescriptor<T>())
+		{
+		}
+
+		/**
+		 * Allocate & construct an object
+		 * The slot is released if the constructor throws
+		 * @param InArgs Constructor arguments
+		 * @return Handle to the object
+		 */
+		template<class... args_t>
+		FLayoutPoolHandle Emplace(args_t&&... InArgs)
+		{
+			FLayoutPoolHandle Handle;
+			void* Slot = AllocateSlot(Handle);
+			try
+			{
+				new (Slot) T(std::forward<args_t>(InArgs)...);
+			}
+			catch (...)
+			{
+				ReleaseSlot(Handle.Index);
+				throw;
+			}
+			return Handle;
+		}
+
+		/**
+		 * Allocate & value construct objects, without going through type-erased operations
+		 * @param InNum Number of objects
+		 * @param OutHandles Receives the handles, appended
+		 */
+		void AllocateBulk(int32 InNum, std::vector<FLayoutPoolHandle>& OutHandles)
+		{
+			Reserve(Num() + InNum);
+			OutHandles.reserve(OutHandles.size() + InNum);
+			for (int32 i = 0; i < InNum; ++i)
+				OutHandles.push_back(Emplace());
+		}
+
+		/**
+		 * Find an object
+		 * @param InHandle Handle to the object
+		 * @return Object, nullptr if the handle is stale
+		 */
+		T* Find(FLayoutPoolHandle InHandle) const
+		{
+			return static_cast<T*>(FLayoutPool::Find(InHandle));
+		}
+
+		/**
+		 * Invoke a callable on each live object, by increasing slot index
+		 * @param InCallable Callable (FLayoutPoolHandle, T&)
+		 */
+		template<class callable_t>
+		void ForEach(callable_t&& InCallable) const
+		{
+			FLayoutPool::ForEach([&InCallable](FLayoutPoolHandle InHandle, void* InObject) { InCallable(InHandle, *static_cast<T*>(InObject)); });
+		}
+	};
+
+	/**
+	 * Arena of reflected objects of any type
+	 * Objects are bump-allocated from blocks and destroyed all at once by Reset(), in reverse allocation order
+	 */
+	class FLayoutArena
+	{
+	public:
+		/**
+		 * Construct an empty arena
+		 * @param InBlockSize Size of the blocks; larger allocations get a block of their own
+		 */
+		explicit FLayoutArena(std::size_t InBlockSize = FLayoutSizeClass::BlockBytes)
+			: BlockSize(InBlockSize)
+		{
+		}
+
+		FLayoutArena(const FLayoutArena&) = delete;
+		FLayoutArena& operator=(const FLayoutArena&) = delete;
+
+		~FLayoutArena()
+		{
+			Reset();
+			for (const FBlock& Block : Blocks)
+				::operator delete(Block.Data, std::align_val_t(BlockAlignment));
+		}
+
+		/**
+		 * Allocate & construct an object
+		 * @param InArgs Constructor arguments
+		 * @return Object, alive until Reset()
+		 */
+		template<class T, class... args_t>
+		T& New(args_t&&... InArgs)
+		{
+			T* Object = new (AllocateBytes(sizeof(T), alignof(T))) T(std::forward<args_t>(InArgs)...);
+			if constexpr (!std::is_trivially_destructible_v<T>)
+				Destructors.push_back(FDestructor{ Reflection::Details::TypeOps<T>.Destroy, reinterpret_cast<uint8*>(Object), sizeof(T), 1 });
+			return *Object;
+		}
+
+		/**
+		 * Allocate & value construct contiguous objects
+		 * Like new T[InNum], throws std::bad_array_new_length if InNum is negative or the array size overflows
+		 * @param InNum Number of objects
+		 * @return Objects, alive until Reset()
+		 */
+		template<class T>
+		std::span<T> NewArray(int32 InNum)
+		{
+			if (InNum < 0 || static_cast<std::size_t>(InNum) > (std::numeric_limits<std::size_t>::max() - alignof(T)) / sizeof(T))
+				throw std::bad_array_new_length();
+
+			T* Objects = static_cast<T*>(AllocateBytes(sizeof(T) * InNum, alignof(T)));
+			std::uninitialized_value_construct_n(Objects, InNum);
+			if constexpr (!std::is_trivially_destructible_v<T>)
+				Destructors.push_back(FDestructor{ Reflection::Details::TypeOps<T>.Destroy, reinterpret_cast<uint8*>(Objects), sizeof(T), InNum });
+			return std::span<T>(Objects, static_cast<std::size_t>(InNum));
+		}
+
+		/**
+		 * Allocate & default construct an object of the type of a descriptor
+		 * @param InDescriptor Layout descriptor
+		 * @return View to the object, alive until Reset()
+		 */
+		FLayoutFieldView New(const Reflection::FLayoutDescriptor& InDescriptor)
+		{
+			const Reflection::FLayoutTypeOps& Ops = InDescriptor.Ops;
+			uint8* Object = static_cast<uint8*>(AllocateBytes(Ops.Size, Ops.Alignment));
+			Ops.Construct(Object);
+			if (!Ops.bTriviallyDestructible)
+				Destructors.push_back(FDestructor{ Ops.Destroy, Object, Ops.Size, 1 });
+			return FLayoutFieldView(InDescriptor.Name, std::span<uint8>(Object, static_cast<std::size_t>(Ops.Size)));
+		}
+
+		/**
+		 * Destroy every object, keeping the blocks for reuse
+		 */
+		void Reset()
+		{
+			for (auto It = Destructors.rbegin(); It != Destructors.rend(); ++It)
+			{
+				for (int32 i = It->Num; i-- > 0;)
+					It->Destroy(It->Data + static_cast<std::size_t>(i) * It->Stride);
+			}
+			Destructors.clear();
+			CurrentBlock = 0;
+			Cursor = 0;
+			UsedBytes = 0;
+		}
+
+		/** Bytes handed out since the last Reset(), alignment padding included */
+		std::size_t GetUsedBytes() const { return UsedBytes; }
+
+		/** Bytes held by the blocks */
+		std::size_t GetReservedBytes() const
+		{
+			std::size_t Result = 0;
+			for (const FBlock& Block : Blocks)
+				Result += Block.Size;
+			return Result;
+		}
+
+	private:
+		/** Blocks are aligned to cache lines; objects with larger alignments are placed by address, see AllocateBytes() */
+		static constexpr std::size_t BlockAlignment = FLayoutSizeClass::MinBlockAlignment;
+
+		struct FBlock
+		{
+			uint8* Data = nullptr;
+			std::size_t Size = 0;
+		};
+
+		struct FDestructor
+		{
+			void (*Destroy)(void* InObject) = nullptr;
+			uint8* Data = nullptr;
+			int32 Stride = 0;
+			int32 Num = 0;
+		};
+
+		void* AllocateBytes(std::size_t InSize, std::size_t InAlignment)
+		{
+			for (; CurrentBlock < Blocks.size(); ++CurrentBlock, Cursor = 0)
+			{
+				const FBlock& Block = Blocks[CurrentBlock];
+				// Align the address rather than the offset in the block, blocks are only BlockAlignment aligned
+				const std::uintptr_t Address = reinterpret_cast<std::uintptr_t>(Block.Data) + Cursor;
+				const std::size_t Start = Cursor + static_cast<std::size_t>((Address + InAlignment - 1) / InAlignment * InAlignment - Address);
+				if (Start + InSize <= Block.Size)
+				{
+					UsedBytes += Start + InSize - Cursor;
+					Cursor = Start + InSize;
+					return Block.Data + Start;
+				}
+			}
+
+			const std::size_t Size = std::max(BlockSize, InSize + InAlignment);
+			Blocks.push_back(FBlock{ static_cast<uint8*>(::operator new(Size, std::align_val_t(BlockAlignment))), Size });
+			return AllocateBytes(InSize, InAlignment);
+		}
+
+		std::size_t BlockSize;
+		std::vector<FBlock> Blocks;
+		std::size_t CurrentBlock = 0;
+		std::size_t Cursor = 0;
+		std::size_t UsedBytes = 0;
+		std::vector<FDestructor> Destructors;
+	};
+}
@@ -0,0 +1,545 @@
+/*!
+ *  @file LayoutSerializer.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a binary serializer driven by layouts.
+ *  Leaf fields are written back to back (no padding, native endianness), in IterateLayoutNamed order.
+ *  Adjacent trivially copyable leaves are merged at compile time into single memcpy runs.
+ *  Containers are leaves: fixed arrays of blittable elements join the memcpy runs, dynamic arrays & views are prefixed
+ *  with their number of elements and written as a single block when their elements are blittable.
+ *  Fields tagged Transient (and their nested fields) are skipped: deserializing leaves them untouched.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "LayoutTable.h"
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+using uint32 = std::uint32_t;
+
+namespace Reflection
+{
+	/**
+	 * Appends bytes to a growable buffer
+	 */
+	class FBinaryWriter
+	{
+	public:
+		explicit FBinaryWriter(std::vector<uint8>& OutBuffer)
+			: Buffer(&OutBuffer)
+		{
+		}
+
+		/**
+		 * Append raw bytes
+		 * @param InData Bytes to append
+		 * @param InSize Number of bytes
+		 */
+		void Write(const void* InData, std::size_t InSize)
+		{
+			const std::size_t Offset = Buffer->size();
+			Buffer->resize(Offset + InSize);
+			std::memcpy(Buffer->data() + Offset, InData, InSize);
+		}
+
+		/**
+		 * Append a trivially copyable value
+		 * @param InValue Value to append
+		 */
+		template<class T>
+		void WriteValue(const T& InValue)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "WriteValue expects a trivially copyable type");
+			Write(&InValue, sizeof(T));
+		}
+
+		/**
+		 * Reserve space for upcoming writes
+		 * @param InSize Number of bytes about to be written
+		 */
+		void Reserve(std::size_t InSize) { Buffer->reserve(Buffer->size() + InSize); }
+
+		std::vector<uint8>& GetBuffer() const { return *Buffer; }
+
+	private:
+		std::vector<uint8>* Buffer;
+	};
+
+	/**
+	 * Reads bytes from a buffer
+	 * Reading past the end sets the error flag, further reads are no-ops
+	 */
+	class FBinaryReader
+	{
+	public:
+		explicit FBinaryReader(std::span<const uint8> InBuffer)
+			: Buffer(InBuffer)
+		{
+		}
+
+		/**
+		 * Read raw bytes
+		 * @param OutData Destination
+		 * @param InSize Number of bytes
+		 * @return False if the buffer is exhausted
+		 */
+		bool Read(void* OutData, std::size_t InSize)
+		{
+			if (bError || Buffer.size() - Cursor < InSize)
+			{
+				bError = true;
+				return false;
+			}
+			std::memcpy(OutData, Buffer.data() + Cursor, InSize);
+			Cursor += InSize;
+			return true;
+		}
+
+		/**
+		 * Skip raw bytes
+		 * @param InSize Number of bytes
+		 * @return False if the buffer is exhausted
+		 */
+		bool Skip(std::size_t InSize)
+		{
+			if (bError || Buffer.size() - Cursor < InSize)
+			{
+				bError = true;
+				return false;
+			}
+			Cursor += InSize;
+			return true;
+		}
+
+		/**
+		 * Read a trivially copyable value
+		 * @param OutValue Value to read
+		 * @return False if the buffer is exhausted
+		 */
+		template<class T>
+		bool ReadValue(T& OutValue)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "ReadValue expects a trivially copyable type");
+			return Read(&OutValue, sizeof(T));
+		}
+
+		bool HasError() const { return bError; }
+		std::size_t Tell() const { return Cursor; }
+		std::size_t Remaining() const { return Buffer.size() - Cursor; }
+
+	private:
+		std::span<const uint8> Buffer;
+		std::size_t Cursor = 0;
+		bool bError = false;
+	};
+
+	/**
+	 * Binary serialization traits of non trivially copyable leaf types
+	 * Specialize with static Write(FBinaryWriter&, const T&) & bool Read(FBinaryReader&, T&)
+	 */
+	template<class T>
+	class TBinaryTraits
+	{
+		TBinaryTraits() = delete;
+	};
+
+	template<class char_t, class traits_t, class allocator_t>
+	class TBinaryTraits<std::basic_string<char_t, traits_t, allocator_t>>
+	{
+	public:
+		using StringType = std::basic_string<char_t, traits_t, allocator_t>;
+
+		static void Write(FBinaryWriter& InWriter, const StringType& InValue)
+		{
+			InWriter.WriteValue(static_cast<std::uint32_t>(InValue.size()));
+			InWriter.Write(InValue.data(), InValue.size() * sizeof(char_t));
+		}
+
+		static bool Read(FBinaryReader& InReader, StringType& OutValue)
+		{
+			std::uint32_t Num = 0;
+			if (!InReader.ReadValue(Num) || InReader.Remaining() / sizeof(char_t) < Num)
+				return false;
+			OutValue.resize(Num);
+			return InReader.Read(OutValue.data(), Num * sizeof(char_t));
+		}
+	};
+
+	template<class T>
+	void Serialize(const T& InObject, FBinaryWriter& InWriter);
+
+	template<class T>
+	bool Deserialize(T& OutObject, FBinaryReader& InReader);
+
+	template<class T>
+	struct TSerializePlan;
+
+	namespace Details
+	{
+		/**
+		 * Check whether the serialized form of a type is its bytes, so that arrays of it are written as a single block
+		 */
+		template<class T>
+		constexpr bool IsBulkSerializable()
+		{
+			if constexpr (HasLayout<T>::Value)
+				return TSerializePlan<T>::bIsBlittable;
+			else if constexpr (GetFieldKind<T>() == EFieldKind::FixedArray)
+				return IsBulkSerializable<TContainerElementType<T>>();
+			else
+				return IsBlittable<T>();
+		}
+
+		/**
+		 * Write a single value: layouts go through their plan, other types through TBinaryTraits
+		 */
+		template<class T>
+		void SerializeValue(FBinaryWriter& InWriter, const T& InValue)
+		{
+			if constexpr (HasLayout<T>::Value)
+				Serialize(InValue, InWriter);
+			else if constexpr (IsBlittable<T>())
+				InWriter.WriteValue(InValue);
+			else
+				TBinaryTraits<T>::Write(InWriter, InValue);
+		}
+
+		template<class T>
+		bool DeserializeValue(FBinaryReader& InReader, T& OutValue)
+		{
+			if constexpr (HasLayout<T>::Value)
+				return Deserialize(OutValue, InReader);
+			else if constexpr (IsBlittable<T>())
+				return InReader.ReadValue(OutValue);
+			else
+				return TBinaryTraits<T>::Read(InReader, OutValue);
+		}
+	}
+
+	/**
+	 * Containers
+	 * Dynamic arrays & views are prefixed with their number of elements (uint32), fixed arrays aren't
+	 * Elements are written as a single block when their serialized form is their bytes, one by one otherwise
+	 * Views are read in place and must already have the serialized number of elements
+	 */
+	template<class T> requires (IsContainer<T>::Value)
+	class TBinaryTraits<T>
+	{
+	public:
+		using TraitsType = TContainerTraits<T>;
+		using ElementType = std::remove_const_t<typename TraitsType::ElementType>;
+
+		static constexpr bool bHasNum = TraitsType::Kind != EFieldKind::FixedArray;
+		static constexpr bool bBulk = Details::IsBulkSerializable<ElementType>();
+
+		static void Write(FBinaryWriter& InWriter, const T& InValue)
+		{
+			const auto Elements = GetElements(InValue);
+			if constexpr (bHasNum)
+				InWriter.WriteValue(static_cast<uint32>(Elements.size()));
+
+			if constexpr (bBulk)
+			{
+				InWriter.Write(Elements.data(), Elements.size_bytes());
+			}
+			else
+			{
+				for (const ElementType& Element : Elements)
+					Details::SerializeValue(InWriter, Element);
+			}
+		}
+
+		static bool Read(FBinaryReader& InReader, T& OutValue)
+		{
+			std::size_t Num = TraitsType::FixedNum;
+			if constexpr (bHasNum)
+			{
+				uint32 SerializedNum = 0;
+				if (!InReader.ReadValue(SerializedNum))
+					return false;
+				Num = SerializedNum;
+			}
+
+			if constexpr (TraitsType::Kind == EFieldKind::ArrayView)
+			{
+				if (TraitsType::Num(OutValue) != Num)
+					return false;
+			}
+			else if constexpr (TraitsType::Kind == EFieldKind::DynamicArray)
+			{
+				if constexpr (bBulk)
+				{
+					if (InReader.Remaining() / sizeof(ElementType) < Num)
+						return false;
+					TraitsType::Resize(OutValue, Num);
+				}
+				else
+				{
+					// Grown one element at a time, a corrupted count must not allocate more than the input can fill
+					OutValue.clear();
+					OutValue.reserve(std::min(Num, InReader.Remaining()));
+					for (std::size_t i = 0; i < Num; ++i)
+					{
+						if (!Details::DeserializeValue(InReader, OutValue.emplace_back()))
+							return false;
+					}
+					return true;
+				}
+			}
+
+			if constexpr (std::is_const_v<typename TraitsType::ElementType>)
+			{
+				return false;
+			}
+			else
+			{
+				ElementType* Data = TraitsType::GetData(OutValue);
+				if constexpr (bBulk)
+				{
+					return InReader.Read(Data, Num * sizeof(ElementType));
+				}
+				else
+				{
+					for (std::size_t i = 0; i < Num; ++i)
+					{
+						if (!Details::DeserializeValue(InReader, Data[i]))
+							return false;
+					}
+					return true;
+				}
+			}
+		}
+	};
+
+	/**
+	 * Serialization step
+	 * Either a memcpy run (Write/Read are null) or a custom leaf going through TBinaryTraits
+	 */
+	struct FSerializeStep
+	{
+		using WriteFunc = void(*)(FBinaryWriter&, const uint8*);
+		using ReadFunc = bool(*)(FBinaryReader&, uint8*);
+
+		/** Offset from the root object */
+		int32 Offset = 0;
+		/** Size of the run, in bytes (memcpy runs only) */
+		int32 Size = 0;
+		WriteFunc Write = nullptr;
+		ReadFunc Read = nullptr;
+	};
+
+	namespace Details
+	{
+		template<class T>
+		void WriteCustomField(FBinaryWriter& InWriter, const uint8* InData)
+		{
+			TBinaryTraits<T>::Write(InWriter, *reinterpret_cast<const T*>(InData));
+		}
+
+		template<class T>
+		bool ReadCustomField(FBinaryReader& InReader, uint8* OutData)
+		{
+			return TBinaryTraits<T>::Read(InReader, *reinterpret_cast<T*>(OutData));
+		}
+
+		template<int32 max_steps>
+		struct TSerializePlanBuilder
+		{
+			std::array<FSerializeStep, max_steps> Steps = {};
+			int32 NumSteps = 0;
+
+			/**
+			 * Add a memcpy run, merging it with the previous one if contiguous
+			 */
+			constexpr void AddRun(int32 InOffset, int32 InSize)
+			{
+				if (NumSteps > 0)
+				{
+					FSerializeStep& Last = Steps[NumSteps - 1];
+					if (Last.Write == nullptr && Last.Offset + Last.Size == InOffset)
+					{
+						Last.Size += InSize;
+						return;
+					}
+				}
+				Steps[NumSteps++] = FSerializeStep{ InOffset, InSize, nullptr, nullptr };
+			}
+
+			constexpr void AddCustom(int32 InOffset, FSerializeStep::WriteFunc InWrite, FSerializeStep::ReadFunc InRead)
+			{
+				Steps[NumSteps++] = FSerializeStep{ InOffset, 0, InWrite, InRead };
+			}
+		};
+
+		/**
+		 * Append the serialization steps of a layout, recursing into nested layouts like IterateNamedLayoutHelper<T, true>
+		 * @param InBaseOffset Offset of the parent field
+		 */
+		template<class T, class builder_t>
+		constexpr void AppendSerializeSteps(builder_t& InBuilder, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using field_t = std::decay_t<decltype(InField)>;
+				using FieldType = typename field_t::Type;
+				const int32 Offset = InBaseOffset + static_cast<int32>(field_t::MemberOffset);
+
+				if constexpr (HasAnyFlags(field_t::Flags, EFieldFlags::Transient))
+					return;
+				else if constexpr (HasLayout<FieldType>::Value)
+					AppendSerializeSteps<FieldType>(InBuilder, Offset);
+				else if constexpr (IsBulkSerializable<FieldType>())
+					InBuilder.AddRun(Offset, static_cast<int32>(sizeof(FieldType)));
+				else
+					InBuilder.AddCustom(Offset, &WriteCustomField<FieldType>, &ReadCustomField<FieldType>);
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class T>
+		constexpr TSerializePlanBuilder<TLayoutTable<T>::NumLeaves> BuildSerializePlan()
+		{
+			TSerializePlanBuilder<TLayoutTable<T>::NumLeaves> Builder;
+			AppendSerializeSteps<T>(Builder, 0);
+			return Builder;
+		}
+	}
+
+	/**
+	 * Serialization plan of a type
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TSerializePlan
+	{
+	private:
+		static constexpr auto Builder = Details::BuildSerializePlan<T>();
+
+		static constexpr std::array<FSerializeStep, Builder.NumSteps> BuildSteps()
+		{
+			std::array<FSerializeStep, Builder.NumSteps> Result = {};
+			for (int32 i = 0; i < Builder.NumSteps; ++i)
+				Result[i] = Builder.Steps[i];
+			return Result;
+		}
+
+	public:
+		/** Steps to execute, in order */
+		static constexpr std::array<FSerializeStep, Builder.NumSteps> Steps = BuildSteps();
+
+		/** Whether the object is written as one single memcpy of sizeof(T) bytes */
+		static constexpr bool bIsBlittable = Steps.size() == 1 && Steps[0].Write == nullptr && Steps[0].Offset == 0 && Steps[0].Size == static_cast<int32>(sizeof(T));
+
+		/** Whether every step is a memcpy run */
+		static constexpr bool bIsTriviallySerializable = []()
+		{
+			for (const FSerializeStep& Step : Steps)
+			{
+				if (Step.Write != nullptr)
+					return false;
+			}
+			return true;
+		}();
+	};
+
+	/**
+	 * Serialize an object
+	 * @param InObject Object to serialize
+	 * @param InWriter Writer to append to
+	 */
+	template<class T>
+	void Serialize(const T& InObject, FBinaryWriter& InWriter)
+	{
+		const uint8* Data = reinterpret_cast<const uint8*>(&InObject);
+		for (const FSerializeStep& Step : TSerializePlan<T>::Steps)
+		{
+			if (Step.Write == nullptr)
+				InWriter.Write(Data + Step.Offset, Step.Size);
+			else
+				Step.Write(InWriter, Data + Step.Offset);
+		}
+	}
+
+	/**
+	 * Deserialize an object
+	 * @param OutObject Object to deserialize into
+	 * @param InReader Reader to consume
+	 * @return False if the input is truncated or malformed
+	 */
+	template<class T>
+	bool Deserialize(T& OutObject, FBinaryReader& InReader)
+	{
+		uint8* Data = reinterpret_cast<uint8*>(&OutObject);
+		for (const FSerializeStep& Step : TSerializePlan<T>::Steps)
+		{
+			const bool bSuccess = Step.Read == nullptr ? InReader.Read(Data + Step.Offset, Step.Size) : Step.Read(InReader, Data + Step.Offset);
+			if (!bSuccess)
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Serialize an array of objects
+	 * Blittable types are written with a single memcpy
+	 * @param InObjects Objects to serialize
+	 * @param InWriter Writer to append to
+	 */
+	template<class T>
+	void SerializeArray(std::span<const T> InObjects, FBinaryWriter& InWriter)
+	{
+		if constexpr (TSerializePlan<T>::bIsBlittable)
+		{
+			InWriter.Write(InObjects.data(), InObjects.size_bytes());
+		}
+		else
+		{
+			if constexpr (TSerializePlan<T>::bIsTriviallySerializable)
+			{
+				std::size_t Size = 0;
+				for (const FSerializeStep& Step : TSerializePlan<T>::Steps)
+					Size += Step.Size;
+				InWriter.Reserve(Size * InObjects.size());
+			}
+
+			for (const T& Object : InObjects)
+				Serialize(Object, InWriter);
+		}
+	}
+
+	/**
+	 * Deserialize an array of objects
+	 * @param OutObjects Objects to deserialize into
+	 * @param InReader Reader to consume
+	 * @return False if the input is truncated or malformed
+	 */
+	template<class T>
+	bool DeserializeArray(std::span<T> OutObjects, FBinaryReader& InReader)
+	{
+		if constexpr (TSerializePlan<T>::bIsBlittable)
+		{
+			return InReader.Read(OutObjects.data(), OutObjects.size_bytes());
+		}
+		else
+		{
+			for (T& Object : OutObjects)
+			{
+				if (!Deserialize(Object, InReader))
+					return false;
+			}
+			return true;
+		}
+	}
+}
@@ -0,0 +1,298 @@
+/*!
+ *  @file LayoutSoA.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a structure-of-arrays container generated from a layout.
+ *  Each leaf field of T is stored in its own contiguous column.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "LayoutTable.h"
+
+using int32 = std::int32_t;
+using uint8 = std::uint8_t;
+
+namespace Rf
+{
+	/**
+	 * Structure of arrays container
+	 * Leaf fields of T must be trivially copyable
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	class TLayoutSoA
+	{
+	public:
+		using TableType = Reflection::TLayoutTable<T>;
+
+		/** Number of columns, one per leaf field */
+		static constexpr int32 NumColumns = TableType::NumLeaves;
+
+		/** Alignment of each column (cache line) */
+		static constexpr std::size_t ColumnAlignment = 64;
+
+		/**
+		 * Get the column index of a field
+		 * @return Column index, -1 if the field isn't a leaf of T
+		 */
+		template<class field_t>
+		static constexpr int32 GetColumnIndex()
+		{
+			return TableType::FindLeafRank(static_cast<int32>(field_t::MemberOffset), Reflection::GetTypeId<typename field_t::Type>());
+		}
+
+		/**
+		 * View to an element of the container
+		 * Mimics TLayoutFieldView, fields are fetched from their columns
+		 */
+		template<bool is_const>
+		class TElementView
+		{
+		public:
+			using OwnerType = typename std::conditional<is_const, const TLayoutSoA, TLayoutSoA>::type;
+			template<class U>
+			using RefType = typename std::conditional<is_const, const U&, U&>::type;
+
+			TElementView(OwnerType& InOwner, std::size_t InIndex)
+				: Owner(&InOwner)
+				, Index(InIndex)
+			{
+			}
+
+			/**
+			 * Extract a field value
+			 * @param InField Field to extract (offset relative to T)
+			 * @return Reference to the member
+			 */
+			template<class U, int32 offset, int32 n, class tags_t>
+			RefType<U> Get(const Reflection::TLayoutField<U, offset, n, tags_t>& InField) const
+			{
+				return Owner->Column(InField)[Index];
+			}
+
+			/**
+			 * Gather this element into an object
+			 * @return Copy of the element
+			 */
+			T Load() const { return Owner->Load(Index); }
+
+			/**
+			 * Scatter an object into this element
+			 * @param InObject Object to copy from
+			 */
+			void Store(const T& InObject) const requires (!is_const) { Owner->Store(Index, InObject); }
+
+			std::size_t GetIndex() const { return Index; }
+
+		private:
+			OwnerType* Owner;
+			std::size_t Index;
+		};
+
+		using FElementView = TElementView<false>;
+		using FElementConstView = TElementView<true>;
+
+		TLayoutSoA() = default;
+
+		TLayoutSoA(const TLayoutSoA& InOther)
+		{
+			Reserve(InOther.Num);
+			for (int32 i = 0; i < NumColumns; ++i)
+				std::memcpy(Columns[i], InOther.Columns[i], InOther.Num * GetLeaf(i).Size);
+			Num = InOther.Num;
+		}
+
+		TLayoutSoA(TLayoutSoA&& InOther) noexcept
+			: Columns(std::exchange(InOther.Columns, {}))
+			, Num(std::exchange(InOther.Num, 0))
+			, Capacity(std::exchange(InOther.Capacity, 0))
+		{
+		}
+
+		TLayoutSoA& operator=(const TLayoutSoA& InOther)
+		{
+			if (this != &InOther)
+			{
+				TLayoutSoA Copy(InOther);
+				Swap(Copy);
+			}
+			return *this;
+		}
+
+		TLayoutSoA& operator=(TLayoutSoA&& InOther) noexcept
+		{
+			TLayoutSoA Moved(std::move(InOther));
+			Swap(Moved);
+			return *this;
+		}
+
+		~TLayoutSoA()
+		{
+			for (uint8* Column : Columns)
+				::operator delete(Column, std::align_val_t(ColumnAlignment));
+		}
+
+		void Swap(TLayoutSoA& InOther) noexcept
+		{
+			std::swap(Columns, InOther.Columns);
+			std::swap(Num, InOther.Num);
+			std::swap(Capacity, InOther.Capacity);
+		}
+
+		std::size_t size() const { return Num; }
+		bool empty() const { return Num == 0; }
+		std::size_t capacity() const { return Capacity; }
+
+		/**
+		 * Reserve storage in each column
+		 * @param InCapacity Minimum number of elements
+		 */
+		void Reserve(std::size_t InCapacity)
+		{
+			if (InCapacity <= Capacity)
+				return;
+
+			for (int32 i = 0; i < NumColumns; ++i)
+			{
+				uint8* NewColumn = static_cast<uint8*>(::operator new(InCapacity * GetLeaf(i).Size, std::align_val_t(ColumnAlignment)));
+				if (Columns[i] != nullptr)
+				{
+					std::memcpy(NewColumn, Columns[i], Num * GetLeaf(i).Size);
+					::operator delete(Columns[i], std::align_val_t(ColumnAlignment));
+				}
+				Columns[i] = NewColumn;
+			}
+			Capacity = InCapacity;
+		}
+
+		void reserve(std::size_t InCapacity) { Reserve(InCapacity); }
+
+		/**
+		 * Resize the container, new elements are copied from a default constructed T
+		 * @param InNum New number of elements
+		 */
+		void resize(std::size_t InNum)
+		{
+			if (InNum > Capacity)
+				Reserve(std::max(InNum, Capacity * 2));
+
+			if (InNum > Num)
+			{
+				const T Default{};
+				for (std::size_t i = Num; i < InNum; ++i)
+					ScatterAt(i, Default);
+			}
+			Num = InNum;
+		}
+
+		void clear() { Num = 0; }
+
+		/**
+		 * Append an element, scattering its leaf fields into their columns
+		 * @param InObject Object to append
+		 */
+		void push_back(const T& InObject)
+		{
+			if (Num == Capacity)
+				Reserve(Capacity == 0 ? 16 : Capacity * 2);
+			ScatterAt(Num++, InObject);
+		}
+
+		void pop_back() { --Num; }
+
+		FElementView operator[](std::size_t InIndex) { return FElementView(*this, InIndex); }
+		FElementConstView operator[](std::size_t InIndex) const { return FElementConstView(*this, InIndex); }
+
+		/**
+		 * Gather an element into an object
+		 * @param InIndex Element index
+		 * @return Copy of the element
+		 */
+		T Load(std::size_t InIndex) const
+		{
+			T Result{};
+			uint8* Data = reinterpret_cast<uint8*>(&Result);
+			for (int32 i = 0; i < NumColumns; ++i)
+			{
+				const Reflection::FLayoutFieldDesc& Leaf = GetLeaf(i);
+				std::memcpy(Data + Leaf.Offset, Columns[i] + InIndex * Leaf.Size, Leaf.Size);
+			}
+			return Result;
+		}
+
+		/**
+		 * Scatter an object into an existing element
+		 * @param InIndex Element index
+		 * @param InObject Object to copy from
+		 */
+		void Store(std::size_t InIndex, const T& InObject) { ScatterAt(InIndex, InObject); }
+
+		/**
+		 * Get the column of a field
+		 * @param InField Leaf field of T (offset relative to T)
+		 * @return Contiguous values of this field
+		 */
+		template<class U, int32 offset, int32 n, class tags_t>
+		std::span<U> Column(const Reflection::TLayoutField<U, offset, n, tags_t>&)
+		{
+			constexpr int32 Index = GetColumnIndex<Reflection::TLayoutField<U, offset, n, tags_t>>();
+			static_assert(Index >= 0, "Field is not a leaf of this layout");
+			return std::span<U>(reinterpret_cast<U*>(Columns[Index]), Num);
+		}
+
+		template<class U, int32 offset, int32 n, class tags_t>
+		std::span<const U> Column(const Reflection::TLayoutField<U, offset, n, tags_t>&) const
+		{
+			constexpr int32 Index = GetColumnIndex<Reflection::TLayoutField<U, offset, n, tags_t>>();
+			static_assert(Index >= 0, "Field is not a leaf of this layout");
+			return std::span<const U>(reinterpret_cast<const U*>(Columns[Index]), Num);
+		}
+
+		/**
+		 * Get the raw bytes of a column
+		 * @param InColumn Column index
+		 * @return Column bytes
+		 */
+		std::span<const uint8> GetColumnData(int32 InColumn) const
+		{
+			return std::span<const uint8>(Columns[InColumn], Num * GetLeaf(InColumn).Size);
+		}
+
+		/**
+		 * Get the descriptor of the leaf stored in a column
+		 * @param InColumn Column index
+		 * @return Leaf descriptor
+		 */
+		static constexpr const Reflection::FLayoutFieldDesc& GetLeaf(int32 InColumn)
+		{
+			return TableType::Fields[TableType::LeafIndices[InColumn]];
+		}
+
+	private:
+		static_assert(TableType::bTriviallyCopyableLeaves, "TLayoutSoA requires trivially copyable leaf fields");
+
+		void ScatterAt(std::size_t InIndex, const T& InObject)
+		{
+			const uint8* Data = reinterpret_cast<const uint8*>(&InObject);
+			for (int32 i = 0; i < NumColumns; ++i)
+			{
+				const Reflection::FLayoutFieldDesc& Leaf = GetLeaf(i);
+				std::memcpy(Columns[i] + InIndex * Leaf.Size, Data + Leaf.Offset, Leaf.Size);
+			}
+		}
+
+		std::array<uint8*, NumColumns> Columns = {};
+		std::size_t Num = 0;
+		std::size_t Capacity = 0;
+	};
+}
@@ -0,0 +1,382 @@
+/*!
+ *  @file LayoutTable.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares the flattened field table of a layout.
+ *  The table is generated once at compile time from TLayout<T>::MakeLayout() and lists every field in the order
+ *  IterateLayoutNamed visits them (nested fields right after their parent), so runtime code can walk a plain array
+ *  instead of instantiating the recursive iterator per callable.
+ */
+
+#pragma once
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include "TypeId.h"
+#include <Core/Hash.h>
+#include <Core/TupleVisitor.h>
+
+using int32 = std::int32_t;
+
+namespace Reflection
+{
+	/**
+	 * Descriptor of a flattened layout field
+	 */
+	struct FLayoutFieldDesc
+	{
+		/** Offset of the field from the root object */
+		int32 Offset = 0;
+		/** Size of the field type */
+		int32 Size = 0;
+		/** Alignment of the field type */
+		int32 Alignment = 0;
+		/** Identifier of the field type, see GetTypeId() */
+		uint64 TypeId = 0;
+		/** Full dotted name, e.g "Position.X" (null terminated) */
+		std::wstring_view Name;
+		/** Nesting depth, 0 for members of the root type */
+		int32 Depth = 0;
+		/** Index of the parent field in the table, -1 for members of the root type */
+		int32 ParentIndex = -1;
+		/** Number of fields nested (recursively) below this one; they directly follow it in the table */
+		int32 NumDescendants = 0;
+		/** Whether the field type has a layout */
+		bool bHasLayout = false;
+		/** Whether the field type is trivially copyable */
+		bool bTriviallyCopyable = false;
+		/** Whether the field bytes hold its whole value, see IsBlittable() */
+		bool bBlittable = false;
+		/** Kind of the field type */
+		EFieldKind Kind = EFieldKind::Value;
+		/** Size of a container element, 0 if not a container */
+		int32 ElementSize = 0;
+		/** Identifier of the container element type, 0 if not a container */
+		uint64 ElementTypeId = 0;
+		/** Number of elements of fixed size containers & fixed extent views, 0 otherwise */
+		int32 NumElements = 0;
+		/** Whether container elements are trivially copyable */
+		bool bTriviallyCopyableElements = false;
+		/** Flags of the field tags, including those of its parent fields (quantization aside) */
+		EFieldFlags Flags = EFieldFlags::None;
+		/** Quantization range, if the field is tagged with FQuantize */
+		FQuantize Quantize = {};
+
+		/**
+		 * Check whether this field is a leaf (i.e has no layout)
+		 * @return True if leaf
+		 */
+		constexpr bool IsLeaf() const { return !bHasLayout; }
+
+		/**
+		 * Check whether this field is a container (fixed array, dynamic array or view)
+		 * @return True if container
+		 */
+		constexpr bool IsContainer() const { return Kind == EFieldKind::FixedArray || Kind == EFieldKind::DynamicArray || Kind == EFieldKind::ArrayView; }
+	};
+
+	namespace Details
+	{
+		/**
+		 * Count fields of a layout, recursively
+		 */
+		template<class T>
+		constexpr int32 CountLayoutFields()
+		{
+			int32 Count = 0;
+			VisitTupleElements([&Count](const auto& InField)
+			{
+				using FieldType = typename std::decay_t<decltype(InField)>::Type;
+				Count += 1;
+				if constexpr (HasLayout<FieldType>::Value)
+					Count += CountLayoutFields<FieldType>();
+			}, MakeNamedLayout<T>());
+			return Count;
+		}
+
+		/**
+		 * Count characters required to store the full names of a layout fields, recursively
+		 * @param InPrefixLen Length of the parent name (0 for root)
+		 */
+		template<class T>
+		constexpr int32 CountLayoutNameChars(int32 InPrefixLen)
+		{
+			int32 Count = 0;
+			VisitTupleElements([&Count, InPrefixLen](const auto& InField)
+			{
+				using FieldType = typename std::decay_t<decltype(InField)>::Type;
+				const int32 NameLen = (InPrefixLen > 0 ? InPrefixLen + 1 : 0) + InField.GetName().Num();
+				// Null terminator
+				Count += NameLen + 1;
+				if constexpr (HasLayout<FieldType>::Value)
+					Count += CountLayoutNameChars<FieldType>(NameLen);
+			}, MakeNamedLayout<T>());
+			return Count;
+		}
+
+		/**
+		 * Intermediate table, names are stored as offsets into a character buffer
+		 */
+		template<int32 num_fields, int32 num_chars>
+		struct TLayoutTableBuilder
+		{
+			std::array<FLayoutFieldDesc, num_fields> Fields = {};
+			std::array<int32, num_fields> NameOffsets = {};
+			std::array<int32, num_fields> NameLengths = {};
+			std::array<wchar_t, num_chars> Names = {};
+			int32 NumFieldsWritten = 0;
+			int32 NumCharsWritten = 0;
+		};
+
+		/**
+		 * Append the fields of a layout to a builder, recursively
+		 * @param InParentIndex Index of the parent field, -1 for root
+		 * @param InBaseOffset Offset of the parent field
+		 */
+		template<class T, class builder_t>
+		constexpr void AppendLayoutFields(builder_t& InBuilder, int32 InParentIndex, int32 InDepth, int32 InBaseOffset)
+		{
+			VisitTupleElements([&](const auto& InField)
+			{
+				using FieldType = typename std::decay_t<decltype(InField)>::Type;
+
+				const int32 Index = InBuilder.NumFieldsWritten++;
+				FLayoutFieldDesc& Desc = InBuilder.Fields[Index];
+				Desc.Offset = InBaseOffset + static_cast<int32>(std::decay_t<decltype(InField)>::MemberOffset);
+				Desc.Size = static_cast<int32>(sizeof(FieldType));
+				Desc.Alignment = static_cast<int32>(alignof(FieldType));
+				Desc.TypeId = GetTypeId<FieldType>();
+				Desc.Depth = InDepth;
+				Desc.ParentIndex = InParentIndex;
+				Desc.bHasLayout = HasLayout<FieldType>::Value;
+				Desc.Flags = std::decay_t<decltype(InField)>::Flags;
+				if (InParentIndex >= 0)
+					Desc.Flags = Desc.Flags | (InBuilder.Fields[InParentIndex].Flags & ~EFieldFlags::Quantized);
+				if constexpr (HasTag<FQuantize, typename std::decay_t<decltype(InField)>::TagsType>())
+					Desc.Quantize = GetTag<FQuantize>(InField.Tags);
+				Desc.bTriviallyCopyable = std::is_trivially_copyable_v<FieldType>;
+				Desc.bBlittable = IsBlittable<FieldType>();
+				Desc.Kind = GetFieldKind<FieldType>();
+				if constexpr (IsContainer<FieldType>::Value)
+				{
+					using ElementType = TContainerElementType<FieldType>;
+					Desc.ElementSize = static_cast<int32>(sizeof(ElementType));
+					Desc.ElementTypeId = GetTypeId<ElementType>();
+					Desc.NumElements = static_cast<int32>(TContainerTraits<FieldType>::FixedNum);
+					Desc.bTriviallyCopyableElements = std::is_trivially_copyable_v<ElementType>;
+				}
+
+				// Full name, "Parent.Field"
+				int32& Cursor = InBuilder.NumCharsWritten;
+				InBuilder.NameOffsets[Index] = Cursor;
+				if (InParentIndex >= 0)
+				{
+					const int32 ParentOffset = InBuilder.NameOffsets[InParentIndex];
+					for (int32 i = 0; i < InBuilder.NameLengths[InParentIndex]; ++i)
+						InBuilder.Names[Cursor++] = InBuilder.Names[ParentOffset + i];
+					InBuilder.Names[Cursor++] = L'.';
+				}
+				const auto& Name = InField.GetName();
+				for (int32 i = 0; i < Name.Num(); ++i)
+					InBuilder.Names[Cursor++] = Name[i];
+				InBuilder.NameLengths[Index] = Cursor - InBuilder.NameOffsets[Index];
+				InBuilder.Names[Cursor++] = L'\0';
+
+				if constexpr (HasLayout<FieldType>::Value)
+					AppendLayoutFields<FieldType>(InBuilder, Index, InDepth + 1, Desc.Offset);
+
+				InBuilder.Fields[Index].NumDescendants = InBuilder.NumFieldsWritten - Index - 1;
+			}, MakeNamedLayout<T>());
+		}
+
+		template<class T>
+		struct TLayoutTableStorage
+		{
+			static constexpr int32 NumFields = CountLayoutFields<T>();
+			static constexpr int32 NumChars = CountLayoutNameChars<T>(0);
+
+			static constexpr TLayoutTableBuilder<NumFields, NumChars> Build()
+			{
+				TLayoutTableBuilder<NumFields, NumChars> Builder;
+				AppendLayoutFields<T>(Builder, -1, 0, 0);
+				return Builder;
+			}
+
+			static constexpr TLayoutTableBuilder<NumFields, NumChars> Data = Build();
+		};
+	}
+
+	/**
+	 * Flattened field table of a layout
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TLayoutTable
+	{
+		using Type = T;
+		using StorageType = Details::TLayoutTableStorage<T>;
+
+		/** Number of fields, including nested layouts and their members */
+		static constexpr int32 Num = StorageType::NumFields;
+
+	private:
+		static constexpr std::array<FLayoutFieldDesc, Num> BuildFields()
+		{
+			std::array<FLayoutFieldDesc, Num> Result = StorageType::Data.Fields;
+			for (int32 i = 0; i < Num; ++i)
+				Result[i].Name = std::wstring_view(StorageType::Data.Names.data() + StorageType::Data.NameOffsets[i], StorageType::Data.NameLengths[i]);
+			return Result;
+		}
+
+		static constexpr int32 CountLeaves()
+		{
+			int32 Count = 0;
+			for (const FLayoutFieldDesc& Field : StorageType::Data.Fields)
+				Count += Field.IsLeaf() ? 1 : 0;
+			return Count;
+		}
+
+		static constexpr bool AreLeavesTriviallyCopyable()
+		{
+			for (const FLayoutFieldDesc& Field : StorageType::Data.Fields)
+			{
+				if (Field.IsLeaf() && !Field.bTriviallyCopyable)
+					return false;
+			}
+			return true;
+		}
+
+	public:
+		/** Number of leaf fields */
+		static constexpr int32 NumLeaves = CountLeaves();
+
+		/** Whether every leaf field is trivially copyable */
+		static constexpr bool bTriviallyCopyableLeaves = AreLeavesTriviallyCopyable();
+
+		/** Fields, in iteration order */
+		static constexpr std::array<FLayoutFieldDesc, Num> Fields = BuildFields();
+
+	private:
+		static constexpr std::array<int32, NumLeaves> BuildLeafIndices()
+		{
+			std::array<int32, NumLeaves> Result = {};
+			int32 LeafIndex = 0;
+			for (int32 i = 0; i < Num; ++i)
+			{
+				if (Fields[i].IsLeaf())
+					Result[LeafIndex++] = i;
+			}
+			return Result;
+		}
+
+	public:
+		/** Indices of the leaf fields within Fields */
+		static constexpr std::array<int32, NumLeaves> LeafIndices = BuildLeafIndices();
+
+		/**
+		 * Find the index of a field from its absolute offset and type
+		 * @return Index within Fields, -1 if not found
+		 */
+		static constexpr int32 FindIndex(int32 InOffset, uint64 InTypeId)
+		{
+			for (int32 i = 0; i < Num; ++i)
+			{
+				if (Fields[i].Offset == InOffset && Fields[i].TypeId == InTypeId)
+					return i;
+			}
+			return -1;
+		}
+
+		/**
+		 * Find the leaf rank (index within LeafIndices) of a field
+		 * @return Leaf rank, -1 if not found or not a leaf
+		 */
+		static constexpr int32 FindLeafRank(int32 InOffset, uint64 InTypeId)
+		{
+			for (int32 i = 0; i < NumLeaves; ++i)
+			{
+				const FLayoutFieldDesc& Field = Fields[LeafIndices[i]];
+				if (Field.Offset == InOffset && Field.TypeId == InTypeId)
+					return i;
+			}
+			return -1;
+		}
+	};
+
+	/**
+	 * Get the flattened field table of a type
+	 * @tparam T Reflected type
+	 * @return Fields, in iteration order
+	 */
+	template<class T>
+	constexpr std::span<const FLayoutFieldDesc> GetLayoutTable()
+	{
+		return std::span<const FLayoutFieldDesc>(TLayoutTable<T>::Fields);
+	}
+
+	/**
+	 * Get the index of a field within the flattened table of T
+	 * @param InField Field, with an offset relative to T (as produced by IterateLayoutNamed)
+	 * @return Index, -1 if the field doesn't belong to T
+	 */
+	template<class T, class field_t>
+	constexpr int32 GetFieldIndex(const field_t& InField)
+	{
+		(void)InField;
+		return TLayoutTable<T>::FindIndex(static_cast<int32>(field_t::MemberOffset), GetTypeId<typename field_t::Type>());
+	}
+
+	/**
+	 * Get the fingerprint of a type layout
+	 * Hashes the size of the type and the offset, size, type id & name of every field; any change to the layout
+	 * (reordered, renamed, retyped, added or removed field) changes the fingerprint
+	 * @tparam T Reflected type
+	 * @return Fingerprint
+	 */
+	template<class T>
+	constexpr uint64 GetLayoutFingerprint()
+	{
+		uint64 Hash = HashCombine(Fnv1aOffsetBasis, sizeof(T));
+		Hash = HashCombine(Hash, alignof(T));
+		for (const FLayoutFieldDesc& Field : TLayoutTable<T>::Fields)
+		{
+			Hash = HashCombine(Hash, static_cast<uint64>(Field.Offset));
+			Hash = HashCombine(Hash, static_cast<uint64>(Field.Size));
+			Hash = HashCombine(Hash, Field.TypeId);
+			Hash = HashCombine(Hash, Field.Name.size());
+			Hash = HashFnv1a(Field.Name.data(), Field.Name.size(), Hash);
+		}
+		return Hash;
+	}
+
+	/**
+	 * Iterate over the flattened table of a layout
+	 * Callable is invoked with a const FLayoutFieldDesc&, and may return an EFieldIterator to skip nested fields
+	 * @tparam T Type
+	 * @param InCallable Callable to execute for each field
+	 */
+	template<class T, class callable_t>
+	constexpr void IterateLayoutTable(callable_t&& InCallable)
+	{
+		constexpr std::span<const FLayoutFieldDesc> Fields = GetLayoutTable<T>();
+		for (std::size_t i = 0; i < Fields.size(); ++i)
+		{
+			const FLayoutFieldDesc& Field = Fields[i];
+			if constexpr (std::is_same_v<decltype(InCallable(Field)), EFieldIterator>)
+			{
+				if (InCallable(Field) == EFieldIterator::Stop)
+					i += Field.NumDescendants;
+			}
+			else
+			{
+				InCallable(Field);
+			}
+		}
+	}
+}
@@ -0,0 +1,386 @@
+/*!
+ *  @file LayoutTrackedView.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares a writable layout view recording which fields were written.
+ *  Each write through FTrackedLayoutFieldView::Get sets the bits of the field (and of its nested fields) in a per-object
+ *  dirty set, indexed like the flattened table of the viewed type (TLayoutTable<T>::Fields).
+ *  Replication & saving then walk the dirty bits instead of diffing or rewriting whole objects.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <span>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include "LayoutTable.h"
+#include "LayoutView.h"
+#include "TypeId.h"
+
+using int32 = std::int32_t;
+using uint64 = std::uint64_t;
+
+namespace Reflection
+{
+	/**
+	 * Key of a field of a flattened table, searchable by offset & type
+	 */
+	struct FLayoutFieldKey
+	{
+		int32 Offset = 0;
+		uint64 TypeId = 0;
+		/** Index within TLayoutTable<T>::Fields */
+		int32 Index = 0;
+		/** See FLayoutFieldDesc::NumDescendants */
+		int32 NumDescendants = 0;
+
+		constexpr bool operator<(const FLayoutFieldKey& InOther) const
+		{
+			return Offset != InOther.Offset ? Offset < InOther.Offset : TypeId < InOther.TypeId;
+		}
+	};
+
+	/**
+	 * Keys of the fields of a type, sorted by offset then type
+	 * @tparam T Reflected type
+	 */
+	template<class T>
+	struct TLayoutFieldKeys
+	{
+		using TableType = TLayoutTable<T>;
+
+	private:
+		static constexpr std::array<FLayoutFieldKey, TableType::Num> Build()
+		{
+			std::array<FLayoutFieldKey, TableType::Num> Result = {};
+			for (int32 i = 0; i < TableType::Num; ++i)
+			{
+				const FLayoutFieldDesc& Field = TableType::Fields[i];
+				Result[i] = FLayoutFieldKey{ Field.Offset, Field.TypeId, i, Field.NumDescendants };
+			}
+			std::sort(Result.begin(), Result.end());
+			return Result;
+		}
+
+	public:
+		static constexpr std::array<FLayoutFieldKey, TableType::Num> Keys = Build();
+	};
+
+	/**
+	 * Find a field from its offset & type
+	 * @param InKeys Sorted keys, see TLayoutFieldKeys
+	 * @param InOffset Offset of the field from the root object
+	 * @param InTypeId Type identifier of the field, see GetTypeId()
+	 * @return Key, nullptr if not found
+	 */
+	inline const FLayoutFieldKey* FindFieldKey(std::span<const FLayoutFieldKey> InKeys, int32 InOffset, uint64 InTypeId)
+	{
+		const FLayoutFieldKey Searched{ InOffset, InTypeId };
+		const auto Found = std::lower_bound(InKeys.begin(), InKeys.end(), Searched);
+		return Found != InKeys.end() && Found->Offset == InOffset && Found->TypeId == InTypeId ? &*Found : nullptr;
+	}
+}
+
+namespace Rf
+{
+	/**
+	 * Set of dirty fields of an object, one bit per field of the flattened table of its type
+	 * Storage is allocated once; marking, clearing & merging never allocate
+	 */
+	class FDirtyFieldSet
+	{
+	public:
+		FDirtyFieldSet() = default;
+
+		/**
+		 * Construct a clean set
+		 * @param InNum Number of fields
+		 */
+		explicit FDirtyFieldSet(int32 InNum)
+		{
+			Init(InNum);
+		}
+
+		/**
+		 * Make a clean set sized for a type
+		 * @tparam T Reflected type
+		 */
+		template<class T>
+		static FDirtyFieldSet Make()
+		{
+			return FDirtyFieldSet(Reflection::TLayoutTable<T>::Num);
+		}
+
+		/**
+		 * Resize & clear this set
+		 * @param InNum Number of fields
+		 */
+		void Init(int32 InNum)
+		{
+			NumBits = InNum;
+			Words.assign(static_cast<std::size_t>((InNum + 63) / 64), 0);
+		}
+
+		/** Number of fields */
+		int32 Num() const { return NumBits; }
+
+		/**
+		 * Mark a field dirty
+		 * @param InIndex Flattened field index
+		 */
+		void Mark(int32 InIndex)
+		{
+			Words[InIndex / 64] |= uint64(1) << (InIndex % 64);
+		}
+
+		/**
+		 * Mark consecutive fields dirty, e.g a field and its nested fields
+		 * @param InFirst First flattened field index
+		 * @param InNum Number of fields
+		 */
+		void MarkRange(int32 InFirst, int32 InNum)
+		{
+			VisitRange(InFirst, InNum, [this](int32 InWord, uint64 InMask) { Words[InWord] |= InMask; return false; });
+		}
+
+		/** Mark every field dirty */
+		void MarkAll()
+		{
+			MarkRange(0, NumBits);
+		}
+
+		/**
+		 * Check whether a field is dirty
+		 * @param InIndex Flattened field index
+		 * @return True if dirty
+		 */
+		bool IsDirty(int32 InIndex) const
+		{
+			return (Words[InIndex / 64] >> (InIndex % 64)) & 1;
+		}
+
+		/**
+		 * Check whether any of consecutive fields is dirty, e.g a field or any of its nested fields
+		 * @param InFirst First flattened field index
+		 * @param InNum Number of fields
+		 * @return True if any is dirty
+		 */
+		bool IsAnyDirty(int32 InFirst, int32 InNum) const
+		{
+			return VisitRange(InFirst, InNum, [this](int32 InWord, uint64 InMask) { return (Words[InWord] & InMask) != 0; });
+		}
+
+		/**
+		 * Check whether any field is dirty
+		 * @return True if any is dirty
+		 */
+		bool IsAnyDirty() const
+		{
+			return std::any_of(Words.begin(), Words.end(), [](uint64 InWord) { return InWord != 0; });
+		}
+
+		/**
+		 * Count dirty fields
+		 * @return Number of dirty fields
+		 */
+		int32 CountDirty() const
+		{
+			int32 Count = 0;
+			for (uint64 Word : Words)
+				Count += std::popcount(Word);
+			return Count;
+		}
+
+		/** Mark every field clean */
+		void Clear()
+		{
+			std::fill(Words.begin(), Words.end(), 0);
+		}
+
+		/**
+		 * Add the dirty fields of another set
+		 * Sets of different sizes only merge the fields they have in common
+		 * @param InOther Set to merge
+		 */
+		void Merge(const FDirtyFieldSet& InOther)
+		{
+			VisitRange(0, std::min(NumBits, InOther.NumBits), [this, &InOther](int32 InWord, uint64 InMask) { Words[InWord] |= InOther.Words[InWord] & InMask; return false; });
+		}
+
+		/**
+		 * Invoke a callable on each dirty field, by increasing index
+		 * @param InCallable Callable (int32 Index)
+		 */
+		template<class callable_t>
+		void ForEachDirty(callable_t&& InCallable) const
+		{
+			for (std::size_t Word = 0; Word < Words.size(); ++Word)
+			{
+				for (uint64 Bits = Words[Word]; Bits != 0; Bits &= Bits - 1)
+					InCallable(static_cast<int32>(Word * 64) + std::countr_zero(Bits));
+			}
+		}
+
+		/**
+		 * Get the bits of this set, 64 fields per word
+		 * @return Words
+		 */
+		std::span<const uint64> GetWords() const { return Words; }
+
+	private:
+		/**
+		 * Invoke a callable (int32 Word, uint64 Mask) on each word covering a range of bits, until it returns true
+		 * @return True if a call returned true
+		 */
+		template<class callable_t>
+		bool VisitRange(int32 InFirst, int32 InNum, callable_t&& InCallable) const
+		{
+			for (int32 Bit = InFirst, End = InFirst + InNum; Bit < End;)
+			{
+				const int32 Count = std::min(64 - Bit % 64, End - Bit);
+				const uint64 Mask = (Count == 64 ? ~uint64(0) : ((uint64(1) << Count) - 1)) << (Bit % 64);
+				if (InCallable(Bit / 64, Mask))
+					return true;
+				Bit += Count;
+			}
+			return false;
+		}
+
+		std::vector<uint64> Words;
+		int32 NumBits = 0;
+	};
+
+	/**
+	 * Merge the dirty fields of many objects of the same type
+	 * @param InSets Dirty sets, all of the same size
+	 * @return Fields dirty in any of the sets, sized like the first set
+	 */
+	inline FDirtyFieldSet MergeDirtyFields(std::span<const FDirtyFieldSet> InSets)
+	{
+		FDirtyFieldSet Result(InSets.empty() ? 0 : InSets.front().Num());
+		for (const FDirtyFieldSet& Set : InSets)
+			Result.Merge(Set);
+		return Result;
+	}
+
+	/**
+	 * Writable view to a reflectable, recording the fields written through it
+	 * Get() marks the field and its nested fields dirty; Read() doesn't mark anything.
+	 * Writes through a view obtained otherwise (e.g GetConstView() then a const_cast) aren't tracked.
+	 */
+	class FTrackedLayoutFieldView
+	{
+	public:
+		FTrackedLayoutFieldView() = default;
+
+		/**
+		 * Construct from a reference to a state
+		 * @param InState State to refer to
+		 * @param InDirty Dirty set of the state, resized & cleared if not sized for T
+		 */
+		template<class T>
+		FTrackedLayoutFieldView(TReferenceWrapper<T> InState, FDirtyFieldSet& InDirty)
+			: View(InState)
+			, Dirty(&InDirty)
+			, Keys(Reflection::TLayoutFieldKeys<T>::Keys)
+		{
+			if (InDirty.Num() != Reflection::TLayoutTable<T>::Num)
+				InDirty.Init(Reflection::TLayoutTable<T>::Num);
+		}
+
+		FTrackedLayoutFieldView(const FTrackedLayoutFieldView&) = default;
+		FTrackedLayoutFieldView(FTrackedLayoutFieldView&&) = default;
+		FTrackedLayoutFieldView& operator=(const FTrackedLayoutFieldView&) = default;
+		FTrackedLayoutFieldView& operator=(FTrackedLayoutFieldView&&) = default;
+
+		/**
+		 * Extract a field value for writing, marking it dirty
+		 * @param InField Field to extract, with an offset relative to the viewed type
+		 * @return Reference to the member
+		 */
+		template<class T, int32 offset, int32 n, class tags_t>
+		T& Get(const Reflection::TLayoutField<T, offset, n, tags_t>& InField) const
+		{
+			constexpr uint64 TypeId = Reflection::GetTypeId<T>();
+			MarkDirty(offset, TypeId);
+			return View.Get(InField);
+		}
+
+		/**
+		 * Extract a field value for reading
+		 * @param InField Field to extract, with an offset relative to the viewed type
+		 * @return Reference to the member
+		 */
+		template<class T, int32 offset, int32 n, class tags_t>
+		const T& Read(const Reflection::TLayoutField<T, offset, n, tags_t>& InField) const
+		{
+			return View.Get(InField);
+		}
+
+		/**
+		 * Assign a field, marking it dirty only if its value changes
+		 * Fields not comparable for equality are always marked
+		 * @param InField Field to assign, with an offset relative to the viewed type
+		 * @param InValue Value
+		 * @return True if marked dirty
+		 */
+		template<class T, int32 offset, int32 n, class tags_t, class value_t>
+		bool Set(const Reflection::TLayoutField<T, offset, n, tags_t>& InField, value_t&& InValue) const
+		{
+			T& Value = View.Get(InField);
+			if constexpr (std::equality_comparable_with<const T&, const value_t&>)
+			{
+				if (Value == InValue)
+					return false;
+			}
+			Value = std::forward<value_t>(InValue);
+			constexpr uint64 TypeId = Reflection::GetTypeId<T>();
+			MarkDirty(offset, TypeId);
+			return true;
+		}
+
+		/**
+		 * Mark a field and its nested fields dirty
+		 * Fields not found in the viewed type mark the whole object dirty
+		 * @param InOffset Offset of the field from the viewed object
+		 * @param InTypeId Type identifier of the field, see GetTypeId()
+		 */
+		void MarkDirty(int32 InOffset, uint64 InTypeId) const
+		{
+			if (const Reflection::FLayoutFieldKey* Key = Reflection::FindFieldKey(Keys, InOffset, InTypeId))
+				Dirty->MarkRange(Key->Index, Key->NumDescendants + 1);
+			else
+				Dirty->MarkAll();
+		}
+
+		/**
+		 * Get the dirty fields of the viewed object
+		 * @return Dirty set
+		 */
+		FDirtyFieldSet& GetDirtyFields() const { return *Dirty; }
+
+		/**
+		 * Get an untracked read-only view to the object
+		 * @return Const view
+		 */
+		FLayoutFieldConstView GetConstView() const { return FLayoutFieldConstView(View); }
+
+		/**
+		 * Check whether this view is valid
+		 * @return True if valid
+		 */
+		bool IsValid() const { return View.IsValid() && Dirty != nullptr; }
+
+	private:
+		FLayoutFieldView View;
+		FDirtyFieldSet* Dirty = nullptr;
+		std::span<const Reflection::FLayoutFieldKey> Keys;
+	};
+}
@@ -17,6 +17,11 @@
 using int32 = std::int32_t;
 using uint8 = std::uint8_t;
 
+namespace Reflection
+{
+	class FLayoutCopyPlan;
+}
+
 namespace Rf
 {
 	// Rebindable reference
@@ -109,8 +114,8 @@ namespace Rf
 		}
 
 		TLayoutFieldView(FName InType, std::span<ByteType> InData)
-			: Data(InData.GetData())
-			, Size(InData.Num())
+			: Data(InData.data())
+			, Size(static_cast<int32>(InData.size()))
 #if CHECK_STATE_TYPE
 			, Type(InType)
 #endif
@@ -151,6 +156,13 @@ namespace Rf
 			std::memcpy(OutState.Data, Data, Size);
 		}
 
+		/**
+		 * Copy a subset of fields to another state (defined in LayoutCopyPlan.h)
+		 * @param OutState State to copy to
+		 * @param InPlan Copy plan of the state type, see MakeCopyPlan()
+		 */
+		void CopyTo(TLayoutFieldView<false> OutState, const Reflection::FLayoutCopyPlan& InPlan) const;
+
 		/**
 		 * Check whether this state is valid
 		 * @return True if valid
@@ -165,8 +177,8 @@ namespace Rf
 		 * @param InField Field to extract
 		 * @return Reference to the member
 		 */
-		template<class T, int32 offset, int32 n>
-		RefType<T> Get(const Reflection::TLayoutField<T, offset, n>& InField) const
+		template<class T, int32 offset, int32 n, class tags_t>
+		RefType<T> Get(const Reflection::TLayoutField<T, offset, n, tags_t>& InField) const
 		{
 			(void)InField;	// compilation warning
 			return (*reinterpret_cast<ValueType<T>*>(Data + offset));
@@ -176,7 +188,7 @@ namespace Rf
 		 * Get a view to the data
 		 * @return View to data
 		 */
-		std::span<ByteType> GetData() const { return TArrayView<ByteType>(Data, Size); }
+		std::span<ByteType> GetData() const { return std::span<ByteType>(Data, Size); }
 
 #if CHECK_STATE_TYPE
 		FName GetType() const { return Type; }
@@ -0,0 +1,104 @@
+/*!
+ *  @file TypeId.h
+ *  @author Paul
+ *  @date 2026-10-17
+ *
+ *  Declares compile-time type identifiers.
+ *  Ids of arithmetic & reflected types only depend on their size / layout name, so they are stable across compilers.
+ */
+
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+#include "ContainerTraits.h"
+#include "Layout.h"
+#include <Core/Hash.h>
+
+namespace Reflection
+{
+	namespace Details
+	{
+		/**
+		 * Compiler generated signature of this function, which embeds T's name
+		 * Only used as a fallback for types which are neither arithmetic nor reflected
+		 */
+		template<class T>
+		constexpr std::string_view GetRawTypeSignature()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			return __FUNCSIG__;
+#else
+			return __PRETTY_FUNCTION__;
+#endif
+		}
+
+		/**
+		 * Hash of the portable name of an arithmetic type ("int32", "uint8", "float", ...)
+		 */
+		template<class T>
+		constexpr uint64 GetArithmeticTypeId()
+		{
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				return HashFnv1a("bool", 4);
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				const char Name[] = { 'f', 'l', 'o', 'a', 't', char('0' + (sizeof(T) * 8) / 10), char('0' + (sizeof(T) * 8) % 10) };
+				return HashFnv1a(Name, sizeof(Name));
+			}
+			else
+			{
+				const char Name[] = { 'u', 'i', 'n', 't', char('0' + (sizeof(T) * 8) / 10), char('0' + (sizeof(T) * 8) % 10) };
+				return std::is_signed_v<T> ? HashFnv1a(Name + 1, sizeof(Name) - 1) : HashFnv1a(Name, sizeof(Name));
+			}
+		}
+	}
+
+	/**
+	 * Get a compile-time identifier of a type
+	 * - Arithmetic types are identified by their portable name (e.g "int32")
+	 * - Reflected types are identified by their layout name
+	 * - Enums are identified by their underlying type
+	 * - Containers are identified by their kind & element type; fixed arrays (C arrays & std::array) by their size too
+	 * - Other types fall back to the compiler signature
+	 * @tparam T Type
+	 * @return Type id
+	 */
+	template<class T>
+	constexpr uint64 GetTypeId()
+	{
+		using Type = std::remove_cv_t<T>;
+		if constexpr (std::is_arithmetic_v<Type>)
+		{
+			return Details::GetArithmeticTypeId<Type>();
+		}
+		else if constexpr (std::is_enum_v<Type>)
+		{
+			return Details::GetArithmeticTypeId<std::underlying_type_t<Type>>();
+		}
+		else if constexpr (HasLayout<Type>::Value)
+		{
+			constexpr auto Name = TLayout<Type>::GetName();
+			return HashFnv1a(Name.CStr(), Name.Num());
+		}
+		else if constexpr (IsContainer<Type>::Value)
+		{
+			using TraitsType = TContainerTraits<Type>;
+			const uint64 ElementId = GetTypeId<typename TraitsType::ElementType>();
+			if constexpr (TraitsType::Kind == EFieldKind::FixedArray)
+				return HashCombine(HashCombine(HashFnv1a("array", 5), ElementId), TraitsType::FixedNum);
+			else if constexpr (TraitsType::Kind == EFieldKind::DynamicArray)
+				return HashCombine(HashFnv1a("vector", 6), ElementId);
+			else
+				return HashCombine(HashCombine(HashFnv1a("span", 4), ElementId), TraitsType::FixedNum);
+		}
+		else
+		{
+			constexpr std::string_view Signature = Details::GetRawTypeSignature<Type>();
+			return HashFnv1a(Signature.data(), Signature.size());
+		}
+	}
+}